@@ -0,0 +1,112 @@
+"""Encoder for the packed pic format decoded by src/PicDecoder.h.
+
+A QOI-like byte code for RGB565, one pixel at a time, row by row:
+
+    00iiiiii            INDEX  pixel from a 64 entry table of seen pixels
+    01rrggbb            DIFF   dr, dg, db in -2..1 (each stored +2)
+    10gggggg rrrrbbbb   LUMA   dg in -32..31, dr-dg/2 and db-dg/2 in -8..7
+    11nnnnnn            RUN    previous pixel 1..62 more times (stored -1)
+    11111110 hi lo      RGB    pixel as is, in wire order
+
+Differences wrap around within the 5/6/5 bit channels. The table slot of a
+pixel is (3r + 5g + 7b) % 64, every pixel that is not part of a run is
+stored in it. Decoding starts with black as the previous pixel and an all
+black table.
+"""
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_RGB = 0xFE
+MAX_RUN = 62
+
+
+def split(px):
+    return (px >> 11) & 31, (px >> 5) & 63, px & 31
+
+
+def slot(px):
+    r, g, b = split(px)
+    return (r * 3 + g * 5 + b * 7) % 64
+
+
+def wrap(d, bits):
+    half = 1 << (bits - 1)
+    return ((d + half) & ((1 << bits) - 1)) - half
+
+
+def encode(pixels):
+    """Native RGB565 pixel values -> packed bytes"""
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+    for px in pixels:
+        if px == prev:
+            run += 1
+            if run == MAX_RUN:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        h = slot(px)
+        if index[h] == px:
+            out.append(OP_INDEX | h)
+        else:
+            index[h] = px
+            r, g, b = split(px)
+            pr, pg, pb = split(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            dr_dg, db_dg = dr - (dg >> 1), db - (dg >> 1)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append((dr_dg + 8) << 4 | (db_dg + 8))
+            else:
+                out += bytes([OP_RGB, px >> 8, px & 0xFF])
+        prev = px
+    if run:
+        out.append(OP_RUN | (run - 1))
+    return bytes(out)
+
+
+def decode(data, count):
+    """Reference decoder, packed bytes -> native RGB565 pixel values"""
+    pixels = []
+    index = [0] * 64
+    px = 0
+    i = 0
+    while len(pixels) < count:
+        b = data[i]
+        i += 1
+        if b == OP_RGB:
+            px = data[i] << 8 | data[i + 1]
+            i += 2
+        elif b & 0xC0 == OP_RUN:
+            pixels += [px] * ((b & 0x3F) + 1)
+            continue
+        elif b & 0xC0 == OP_INDEX:
+            px = index[b & 0x3F]
+        elif b & 0xC0 == OP_DIFF:
+            r, g, b5 = split(px)
+            r = (r + ((b >> 4) & 3) - 2) & 31
+            g = (g + ((b >> 2) & 3) - 2) & 63
+            b5 = (b5 + (b & 3) - 2) & 31
+            px = r << 11 | g << 5 | b5
+        else:
+            dg = (b & 0x3F) - 32
+            d = data[i]
+            i += 1
+            r, g, b5 = split(px)
+            r = (r + (dg >> 1) + (d >> 4) - 8) & 31
+            g = (g + dg) & 63
+            b5 = (b5 + (dg >> 1) + (d & 15) - 8) & 31
+            px = r << 11 | g << 5 | b5
+        index[slot(px)] = px
+        pixels.append(px)
+    return pixels[:count]
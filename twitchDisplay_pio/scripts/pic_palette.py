@@ -0,0 +1,115 @@
+"""Palette pics for src/PaletteDecoder.h: up to 256 RGB565 colours and one
+index byte per pixel.
+
+    byte 0          number of colours - 1
+    byte 1          0
+    2 * colours     the colours, RGB565 in wire order (high byte first)
+    pixels          one index into the colours per pixel, row by row
+
+Pics with at most 256 colours are stored exactly. Others are reduced by a
+median cut over their colours, refined by a few rounds of k-means, and every
+pixel takes the nearest of the resulting colours.
+"""
+
+import math
+
+MAX_COLORS = 256
+REFINE_ROUNDS = 4
+
+
+def rgb888(px):
+    """Native RGB565 -> (r, g, b) in 0..255"""
+    return ((px >> 11) * 255 + 15) // 31, (((px >> 5) & 63) * 255 + 31) // 63, ((px & 31) * 255 + 15) // 31
+
+
+def rgb565(r, g, b):
+    return (int(r * 31 / 255 + 0.5) << 11) | (int(g * 63 / 255 + 0.5) << 5) | int(b * 31 / 255 + 0.5)
+
+
+def _distance(a, b):
+    return (a[0] - b[0]) ** 2 + (a[1] - b[1]) ** 2 + (a[2] - b[2]) ** 2
+
+
+def _mean(colors):
+    """Weighted mean of [((r, g, b), count)]"""
+    total = sum(n for _, n in colors)
+    return tuple(sum(c[i] * n for c, n in colors) / total for i in range(3))
+
+
+def _median_cut(colors, count):
+    boxes = [colors]
+    while len(boxes) < count:
+        # split the box with the most weighted spread along its widest axis
+        best = None
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            spans = [max(c[a] for c, _ in box) - min(c[a] for c, _ in box) for a in range(3)]
+            axis = spans.index(max(spans))
+            score = spans[axis] * sum(n for _, n in box)
+            if best is None or score > best[0]:
+                best = (score, i, axis)
+        if best is None:
+            break
+        _, i, axis = best
+        box = sorted(boxes.pop(i), key=lambda e: e[0][axis])
+        half, acc, cut = sum(n for _, n in box) / 2, 0, 1
+        for cut, (_, n) in enumerate(box, 1):
+            acc += n
+            if acc >= half:
+                break
+        cut = min(max(cut, 1), len(box) - 1)
+        boxes += [box[:cut], box[cut:]]
+    return [_mean(box) for box in boxes]
+
+
+def _nearest(color, palette):
+    return min(range(len(palette)), key=lambda i: _distance(color, palette[i]))
+
+
+def quantize(pixels):
+    """Native RGB565 pixel values -> (palette, indices), the palette as
+    native RGB565 values"""
+    counts = {}
+    for px in pixels:
+        counts[px] = counts.get(px, 0) + 1
+    if len(counts) <= MAX_COLORS:
+        palette = sorted(counts)
+        lookup = {px: i for i, px in enumerate(palette)}
+        return palette, [lookup[px] for px in pixels]
+
+    colors = [(rgb888(px), n) for px, n in sorted(counts.items())]
+    centers = _median_cut(colors, MAX_COLORS)
+    for _ in range(REFINE_ROUNDS):
+        members = [[] for _ in centers]
+        for c, n in colors:
+            members[_nearest(c, centers)].append((c, n))
+        centers = [_mean(m) if m else centers[i] for i, m in enumerate(members)]
+
+    palette = sorted(set(rgb565(*c) for c in centers))
+    targets = [rgb888(px) for px in palette]
+    lookup = {px: _nearest(rgb888(px), targets) for px in counts}
+    return palette, [lookup[px] for px in pixels]
+
+
+def encode(palette, indices):
+    data = bytearray([len(palette) - 1, 0])
+    for px in palette:
+        data += bytes((px >> 8, px & 0xFF))
+    return bytes(data + bytes(indices))
+
+
+def decode(data, count):
+    """Palette pic -> count native RGB565 pixel values"""
+    colors = data[0] + 1
+    palette = [(data[2 + i * 2] << 8) | data[3 + i * 2] for i in range(colors)]
+    return [palette[i] for i in data[2 + colors * 2:2 + colors * 2 + count]]
+
+
+def psnr(reference, pixels):
+    """PSNR in dB over the 8 bit channels of two lists of native RGB565
+    pixels, inf if they are equal"""
+    error = sum(_distance(rgb888(a), rgb888(b)) for a, b in zip(reference, pixels))
+    if not error:
+        return math.inf
+    return 10 * math.log10(255 ** 2 * 3 * len(reference) / error)
@@ -0,0 +1,475 @@
+#!/usr/bin/env python3
+"""Build the channel pics listed in assets/pics.csv.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini), taking
+its options from the [pics] section. It writes
+
+  - data/assets.bin, the image of the assets partition that the firmware
+    maps and reads through src/AvatarStore.h. `pio run -t uploadassets`
+    flashes it, over OTA when that is the upload protocol.
+  - pics.h into the build directory, with the pics compiled in, for the
+    display test and the pic benchmark.
+
+Can also be run by hand:
+
+    python3 scripts/pics_build.py [--manifest assets/pics.csv] [--out DIR]
+                                  [--assets FILE] [--size 64] [--dither] [--raw]
+                                  [--palette] [--report]
+    python3 scripts/pics_build.py --export IMAGE... [--size 64]
+
+Every image is cut to a square around the middle, scaled to the pic size and
+converted to RGB565, optionally with Floyd-Steinberg dithering. pics.h holds
+them packed (see pic_codec.py and src/PicDecoder.h) or, with --raw, as RGB565
+in wire order. It also holds channelPics[], sorted by channel id, and
+picForChannel(id), a constexpr lookup into it.
+
+assets.bin is a 16 byte header (magic "TDAS", version, pic size, number of
+channels, length and CRC-32 of the rest), an index of 20 byte entries sorted
+by channel id (id, offset, length, format) and the pics. In there a pic is
+only stored packed when that is smaller. With --palette a pic can also be
+stored with a palette of at most 256 colours (see pic_palette.py and
+src/PaletteDecoder.h), which is drawn straight from flash; it is when that
+is the smallest of the three. Pics with more colours lose some quality that
+way. --report prints size and quality of every format for each image.
+
+The assets partition holds 45056 bytes. The pics listed take 36189 of them,
+which leaves room for about two more channels with pics that pack as well.
+A pic takes at most 8192 bytes raw, 4610 with a palette; with --palette
+nine channels of any kind fit. The build fails when the pics do not fit.
+
+Images are read with Pillow. Without it only PNGs that already have the pic
+size can be used, which is what the manifest lists so that the build works
+with the Python of a stock PlatformIO. --export cuts and scales other images
+into such PNGs next to them, as it was done for gronkh.webp and
+pietsmiet.jpg.
+"""
+
+import argparse
+import csv
+import os
+import re
+import struct
+import sys
+import zlib
+
+try:
+    Import("env")  # noqa: F821, defined when run by PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    env = None
+    PROJECT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+sys.path.insert(0, os.path.join(PROJECT_DIR, "scripts"))
+import pic_codec  # noqa: E402
+import pic_palette  # noqa: E402
+
+# assets.bin, see src/AvatarStore.h
+ASSETS_MAGIC = b"TDAS"
+ASSETS_VERSION = 1
+ASSETS_HEADER = struct.Struct("<4sBBHII")
+ASSETS_ENTRY = struct.Struct("<12sIHBB")
+FORMAT_RAW = 0
+FORMAT_PACKED = 1
+FORMAT_PALETTE = 2
+
+
+def read_manifest(path):
+    """[(channel id, name, image path)]"""
+    entries = []
+    with open(path, newline="") as f:
+        for row in csv.reader(f):
+            if not row or row[0].lstrip().startswith("#"):
+                continue
+            if len(row) != 3:
+                sys.exit("%s: expected 'id,name,image' but got %s" % (path, ",".join(row)))
+            channel_id, name, image = (c.strip() for c in row)
+            entries.append((channel_id, name, os.path.join(os.path.dirname(path), image)))
+    return entries
+
+
+def read_png(path):
+    """Minimal reader for 8 bit grey, RGB and RGBA PNGs without interlacing"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG")
+    pos, idat = 8, b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            w, h, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    channels = {0: 1, 2: 3, 6: 4}.get(color)
+    if depth != 8 or channels is None or interlace:
+        raise ValueError("only 8 bit grey/RGB/RGBA PNGs without interlacing are supported")
+
+    raw = zlib.decompress(idat)
+    stride = w * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = row[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                row[i] = (row[i] + a) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + b) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                row[i] = (row[i] + pred) & 0xFF
+        rows.append(row)
+        prev = row
+
+    pixels = []
+    for row in rows:
+        for x in range(w):
+            px = row[x * channels:(x + 1) * channels]
+            if channels == 1:
+                px = [px[0]] * 3
+            elif channels == 4:
+                # transparent parts end up black like the panel background
+                px = [v * px[3] // 255 for v in px[:3]]
+            pixels.append(tuple(px[:3]))
+    return w, h, pixels
+
+
+def load_image(path, size):
+    """size*size (r, g, b) tuples, row by row"""
+    try:
+        from PIL import Image, ImageOps
+    except ImportError:
+        Image = None
+    if Image is not None:
+        img = Image.open(path).convert("RGBA")
+        background = Image.new("RGBA", img.size, (0, 0, 0, 255))
+        img = Image.alpha_composite(background, img).convert("RGB")
+        img = ImageOps.fit(img, (size, size), Image.LANCZOS)
+        if hasattr(img, "get_flattened_data"):
+            return list(img.get_flattened_data())
+        return list(img.getdata())
+
+    try:
+        w, h, pixels = read_png(path)
+    except ValueError as e:
+        sys.exit("%s: %s, install Pillow to use other images" % (path, e))
+    if (w, h) != (size, size):
+        sys.exit("%s: is %dx%d, install Pillow to scale it to %dx%d" % (path, w, h, size, size))
+    return pixels
+
+
+def export_png(path, size):
+    """Writes the image as a size*size PNG next to it, returns its path"""
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("--export needs Pillow")
+    img = Image.new("RGB", (size, size))
+    img.putdata(load_image(path, size))
+    out_path = os.path.splitext(path)[0] + ".png"
+    if os.path.abspath(out_path) == os.path.abspath(path):
+        sys.exit("%s: would overwrite itself" % path)
+    img.save(out_path, optimize=True)
+    print("%s: %dx%d from %s" % (out_path, size, size, os.path.basename(path)))
+    return out_path
+
+
+def to_rgb565(pixels, size, dither):
+    """(r, g, b) tuples -> native RGB565 values"""
+    bits = (5, 6, 5)
+    work = [list(map(float, p)) for p in pixels]
+    out = []
+    for i, px in enumerate(work):
+        q = []
+        for c in range(3):
+            levels = (1 << bits[c]) - 1
+            v = min(255.0, max(0.0, px[c]))
+            q.append(int(v * levels / 255 + 0.5))
+            if not dither:
+                continue
+            err = v - q[c] * 255 / levels
+            x, y = i % size, i // size
+            for dx, dy, weight in ((1, 0, 7), (-1, 1, 3), (0, 1, 5), (1, 1, 1)):
+                if 0 <= x + dx < size and y + dy < size:
+                    work[i + dy * size + dx][c] += err * weight / 16
+        out.append(q[0] << 11 | q[1] << 5 | q[2])
+    return out
+
+
+def identifier(name):
+    return re.sub(r"\W", "_", name)
+
+
+def write_assets(path, entries, pics, size):
+    """Image of the assets partition, see src/AvatarStore.h"""
+    rows = sorted(entries, key=lambda e: e[0].encode())
+    data_start = ASSETS_HEADER.size + ASSETS_ENTRY.size * len(rows)
+    index, data = bytearray(), bytearray()
+    # channels that share an image share its data
+    placed = {}
+    formats = [0, 0, 0]
+    for channel_id, _, image in rows:
+        if len(channel_id.encode()) >= 12:
+            sys.exit("channel id %s is too long for the assets index" % channel_id)
+        if image not in placed:
+            raw, packed, palette = pics[image]
+            # the smallest, raw when they are the same size
+            fmt, pic = FORMAT_RAW, raw
+            for candidate_fmt, candidate in ((FORMAT_PACKED, packed), (FORMAT_PALETTE, palette)):
+                if candidate is not None and len(candidate) < len(pic):
+                    fmt, pic = candidate_fmt, candidate
+            formats[fmt] += 1
+            data += bytes(-len(data) % 4)  # keep every pic 4 byte aligned
+            placed[image] = (data_start + len(data), len(pic), fmt)
+            data += pic
+        offset, length, fmt = placed[image]
+        index += ASSETS_ENTRY.pack(channel_id.encode(), offset, length, fmt, 0)
+
+    body = bytes(index + data)
+    header = ASSETS_HEADER.pack(ASSETS_MAGIC, ASSETS_VERSION, size, len(rows), len(body), zlib.crc32(body))
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(header + body)
+    print("%s: %d pics for %d channels (%d raw, %d packed, %d palette), %d bytes" % (
+        path, len(placed), len(rows), *formats, len(header) + len(body)))
+    return len(header) + len(body)
+
+
+def print_report(report, size):
+    """Size of every format and how close the palette gets, per image"""
+    raw_size = size * size * 2
+    print("%-20s %6s %7s %7s %7s %8s" % ("image", "colors", "raw", "packed", "palette", "PSNR"))
+    totals = [0, 0, 0]
+    for name, colors, packed_size, palette_size, quality in report:
+        totals = [totals[0] + raw_size, totals[1] + packed_size, totals[2] + palette_size]
+        print("%-20s %6d %7d %7d %7d %5.1f dB" % (name, colors, raw_size, packed_size, palette_size, quality))
+    print("%-20s %6s %7d %7d %7d" % ("total", "", *totals))
+    print("%-20s %6s %7s %6.0f%% %6.0f%%" % ("of raw", "", "", totals[1] * 100 / totals[0], totals[2] * 100 / totals[0]))
+
+
+def build(manifest, out_path, size, dither, packed, assets_path=None, palette=False, report=False):
+    entries = read_manifest(manifest)
+    if not entries:
+        sys.exit("%s: no pics listed" % manifest)
+    if not 0 < size < 256:
+        sys.exit("pic size %d does not fit the assets header" % size)
+
+    ids = [e[0] for e in entries]
+    for channel_id in set(ids):
+        if ids.count(channel_id) > 1:
+            sys.exit("%s: channel %s is listed more than once" % (manifest, channel_id))
+
+    # one array per image, several channels may share it
+    images = {}
+    for channel_id, name, image in entries:
+        if image not in images:
+            images[image] = identifier(os.path.splitext(os.path.basename(image))[0])
+
+    out = [
+        "// Generated by scripts/pics_build.py from %s, do not edit." % os.path.basename(manifest),
+        "",
+        "#ifndef PICS_H",
+        "#define PICS_H",
+        "",
+        "#include <Arduino.h>",
+        "#include <cstddef>",
+        "",
+        "#define PIC_SIZE %d" % size,
+        "// 1: pics are packed, see PicDecoder.h, 0: RGB565 in wire order",
+        "#define PICS_PACKED %d" % (1 if packed else 0),
+        "// 1: pics also have a palette version, see PaletteDecoder.h",
+        "#define PICS_PALETTE %d" % (1 if palette else 0),
+        "",
+    ]
+    total = stored = 0
+    pics = {}
+    quality = []
+    for image, ident in images.items():
+        pixels = to_rgb565(load_image(image, size), size, dither)
+        raw = bytes(b for p in pixels for b in (p >> 8, p & 0xFF))
+        # assets.bin takes it packed where that is smaller, even with --raw
+        packed_data = pic_codec.encode(pixels)
+        if pic_codec.decode(packed_data, len(pixels)) != pixels:
+            sys.exit("%s: does not survive packing" % image)
+        palette_data = None
+        if palette or report:
+            palette_data = pic_palette.encode(*pic_palette.quantize(pixels))
+            quality.append((os.path.basename(image), len(set(pixels)), len(pic_codec.encode(pixels)), len(palette_data),
+                            pic_palette.psnr(pixels, pic_palette.decode(palette_data, len(pixels)))))
+        pics[image] = (raw, packed_data, palette_data if palette else None)
+        data = packed_data if packed else raw
+        total += size * size * 2
+        stored += len(data)
+        out.append("// %s, %d of %d bytes" % (os.path.basename(image), len(data), size * size * 2))
+        out.append("const uint8_t pic_%s [] PROGMEM = {" % ident)
+        out.append(",\n".join("  " + ", ".join("0x%02x" % b for b in data[i:i + 32])
+                              for i in range(0, len(data), 32)))
+        out.append("};")
+        if palette:
+            out.append("const uint8_t pal_%s [] PROGMEM = {" % ident)
+            out.append(",\n".join("  " + ", ".join("0x%02x" % b for b in palette_data[i:i + 32])
+                                  for i in range(0, len(palette_data), 32)))
+            out.append("};")
+        out.append("")
+
+    out += [
+        "struct channelPic {",
+        "  const char* id;",
+        "  const uint8_t* pic;",
+        "  uint32_t size;",
+        "  const uint8_t* palette; // nullptr without PICS_PALETTE",
+        "};",
+        "",
+        "// Sorted by id for picForChannel()",
+        "constexpr channelPic channelPics[] = {",
+    ]
+    rows = sorted(entries, key=lambda e: e[0].encode())
+    out += ['  {"%s", pic_%s, sizeof(pic_%s), %s}, // %s' % (
+        i, images[img], images[img], ("pal_" + images[img]) if palette else "nullptr", n) for i, n, img in rows]
+    out += [
+        "};",
+        "constexpr std::size_t CHANNEL_PICS_NUM = %d;" % len(rows),
+        "",
+        "constexpr int picIdCompare(const char* a, const char* b){",
+        "  return (*a != *b || *a == '\\0') ? (unsigned char)*a - (unsigned char)*b : picIdCompare(a+1, b+1);",
+        "}",
+        "",
+        "// Pic of a channel, nullptr if there is none. Binary search, so with a",
+        "// literal id the compiler resolves it at compile time.",
+        "constexpr const uint8_t* picForChannel(const char* id, std::size_t lo = 0, std::size_t hi = CHANNEL_PICS_NUM){",
+        "  return (lo >= hi) ? nullptr",
+        "    : (picIdCompare(id, channelPics[(lo+hi)/2].id) == 0) ? channelPics[(lo+hi)/2].pic",
+        "    : (picIdCompare(id, channelPics[(lo+hi)/2].id) < 0) ? picForChannel(id, lo, (lo+hi)/2)",
+        "    : picForChannel(id, (lo+hi)/2+1, hi);",
+        "}",
+        "",
+        "#endif",
+    ]
+
+    os.makedirs(os.path.dirname(os.path.abspath(out_path)), exist_ok=True)
+    with open(out_path, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("%s: %d pics for %d channels, %d of %d bytes (%.2fx)" % (
+        out_path, len(images), len(rows), stored, total, total / stored))
+    if quality and palette:
+        print("palette pics: %d of %d bytes, worst PSNR %.1f dB if all were stored that way" % (
+            sum(q[3] for q in quality), total, min(q[4] for q in quality)))
+    if report:
+        print_report(quality, size)
+    if assets_path is not None:
+        return write_assets(assets_path, entries, pics, size)
+    return 0
+
+
+def parse_bool(value):
+    return str(value).strip().lower() in ("1", "yes", "true", "on")
+
+
+def assets_partition(env):
+    """(offset, size) of the assets partition of the env, None if it has none"""
+    name = env.GetProjectOption("board_build.partitions", "")
+    path = os.path.join(PROJECT_DIR, name) if name else ""
+    if not os.path.isfile(path):
+        return None
+
+    def number(value):
+        value = value.strip().upper()
+        scale = {"K": 1024, "M": 1024 * 1024}.get(value[-1:], 1)
+        return int(value.rstrip("KM"), 0) * scale
+
+    with open(path) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#")[0].split(",")]
+            if len(cols) >= 5 and cols[0] == "assets":
+                return number(cols[3]), number(cols[4])
+    return None
+
+
+def add_upload_target(env, assets_path, offset):
+    """pio run -t uploadassets: flash assets.bin without the app"""
+    platform = env.PioPlatform()
+    if env.subst("$UPLOAD_PROTOCOL") == "espota":
+        # sent as a filesystem update, which goes to the first spiffs partition
+        espota = os.path.join(platform.get_package_dir("framework-arduinoespressif32"), "tools", "espota.py")
+        cmd = '"$PYTHONEXE" "%s" -i $UPLOAD_PORT -s -f "%s"' % (espota, assets_path)
+    else:
+        esptool = os.path.join(platform.get_package_dir("tool-esptoolpy"), "esptool.py")
+        cmd = '"$PYTHONEXE" "%s" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED write_flash 0x%x "%s"' % (
+            esptool, offset, assets_path)
+    env.AddCustomTarget(name="uploadassets", dependencies=None, actions=[cmd],
+                        title="Upload assets", description="Flash the channel pics to the assets partition")
+
+
+def pio_main(env):
+    config = env.GetProjectConfig()
+
+    def option(name, default):
+        if config.has_section("pics") and config.has_option("pics", name):
+            return config.get("pics", name)
+        return default
+
+    manifest = os.path.join(PROJECT_DIR, option("manifest", "assets/pics.csv"))
+    out_dir = os.path.join(env.subst("$BUILD_DIR"), "generated")
+    out_path = os.path.join(out_dir, "pics.h")
+    assets_path = os.path.join(env.subst("$PROJECT_DATA_DIR"), "assets.bin")
+    env.Append(CPPPATH=[out_dir])
+    partition = assets_partition(env)
+    if partition:
+        add_upload_target(env, assets_path, partition[0])
+
+    # only rebuild when an input changed
+    entries = read_manifest(manifest)
+    inputs = [manifest, os.path.join(PROJECT_DIR, "platformio.ini"),
+              os.path.join(PROJECT_DIR, "scripts", "pics_build.py"),
+              os.path.join(PROJECT_DIR, "scripts", "pic_codec.py"),
+              os.path.join(PROJECT_DIR, "scripts", "pic_palette.py")]
+    inputs += [image for _, _, image in entries]
+    outputs = [out_path, assets_path]
+    if all(os.path.exists(p) for p in outputs) and \
+            min(os.path.getmtime(p) for p in outputs) >= max(os.path.getmtime(p) for p in inputs):
+        return
+    palette = parse_bool(option("palette", "no"))
+    length = build(manifest, out_path, int(option("size", 64)), parse_bool(option("dither", "no")), True,
+                   assets_path, palette)
+    if partition and length > partition[1]:
+        os.remove(assets_path)
+        hint = "list fewer channels in %s" % os.path.relpath(manifest, PROJECT_DIR)
+        if not palette:
+            hint = "set palette = yes in the [pics] section of platformio.ini or " + hint
+        sys.exit("%s: %d bytes do not fit the %d byte assets partition, %s" % (
+            assets_path, length, partition[1], hint))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build pics.h from the channel pics in a manifest")
+    parser.add_argument("--manifest", default=os.path.join(PROJECT_DIR, "assets", "pics.csv"))
+    parser.add_argument("--out", default=".", help="directory to write pics.h to")
+    parser.add_argument("--assets", help="file to write the image of the assets partition to")
+    parser.add_argument("--size", type=int, default=64)
+    parser.add_argument("--dither", action="store_true", help="Floyd-Steinberg dither to RGB565")
+    parser.add_argument("--raw", action="store_true", help="RGB565 in wire order in pics.h instead of packed")
+    parser.add_argument("--palette", action="store_true", help="store the pics in assets.bin with a palette")
+    parser.add_argument("--report", action="store_true", help="print size and quality of every format")
+    parser.add_argument("--export", nargs="+", metavar="IMAGE", help="write the images as pic sized PNGs and exit")
+    args = parser.parse_args()
+    if args.export:
+        for image in args.export:
+            export_png(image, args.size)
+        return
+    build(args.manifest, os.path.join(args.out, "pics.h"), args.size, args.dither, not args.raw, args.assets,
+          args.palette, args.report)
+
+
+if env is not None:
+    pio_main(env)
+elif __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Build and run the host check programs of the native_* envs.
+
+    python3 scripts/sim_checks.py [ENV...]
+
+Without envs it runs all of them. The ones that talk to helix or EventSub
+each get a fresh sim/helix_standin.py, as the checks change its settings.
+Prints the [Sim] lines of every program and exits with 1 if one of them
+failed to build or had a failed check (see sim/SimCheck.h). PlatformIO is
+run as $PIO, pio by default.
+"""
+
+import os
+import socket
+import subprocess
+import sys
+import time
+
+PROJECT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+STANDIN_PORT = 8089
+
+# env, whether it needs the stand-in
+ENVS = [
+    ("native_avatarFetch", True),
+    ("native_streamsParse", False),
+    ("native_helixPoll", True),
+    ("native_livePoll", True),
+    ("native_pollSchedule", False),
+    ("native_eventSub", True),
+]
+
+
+def wait_for_port(port, timeout):
+    end = time.time() + timeout
+    while time.time() < end:
+        try:
+            socket.create_connection(("127.0.0.1", port), 0.2).close()
+            return True
+        except OSError:
+            time.sleep(0.1)
+    return False
+
+
+def run_env(pio, env, standin):
+    if subprocess.call([pio, "run", "-s", "-e", env], cwd=PROJECT_DIR) != 0:
+        print("%s: build failed" % env)
+        return False
+    server = None
+    if standin:
+        # a stand-in left running has the settings of an earlier run
+        if wait_for_port(STANDIN_PORT, 0.1):
+            print("%s: port %d is taken, stop the stand-in that is running" % (env, STANDIN_PORT))
+            return False
+        server = subprocess.Popen([sys.executable, os.path.join("sim", "helix_standin.py"), "--port", str(STANDIN_PORT)],
+                                  cwd=PROJECT_DIR, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        if not wait_for_port(STANDIN_PORT, 10):
+            server.kill()
+            print("%s: sim/helix_standin.py did not start" % env)
+            return False
+    try:
+        program = os.path.join(PROJECT_DIR, ".pio", "build", env, "program")
+        result = subprocess.run([program], cwd=PROJECT_DIR, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                universal_newlines=True)
+    finally:
+        if server:
+            server.terminate()
+            server.wait()
+    for line in result.stdout.splitlines():
+        if line.startswith("[Sim]"):
+            print("%s: %s" % (env, line))
+    print("%s: %s" % (env, "passed" if result.returncode == 0 else "FAILED"))
+    return result.returncode == 0
+
+
+def main():
+    pio = os.environ.get("PIO", "pio")
+    known = dict(ENVS)
+    envs = sys.argv[1:] or [env for env, _ in ENVS]
+    for env in envs:
+        if env not in known:
+            sys.exit("%s: not a check env, one of %s" % (env, ", ".join(known)))
+    failed = [env for env in envs if not run_env(pio, env, known[env])]
+    print("%d of %d envs failed%s" % (len(failed), len(envs), (": " + ", ".join(failed)) if failed else ""))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#ifndef SIM_ADAFRUIT_GFX_H
+#define SIM_ADAFRUIT_GFX_H
+
+// Host-side stand-in for the parts of Adafruit GFX used by the twitchDisplay
+// renderer. Drawing semantics follow the real library; the built-in font is a
+// deterministic placeholder with the classic 6x8 cell metrics, so text layout
+// and transfer sizes match the device even though the glyph shapes do not.
+
+#include "Arduino.h"
+
+class Adafruit_GFX : public Print {
+  public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void startWrite(){}
+    virtual void endWrite(){}
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color){ drawPixel(x, y, color); }
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+      for(int16_t i = x; i < x+w; i++)
+        for(int16_t j = y; j < y+h; j++)
+          writePixel(i, j, color);
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+      startWrite();
+      writeFillRect(x, y, w, h, color);
+      endWrite();
+    }
+    virtual void fillScreen(uint16_t color){ fillRect(0, 0, _width, _height, color); }
+
+    virtual void setRotation(uint8_t r){
+      rotation = r & 3;
+      _width = (rotation & 1) ? HEIGHT : WIDTH;
+      _height = (rotation & 1) ? WIDTH : HEIGHT;
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h){
+      startWrite();
+      for(int16_t j = 0; j < h; j++, y++)
+        for(int16_t i = 0; i < w; i++)
+          writePixel(x+i, y, pgm_read_word(&bitmap[j*w+i]));
+      endWrite();
+    }
+    virtual void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h){
+      drawRGBBitmap(x, y, (const uint16_t*)bitmap, w, h);
+    }
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size){
+      drawChar(x, y, c, color, bg, size, size);
+    }
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y){
+      if((x >= _width) || (y >= _height) || ((x + 6*size_x - 1) < 0) || ((y + 8*size_y - 1) < 0))
+        return;
+      startWrite();
+      for(int8_t i = 0; i < 5; i++){
+        uint8_t line = glyphColumn(c, i);
+        for(int8_t j = 0; j < 8; j++, line >>= 1){
+          if(line & 1){
+            if(size_x == 1 && size_y == 1) writePixel(x+i, y+j, color);
+            else writeFillRect(x+i*size_x, y+j*size_y, size_x, size_y, color);
+          } else if(bg != color){
+            if(size_x == 1 && size_y == 1) writePixel(x+i, y+j, bg);
+            else writeFillRect(x+i*size_x, y+j*size_y, size_x, size_y, bg);
+          }
+        }
+      }
+      if(bg != color){
+        if(size_x == 1 && size_y == 1) writeFastVLine(x+5, y, 8, bg);
+        else writeFillRect(x+5*size_x, y, size_x, 8*size_y, bg);
+      }
+      endWrite();
+    }
+
+    size_t write(uint8_t c) override {
+      if(c == '\n'){
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      } else if(c != '\r'){
+        if(wrap && ((cursor_x + textsize_x * 6) > _width)){
+          cursor_x = 0;
+          cursor_y += textsize_y * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        cursor_x += textsize_x * 6;
+      }
+      return 1;
+    }
+    using Print::write;
+
+    void setCursor(int16_t x, int16_t y){ cursor_x = x; cursor_y = y; }
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+    void setTextSize(uint8_t s){ textsize_x = textsize_y = (s > 0) ? s : 1; }
+    void setTextColor(uint16_t c){ textcolor = textbgcolor = c; }
+    void setTextColor(uint16_t c, uint16_t bg){ textcolor = c; textbgcolor = bg; }
+    void setTextWrap(bool w){ wrap = w; }
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    uint8_t getRotation() const { return rotation; }
+
+  protected:
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){ writeFillRect(x, y, 1, h, color); }
+
+    // Placeholder for glcdfont: 5 columns of 7 set-able rows, blank for space.
+    static uint8_t glyphColumn(unsigned char c, int8_t col){
+      if(c <= ' ') return 0;
+      uint32_t h = (uint32_t)c * 0x9E3779B1u;
+      return ((h >> (col*5)) & 0x7F) | 0x01;
+    }
+
+    int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+    uint8_t textsize_x = 1, textsize_y = 1;
+    uint8_t rotation = 0;
+    bool wrap = true;
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+  public:
+    GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h), buffer(new uint16_t[(size_t)w*h]()) {}
+    ~GFXcanvas16(){ delete[] buffer; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+      buffer[x + y * WIDTH] = color;
+    }
+    void fillScreen(uint16_t color) override { std::fill(buffer, buffer + (size_t)WIDTH*HEIGHT, color); }
+    uint16_t getPixel(int16_t x, int16_t y) const { return buffer[x + y * WIDTH]; }
+    uint16_t* getBuffer() const { return buffer; }
+
+  private:
+    uint16_t* buffer;
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+  public:
+    GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h), buffer(new uint8_t[(size_t)((w+7)/8)*h]()) {}
+    ~GFXcanvas1(){ delete[] buffer; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+      uint8_t* ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+      if(color) *ptr |= 0x80 >> (x & 7);
+      else *ptr &= ~(0x80 >> (x & 7));
+    }
+    void fillScreen(uint16_t color) override { std::fill(buffer, buffer + (size_t)((WIDTH+7)/8)*HEIGHT, color ? 0xFF : 0x00); }
+    bool getPixel(int16_t x, int16_t y) const {
+      if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return false;
+      return buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+    }
+    uint8_t* getBuffer() const { return buffer; }
+
+  private:
+    uint8_t* buffer;
+};
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef SIM_ADAFRUIT_ST7789_H
+#define SIM_ADAFRUIT_ST7789_H
+
+// Host-side stand-in for Adafruit_ST7789 that simulates the panel instead of
+// talking to it. Everything that would go over SPI is decoded byte by byte
+// like the controller would (CASET/RASET/MADCTL/RAMWR) into an in-memory
+// RGB565 framebuffer, and every command, address window and pixel byte is
+// counted so that rendering cost can be measured without a board.
+//
+// Only the landscape orientation used by twitchDisplay (rotation 1) is
+// modelled: with MADCTL_MV set the column address is x and memory is filled
+// row by row; with MADCTL_MV cleared the column address is y and memory is
+// filled column by column. Like on the real panel, the short axis is centred
+// in the 240 pixel wide controller memory, so y is offset by _colstart.
+
+#include "Adafruit_GFX.h"
+#include <vector>
+
+#define ST77XX_NOP 0x00
+#define ST77XX_SWRESET 0x01
+#define ST77XX_SLPOUT 0x11
+#define ST77XX_NORON 0x13
+#define ST77XX_INVON 0x21
+#define ST77XX_DISPON 0x29
+#define ST77XX_CASET 0x2A
+#define ST77XX_RASET 0x2B
+#define ST77XX_RAMWR 0x2C
+#define ST77XX_MADCTL 0x36
+#define ST77XX_COLMOD 0x3A
+
+#define ST77XX_MADCTL_MY 0x80
+#define ST77XX_MADCTL_MX 0x40
+#define ST77XX_MADCTL_MV 0x20
+#define ST77XX_MADCTL_ML 0x10
+#define ST77XX_MADCTL_RGB 0x00
+
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+#define ST77XX_RED 0xF800
+#define ST77XX_GREEN 0x07E0
+#define ST77XX_BLUE 0x001F
+#define ST77XX_CYAN 0x07FF
+#define ST77XX_MAGENTA 0xF81F
+#define ST77XX_YELLOW 0xFFE0
+#define ST77XX_ORANGE 0xFC00
+
+struct SimSpiStats {
+  uint32_t transactions = 0; // startWrite()/endWrite() pairs
+  uint32_t commands = 0;     // bytes sent with DC low
+  uint32_t addrWindows = 0;  // RAMWR preceded by a CASET and/or RASET
+  uint64_t paramBytes = 0;   // command parameter bytes
+  uint64_t pixelBytes = 0;   // RAMWR payload bytes
+
+  uint64_t totalBytes() const { return commands + paramBytes + pixelBytes; }
+};
+
+class Adafruit_ST7789 : public Adafruit_GFX {
+  public:
+    Adafruit_ST7789(int8_t, int8_t, int8_t) : Adafruit_GFX(240, 320) {}
+
+    void init(uint16_t width, uint16_t height){
+      WIDTH = _width = width;
+      HEIGHT = _height = height;
+      fb.assign((size_t)width*height, 0);
+      _colstart = (240 - width) / 2;
+      _rowstart = (320 - height) / 2;
+      startWrite();
+      writeCommand(ST77XX_SWRESET);
+      writeCommand(ST77XX_SLPOUT);
+      uint8_t colmod = 0x55;
+      sendCommand(ST77XX_COLMOD, &colmod, 1);
+      writeCommand(ST77XX_NORON);
+      writeCommand(ST77XX_INVON);
+      writeCommand(ST77XX_DISPON);
+      endWrite();
+      setRotation(0);
+    }
+
+    void setRotation(uint8_t m) override {
+      Adafruit_GFX::setRotation(m);
+      static const uint8_t madctl[4] = {
+        ST77XX_MADCTL_MX | ST77XX_MADCTL_MY | ST77XX_MADCTL_RGB,
+        ST77XX_MADCTL_MY | ST77XX_MADCTL_MV | ST77XX_MADCTL_RGB,
+        ST77XX_MADCTL_RGB,
+        ST77XX_MADCTL_MX | ST77XX_MADCTL_MV | ST77XX_MADCTL_RGB
+      };
+      sendCommand(ST77XX_MADCTL, &madctl[rotation], 1);
+      _xstart = (rotation & 1) ? _rowstart : _colstart;
+      _ystart = (rotation & 1) ? _colstart : _rowstart;
+    }
+
+    void setSPISpeed(uint32_t freq){ spiFreq = freq; }
+    uint32_t getSPISpeed() const { return spiFreq; }
+
+    void startWrite() override { if(!inTransaction++) stats.transactions++; }
+    void endWrite() override { if(inTransaction) inTransaction--; }
+
+    void writeCommand(uint8_t cmd){
+      stats.commands++;
+      if(cmd == ST77XX_RAMWR){
+        if(windowDirty) stats.addrWindows++;
+        windowDirty = false;
+        ptr = 0;
+        pending = -1;
+      }
+      curCmd = cmd;
+      paramIdx = 0;
+    }
+
+    void sendCommand(uint8_t cmd, const uint8_t* data, uint8_t len){
+      startWrite();
+      writeCommand(cmd);
+      for(uint8_t i = 0; i < len; i++) spiWrite(data[i]);
+      endWrite();
+    }
+
+    void spiWrite(uint8_t b){
+      if(curCmd == ST77XX_RAMWR){
+        stats.pixelBytes++;
+        if(pending < 0){
+          pending = b;
+        } else {
+          storePixel((uint16_t)((pending << 8) | b));
+          pending = -1;
+        }
+        return;
+      }
+      stats.paramBytes++;
+      switch(curCmd){
+        case ST77XX_CASET:
+        case ST77XX_RASET:
+          if(paramIdx < 4) addr[curCmd == ST77XX_RASET][paramIdx] = b;
+          windowDirty = true;
+          break;
+        case ST77XX_MADCTL:
+          madctl = b;
+          break;
+      }
+      paramIdx++;
+    }
+    void SPI_WRITE16(uint16_t w){ spiWrite(w >> 8); spiWrite(w); }
+    void SPI_WRITE32(uint32_t l){ spiWrite(l >> 24); spiWrite(l >> 16); spiWrite(l >> 8); spiWrite(l); }
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h){
+      x += _xstart;
+      y += _ystart;
+      uint32_t xa = ((uint32_t)x << 16) | (x+w-1);
+      uint32_t ya = ((uint32_t)y << 16) | (y+h-1);
+      writeCommand(ST77XX_CASET);
+      SPI_WRITE32(xa);
+      writeCommand(ST77XX_RASET);
+      SPI_WRITE32(ya);
+      writeCommand(ST77XX_RAMWR);
+    }
+
+    void writePixels(uint16_t* colors, uint32_t len, bool /*block*/ = true, bool bigEndian = false){
+      if(bigEndian){
+        const uint8_t* bytes = (const uint8_t*)colors;
+        for(uint32_t i = 0; i < len*2; i++) spiWrite(bytes[i]);
+      } else {
+        while(len--) SPI_WRITE16(*colors++);
+      }
+    }
+    void writeColor(uint16_t color, uint32_t len){ while(len--) SPI_WRITE16(color); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
+      startWrite();
+      writePixel(x, y, color);
+      endWrite();
+    }
+    void writePixel(int16_t x, int16_t y, uint16_t color) override {
+      if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
+      setAddrWindow(x, y, 1, 1);
+      SPI_WRITE16(color);
+    }
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+      if(w < 0){ x += w + 1; w = -w; }
+      if(h < 0){ y += h + 1; h = -h; }
+      int16_t x2 = std::min<int16_t>(x + w - 1, _width - 1), y2 = std::min<int16_t>(y + h - 1, _height - 1);
+      x = std::max<int16_t>(x, 0); y = std::max<int16_t>(y, 0);
+      if((x > x2) || (y > y2)) return;
+      setAddrWindow(x, y, x2 - x + 1, y2 - y + 1);
+      writeColor(color, (uint32_t)(x2 - x + 1) * (y2 - y + 1));
+    }
+    using Adafruit_GFX::drawRGBBitmap;
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int16_t w, int16_t h) override {
+      int16_t x2, y2;
+      if((x >= _width) || (y >= _height) || ((x2 = (x + w - 1)) < 0) || ((y2 = (y + h - 1)) < 0)) return;
+      int16_t bx1 = 0, by1 = 0, saveW = w;
+      if(x < 0){ w += x; bx1 = -x; x = 0; }
+      if(y < 0){ h += y; by1 = -y; y = 0; }
+      if(x2 >= _width) w = _width - x;
+      if(y2 >= _height) h = _height - y;
+      pcolors += by1 * saveW + bx1;
+      startWrite();
+      setAddrWindow(x, y, w, h);
+      while(h--){
+        writePixels(pcolors, w);
+        pcolors += saveW;
+      }
+      endWrite();
+    }
+
+    static uint16_t color565(uint8_t r, uint8_t g, uint8_t b){
+      return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    // Simulation access
+    const SimSpiStats& simStats() const { return stats; }
+    void resetSimStats(){ stats = SimSpiStats(); }
+    uint16_t simPixel(int16_t x, int16_t y) const { return fb[(size_t)y*_width + x]; }
+    // Time the transferred bytes would have occupied the bus at the set SPI speed.
+    uint64_t simBusMicros() const { return stats.totalBytes() * 8 * 1000000ull / spiFreq; }
+
+    bool simSavePPM(const char* path) const {
+      FILE* f = fopen(path, "wb");
+      if(!f) return false;
+      fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+      for(uint16_t c : fb){
+        uint8_t rgb[3] = {(uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3)};
+        fwrite(rgb, 1, 3, f);
+      }
+      fclose(f);
+      return true;
+    }
+
+  private:
+    void storePixel(uint16_t color){
+      uint16_t c0 = (addr[0][0] << 8) | addr[0][1], c1 = (addr[0][2] << 8) | addr[0][3];
+      uint16_t r0 = (addr[1][0] << 8) | addr[1][1], r1 = (addr[1][2] << 8) | addr[1][3];
+      uint32_t cols = c1 - c0 + 1, rows = r1 - r0 + 1;
+      uint32_t i = ptr++ % (cols * rows);
+      int32_t x, y;
+      if(madctl & ST77XX_MADCTL_MV){
+        x = c0 + i % cols - _rowstart; y = r0 + i / cols - _colstart;
+      } else {
+        y = c0 + i % cols - _colstart; x = r0 + i / cols - _rowstart;
+      }
+      if((x >= 0) && (y >= 0) && (x < _width) && (y < _height)) fb[(size_t)y*_width + x] = color;
+    }
+
+    uint8_t _colstart = 0, _rowstart = 0, _xstart = 0, _ystart = 0;
+    std::vector<uint16_t> fb;
+    SimSpiStats stats;
+    uint32_t spiFreq = 32000000;
+    uint32_t inTransaction = 0;
+    uint8_t curCmd = ST77XX_NOP;
+    uint8_t paramIdx = 0;
+    uint8_t addr[2][4] = {};
+    uint8_t madctl = 0;
+    bool windowDirty = false;
+    uint32_t ptr = 0;
+    int16_t pending = -1;
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Minimal host-side stand-in for the Arduino core, just enough to build the
+// drawing code of twitchDisplay.cpp natively (see [env:native]).
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <strings.h>
+
+#define PROGMEM
+#define F(s) (s)
+#define PGM_P const char*
+#define strcmp_P strcmp
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define A3 3
+
+// Time spent in delay() is skipped rather than slept, so simulated runs
+// that are paced by the clock do not take as long as on the device.
+inline unsigned long simSkippedMicros = 0;
+inline unsigned long micros(){
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() + simSkippedMicros;
+}
+inline unsigned long millis(){ return micros()/1000; }
+inline void delay(unsigned long ms){ simSkippedMicros += ms*1000; }
+inline void delayMicroseconds(unsigned int us){ simSkippedMicros += us; }
+
+inline void pinMode(uint8_t, uint8_t){}
+inline void digitalWrite(uint8_t, uint8_t){}
+inline void analogWrite(uint8_t, int){}
+inline uint16_t analogRead(uint8_t){ return 2048; }
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max){
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+inline void randomSeed(unsigned long seed){ srand(seed); }
+inline long random(long howbig){ return howbig > 0 ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig){ return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall; }
+
+// Arduino's String, only what the shared code uses
+class String : public std::string {
+  public:
+    String() = default;
+    String(const char* s) : std::string(s ? s : "") {}
+    String(const std::string& s) : std::string(s) {}
+    explicit String(int v) : std::string(std::to_string(v)) {}
+
+    void replace(const String& from, const String& to){
+      if (from.empty()) return;
+      for (size_t pos = 0; (pos = find(from, pos)) != npos; pos += to.size()) {
+        std::string::replace(pos, from.size(), to);
+      }
+    }
+    bool startsWith(const String& prefix) const { return compare(0, prefix.size(), prefix) == 0; }
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t pos = find(c, from);
+      return pos == npos ? -1 : (int)pos;
+    }
+    String substring(unsigned int from) const { return from < size() ? String(substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+      return from < to && from < size() ? String(substr(from, to - from)) : String();
+    }
+    long toInt() const { return atol(c_str()); }
+    bool equalsIgnoreCase(const String& other) const {
+      return size() == other.size() && strncasecmp(c_str(), other.c_str(), size()) == 0;
+    }
+};
+
+class Print {
+  public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size){
+      size_t n = 0;
+      while(size--) n += write(*buffer++);
+      return n;
+    }
+    size_t write(const char* str){ return write((const uint8_t*)str, strlen(str)); }
+
+    size_t print(const char* str){ return write(str); }
+    size_t print(const std::string& str){ return write(str.c_str()); }
+    size_t print(char c){ return write((uint8_t)c); }
+    size_t print(long n){ return printf("%ld", n); }
+    size_t print(int n){ return print((long)n); }
+    size_t print(unsigned long n){ return printf("%lu", n); }
+    size_t print(unsigned int n){ return print((unsigned long)n); }
+    size_t print(double n){ return printf("%.2f", n); }
+    template<typename T> size_t println(T v){ size_t n = print(v); return n + write("\n"); }
+    size_t println(){ return write("\n"); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))){
+      char buf[256];
+      va_list args;
+      va_start(args, format);
+      int len = vsnprintf(buf, sizeof(buf), format, args);
+      va_end(args);
+      if(len < 0) return 0;
+      return write((const uint8_t*)buf, std::min<size_t>(len, sizeof(buf)-1));
+    }
+};
+
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long){}
+    void flush(){ fflush(stdout); }
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+};
+
+inline HardwareSerial Serial;
+
+#endif
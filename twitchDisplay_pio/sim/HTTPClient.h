@@ -0,0 +1,174 @@
+#ifndef SIM_HTTP_CLIENT_H
+#define SIM_HTTP_CLIENT_H
+
+// Host-side stand-in for the ESP32 HTTPClient, plain http only. Enough to
+// run the helix and download code against a local server such as
+// sim/helix_standin.py. Like the real one it keeps the connection of a
+// client passed to begin() open between requests when asked to with
+// setReuse() and HTTP/1.1 and the server agrees. Every request is counted
+// in simHttpRequests, every new connection in simHttpConnects.
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#include <vector>
+
+#define HTTP_CODE_OK 200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+inline uint32_t simHttpRequests = 0;
+inline uint32_t simHttpConnects = 0;
+
+class HTTPClient {
+  public:
+    ~HTTPClient(){ if (client) client->stop(); }
+
+    // Only http://host[:port]/path
+    bool begin(const String& url){
+      end();
+      client = &ownClient;
+      return parse(url);
+    }
+
+    // https URLs are taken as http
+    bool begin(WiFiClient& c, const String& url){
+      if (client != &c) end();
+      client = &c;
+      return parse(url.startsWith("https://") ? String("http://" + url.substr(8)) : url);
+    }
+
+    void end(){
+      if (client && !(reuse && canReuse)) client->stop();
+      canReuse = false;
+      size = -1;
+    }
+
+    void useHTTP10(bool http10){ useHttp10 = http10; }
+    void setReuse(bool keep){ reuse = keep; }
+    void setAuthorizationType(const char* type){ authType = type; }
+    void setAuthorization(const char* token){ addHeader("Authorization", authType + " " + token); }
+    void addHeader(const String& name, const String& value){ headers.push_back(name + ": " + value); }
+
+    void collectHeaders(const char* keys[], size_t count){
+      collected.clear();
+      for (size_t i = 0; i < count; i++) collected.push_back({keys[i], ""});
+    }
+
+    String header(const char* name){
+      for (auto& h : collected) {
+        if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+      }
+      return String();
+    }
+
+    bool connected(){ return client && client->connected(); }
+
+    int GET(){ return sendRequest("GET", ""); }
+    int POST(const String& payload){ return sendRequest("POST", payload); }
+
+    int getSize() const { return size; }
+    WiFiClient& getStream(){ return *client; }
+    WiFiClient* getStreamPtr(){ return client; }
+
+    static String errorToString(int error){
+      switch (error) {
+        case HTTPC_ERROR_CONNECTION_REFUSED: return "connection refused";
+        case HTTPC_ERROR_SEND_HEADER_FAILED: return "send header failed";
+        case HTTPC_ERROR_NOT_CONNECTED: return "not connected";
+        case HTTPC_ERROR_CONNECTION_LOST: return "connection lost";
+        case HTTPC_ERROR_READ_TIMEOUT: return "read Timeout";
+        default: return String();
+      }
+    }
+
+  private:
+    int sendRequest(const char* method, const std::string& body){
+      simHttpRequests++;
+      if (!valid) return HTTPC_ERROR_NOT_CONNECTED;
+      if (!connected() || connectedTo != host + ":" + port) {
+        if (!client->connect(host.c_str(), atoi(port.c_str()))) return HTTPC_ERROR_CONNECTION_REFUSED;
+        connectedTo = host + ":" + port;
+        simHttpConnects++;
+      }
+      canReuse = reuse && !useHttp10;
+      for (auto& h : collected) h.second.clear();
+
+      std::string request = method + (" " + path) + (useHttp10 ? " HTTP/1.0" : " HTTP/1.1") + "\r\nHost: " + host
+        + (port == "80" ? "" : ":" + port) + "\r\nConnection: " + (canReuse ? "keep-alive" : "close") + "\r\n";
+      for (const std::string& h : headers) request += h + "\r\n";
+      if (strcmp(method, "GET") != 0) request += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+      request += "\r\n" + body;
+      if (client->write((const uint8_t*)request.data(), request.size()) != request.size()) {
+        canReuse = false;
+        end();
+        return HTTPC_ERROR_SEND_HEADER_FAILED;
+      }
+
+      // status line and headers, up to the empty line
+      std::string line;
+      int code = 0;
+      bool first = true;
+      for (;;) {
+        int c = client->read();
+        if (c < 0) {
+          canReuse = false;
+          end();
+          return first && line.empty() ? HTTPC_ERROR_CONNECTION_LOST : HTTPC_ERROR_READ_TIMEOUT;
+        }
+        if (c != '\n') {
+          if (c != '\r') line += (char)c;
+          continue;
+        }
+        if (line.empty()) break;
+        if (first) {
+          size_t sp = line.find(' ');
+          code = sp == std::string::npos ? 0 : atoi(line.c_str() + sp + 1);
+          if (line.compare(0, 8, "HTTP/1.0") == 0) canReuse = false;
+          first = false;
+        } else {
+          size_t colon = line.find(':');
+          std::string name = line.substr(0, colon);
+          std::string value = colon == std::string::npos ? "" : line.substr(line.find_first_not_of(' ', colon + 1));
+          if (strcasecmp(name.c_str(), "Content-Length") == 0) size = atoi(value.c_str());
+          if (strcasecmp(name.c_str(), "Connection") == 0 && strcasestr(value.c_str(), "close")) canReuse = false;
+          for (auto& h : collected) {
+            if (strcasecmp(h.first.c_str(), name.c_str()) == 0) h.second = value;
+          }
+        }
+        line.clear();
+      }
+      return code;
+    }
+
+    bool parse(const String& url){
+      headers.clear();
+      valid = false;
+      if (!url.startsWith("http://")) return false;
+      std::string rest = url.substr(7);
+      size_t slash = rest.find('/');
+      std::string hostPort = rest.substr(0, slash);
+      path = slash == std::string::npos ? "/" : rest.substr(slash);
+      size_t colon = hostPort.find(':');
+      host = hostPort.substr(0, colon);
+      port = colon == std::string::npos ? "80" : hostPort.substr(colon + 1);
+      valid = true;
+      return true;
+    }
+
+    WiFiClient ownClient;
+    WiFiClient* client = nullptr;
+    std::string connectedTo;
+    bool valid = false;
+    bool reuse = true, useHttp10 = false, canReuse = false;
+    std::string host, port, path;
+    String authType = "Basic";
+    std::vector<std::string> headers;
+    std::vector<std::pair<std::string, std::string>> collected;
+    int size = -1;
+};
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef SIM_SPI_H
+#define SIM_SPI_H
+
+// Host-side stand-in for the Arduino SPI library. The simulated
+// Adafruit_ST7789 never touches a real bus, so nothing is needed here.
+
+#include "Arduino.h"
+
+#endif
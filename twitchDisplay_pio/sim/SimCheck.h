@@ -0,0 +1,60 @@
+#ifndef SIM_CHECK_H
+#define SIM_CHECK_H
+
+// What the host check programs of the native_* envs share. check() prints
+// one result and counts the failures, main() ends with
+// `return checksDone();`. The simulated panel is on the firmware's pins,
+// helix requests carry what sim/helix_standin.py takes and standin() changes
+// its settings. scripts/sim_checks.py builds and runs them all.
+
+#include <Arduino.h>
+#include <Adafruit_ST7789.h>
+#include <HTTPClient.h>
+#include <string>
+
+#include "Debug.h"
+
+#define TFT_CS         7
+#define TFT_RST       10
+#define TFT_DC         1
+
+Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
+
+static int failures = 0;
+
+inline void check(bool ok, const char* what){
+  S.printf("[Sim] %-58s %s\n", what, ok ? "ok" : "FAILED");
+  if(!ok) failures++;
+}
+
+// For checks that run once per fixture or case
+inline void check(bool ok, const char* group, const char* what){
+  S.printf("[Sim] %-7s %-60s %s\n", group, what, ok ? "ok" : "FAILED");
+  if(!ok) failures++;
+}
+
+// Prints the number of failed checks, the exit code of the program
+inline int checksDone(){
+  S.printf("[Sim] %d checks failed\n", failures);
+  return failures ? 1 : 0;
+}
+
+void commonHttpInit(HTTPClient& http_client){
+  http_client.setAuthorizationType("Bearer");
+  http_client.setAuthorization("standin");
+  http_client.addHeader("Client-Id", "standin");
+}
+
+#ifdef HELIX_URL
+// Where the stand-in takes its settings, next to HELIX_URL
+#define STANDIN_URL HELIX_URL "../standin/"
+
+// Asks the stand-in for what, e.g. "delay?ms=300", false without an answer
+inline bool standin(const std::string& what){
+  HTTPClient http;
+  http.begin(String(STANDIN_URL) + what.c_str());
+  return http.GET() == HTTP_CODE_OK;
+}
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef SIM_WEB_SOCKETS_CLIENT_H
+#define SIM_WEB_SOCKETS_CLIENT_H
+
+// Host-side stand-in for WebSocketsClient of links2004/WebSockets, plain ws
+// only (beginSSL() connects without TLS), enough to run EventSub.h against
+// sim/helix_standin.py. Like the library, loop() never waits for the server
+// once connected, answers pings, and reconnects to the begin() URL after the
+// reconnect interval when the connection is gone. Frames come whole and
+// unfragmented from the stand-in, so there are no WStype_FRAGMENT events,
+// and Sec-WebSocket-Accept is not checked.
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#include <functional>
+
+typedef enum {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG,
+} WStype_t;
+
+class WebSocketsClient {
+  public:
+    typedef std::function<void(WStype_t type, uint8_t* payload, size_t length)> WebSocketClientEvent;
+
+    ~WebSocketsClient(){ client.stop(); }
+
+    void begin(const char* host, uint16_t port, const char* url = "/", const char* /*protocol*/ = "arduino"){
+      disconnect();
+      this->host = host;
+      this->port = port;
+      this->url = url;
+      lastAttempt = 0;
+      attempted = false;
+    }
+    void begin(const String& host, uint16_t port, const String& url = "/"){ begin(host.c_str(), port, url.c_str()); }
+
+    void beginSSL(const char* host, uint16_t port, const char* url = "/", const char* /*fingerprint*/ = "", const char* protocol = "arduino"){
+      begin(host, port, url, protocol);
+    }
+
+    void onEvent(WebSocketClientEvent cbEvent){ event = cbEvent; }
+    void setReconnectInterval(unsigned long time){ reconnectInterval = time; }
+
+    void loop(){
+      if (!port) return;
+      if (!connected) {
+        if (attempted && millis() - lastAttempt < reconnectInterval) return;
+        attempted = true;
+        lastAttempt = millis();
+        if (!handshake()) {
+          client.stop();
+          emit(WStype_DISCONNECTED, nullptr, 0);
+          return;
+        }
+        connected = true;
+        received.clear();
+        emit(WStype_CONNECTED, (uint8_t*)url.c_str(), url.size());
+      }
+      int n = client.available();
+      if (n > 0) {
+        size_t had = received.size();
+        received.resize(had + n);
+        received.resize(had + client.readBytes((uint8_t*)&received[had], n));
+      } else if (!client.connected()) {
+        drop();
+        return;
+      }
+      while (connected && readFrame()) {}
+    }
+
+    bool sendTXT(const char* payload, size_t length = 0){
+      return sendFrame(0x1, (const uint8_t*)payload, length ? length : strlen(payload));
+    }
+    bool sendTXT(const String& payload){ return sendTXT(payload.c_str(), payload.size()); }
+
+    void disconnect(){
+      if (!connected) return;
+      uint8_t normal[] = {0x03, 0xE8};
+      sendFrame(0x8, normal, sizeof(normal));
+      drop();
+    }
+
+    bool isConnected() const { return connected; }
+
+  private:
+    void emit(WStype_t type, uint8_t* payload, size_t length){
+      if (event) event(type, payload, length);
+    }
+
+    void drop(){
+      client.stop();
+      connected = false;
+      emit(WStype_DISCONNECTED, nullptr, 0);
+    }
+
+    bool handshake(){
+      if (!client.connect(host.c_str(), port)) return false;
+      std::string request = "GET " + url + " HTTP/1.1\r\nHost: " + host + ":" + std::to_string(port)
+        + "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+        "Sec-WebSocket-Version: 13\r\n\r\n";
+      if (client.write((const uint8_t*)request.data(), request.size()) != request.size()) return false;
+      std::string line;
+      bool first = true, upgraded = false;
+      for (;;) {
+        int c = client.read();
+        if (c < 0) return false;
+        if (c != '\n') {
+          if (c != '\r') line += (char)c;
+          continue;
+        }
+        if (line.empty()) return upgraded;
+        if (first) upgraded = line.compare(0, 12, "HTTP/1.1 101") == 0;
+        first = false;
+        line.clear();
+      }
+    }
+
+    // Handles the first frame in received if it is whole
+    bool readFrame(){
+      if (received.size() < 2) return false;
+      const uint8_t* b = (const uint8_t*)received.data();
+      uint8_t opcode = b[0] & 0x0F;
+      uint64_t len = b[1] & 0x7F;
+      size_t head = 2;
+      if (len == 126) {
+        if (received.size() < 4) return false;
+        len = b[2] << 8 | b[3];
+        head = 4;
+      } else if (len == 127) {
+        if (received.size() < 10) return false;
+        len = 0;
+        for (int i = 2; i < 10; i++) len = len << 8 | b[i];
+        head = 10;
+      }
+      if (received.size() < head + len) return false;
+      std::string payload = received.substr(head, len);
+      received.erase(0, head + len);
+      switch (opcode) {
+        case 0x1:
+          emit(WStype_TEXT, (uint8_t*)&payload[0], len);
+          break;
+        case 0x2:
+          emit(WStype_BIN, (uint8_t*)&payload[0], len);
+          break;
+        case 0x8:
+          sendFrame(0x8, (const uint8_t*)payload.data(), std::min<size_t>(len, 2));
+          drop();
+          return false;
+        case 0x9:
+          emit(WStype_PING, (uint8_t*)&payload[0], len);
+          sendFrame(0xA, (const uint8_t*)payload.data(), len);
+          break;
+        case 0xA:
+          emit(WStype_PONG, (uint8_t*)&payload[0], len);
+          break;
+      }
+      return true;
+    }
+
+    // Client frames are masked, with a key of zeros here
+    bool sendFrame(uint8_t opcode, const uint8_t* payload, size_t length){
+      if (!connected) return false;
+      std::string frame(1, (char)(0x80 | opcode));
+      if (length < 126) {
+        frame += (char)(0x80 | length);
+      } else if (length < 65536) {
+        frame += (char)(0x80 | 126);
+        frame += (char)(length >> 8);
+        frame += (char)length;
+      } else {
+        frame += (char)(0x80 | 127);
+        for (int i = 7; i >= 0; i--) frame += (char)((uint64_t)length >> (8*i));
+      }
+      frame.append(4, '\0');
+      frame.append((const char*)payload, length);
+      return client.write((const uint8_t*)frame.data(), frame.size()) == frame.size();
+    }
+
+    WiFiClient client;
+    WebSocketClientEvent event;
+    std::string host, url;
+    uint16_t port = 0;
+    bool connected = false;
+    bool attempted = false;
+    unsigned long lastAttempt = 0;
+    unsigned long reconnectInterval = 500;
+    std::string received; // bytes of frames not handled yet
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef SIM_WIFI_CLIENT_H
+#define SIM_WIFI_CLIENT_H
+
+// Host-side stand-in for the WiFi library's TCP client: a blocking socket
+// with the read calls HTTPClient users and ArduinoJson's stream reader need,
+// and available() for the WebSocket stand-in that must not block.
+
+#include "Arduino.h"
+
+#include <netdb.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+class WiFiClient {
+  public:
+    // 1 once connected to host:port, 0 if that did not work
+    int connect(const char* host, uint16_t port){
+      addrinfo hints = {};
+      hints.ai_family = AF_UNSPEC;
+      hints.ai_socktype = SOCK_STREAM;
+      addrinfo* res;
+      if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &res) != 0) return 0;
+      int socketFd = -1;
+      for (addrinfo* a = res; a && socketFd < 0; a = a->ai_next) {
+        socketFd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (socketFd >= 0 && ::connect(socketFd, a->ai_addr, a->ai_addrlen) != 0) {
+          close(socketFd);
+          socketFd = -1;
+        }
+      }
+      freeaddrinfo(res);
+      attach(socketFd);
+      return fd >= 0;
+    }
+
+    void stop(){
+      if (fd >= 0) close(fd);
+      fd = -1;
+    }
+
+    // Like the ESP32 client, notices a connection the peer closed
+    bool connected(){
+      if (fd < 0) return false;
+      uint8_t b;
+      if (recv(fd, &b, 1, MSG_PEEK | MSG_DONTWAIT) == 0) stop();
+      return fd >= 0;
+    }
+
+    // Bytes that can be read without waiting
+    int available(){
+      int n = 0;
+      if (fd < 0 || ioctl(fd, FIONREAD, &n) != 0) return 0;
+      return n;
+    }
+
+    // Next byte, -1 once the peer closed the connection
+    int read(){
+      uint8_t b;
+      return readBytes(&b, 1) == 1 ? b : -1;
+    }
+
+    size_t readBytes(uint8_t* buf, size_t len){
+      size_t n = 0;
+      while (fd >= 0 && n < len) {
+        ssize_t r = recv(fd, buf + n, len - n, 0);
+        if (r <= 0) break;
+        n += r;
+      }
+      return n;
+    }
+    size_t readBytes(char* buf, size_t len){ return readBytes((uint8_t*)buf, len); }
+
+    size_t write(const uint8_t* buf, size_t len){
+      size_t n = 0;
+      while (fd >= 0 && n < len) {
+        ssize_t w = send(fd, buf + n, len - n, MSG_NOSIGNAL);
+        if (w <= 0) break;
+        n += w;
+      }
+      return n;
+    }
+
+  private:
+    // Takes over fd, -1 for a client that is not connected
+    void attach(int socketFd){
+      stop();
+      fd = socketFd;
+      if (fd >= 0) {
+        timeval tv = {5, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+      }
+    }
+
+    int fd = -1;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef SIM_WIFI_CLIENT_SECURE_H
+#define SIM_WIFI_CLIENT_SECURE_H
+
+// Host-side stand-in for WiFiClientSecure: plain TCP, for talking to the
+// local stand-ins in sim/ over http.
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient {
+  public:
+    void setInsecure(){}
+};
+
+#endif
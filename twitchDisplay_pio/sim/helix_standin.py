@@ -0,0 +1,635 @@
+#!/usr/bin/env python3
+"""Local stand-in for helix, EventSub and the profile image CDN, for running
+the avatar download ([env:native_avatarFetch]), the helix polls
+([env:native_helixPoll]) and the EventSub client ([env:native_eventSub])
+without Twitch.
+
+    python3 sim/helix_standin.py [--port 8089] [--users sim/fixtures/users.csv]
+        [--streams sim/fixtures/streams/all.json]
+        [--idle-timeout 3] [--keep-alive-requests 8] [--rate-limit 800]
+        [--max-cost 10]
+
+Every helix request takes a point of the token, which has --rate-limit points
+refilled over a minute; the answers carry the Ratelimit-Limit, -Remaining and
+-Reset headers, and without a point left helix answers 429.
+
+HTTP/1.1 clients get keep-alive connections, which the stand-in closes after
+--idle-timeout seconds without a request and after --keep-alive-requests
+requests (sending "Connection: close" with the last answer), as servers do.
+
+GET /helix/users?id=...            like helix, needs "Authorization: Bearer ..."
+GET /helix/streams?user_id=...     like helix, the streams of the given users
+                                   in the streams file, up to 100 user_id and
+                                   first (default 20) streams a page, the next
+                                   page with after=<cursor>; chunked for
+                                   HTTP/1.1
+GET /jtv_user_pictures/<name>-profile_image-70x70.<ext>
+                                   the image of a user; only the 70x70 variant
+                                   is served, so clients have to ask for it
+GET /standin/swap?id=...&image=... gives a user another image (relative to the
+                                   users file), which changes its URL
+GET /standin/delay?ms=...          holds every helix answer back that long,
+                                   like a slow network
+GET /standin/page?size=...         pages helix/streams after size streams
+                                   whatever first says, 0 to stop that
+GET /standin/ratelimit?limit=...   gives the token that many points a minute,
+                                   all of them left
+GET /standin/fail?code=...&count=... answers the next count helix requests
+                                   with code
+
+EventSub over a WebSocket (plain ws, frames unfragmented) at /ws, with a
+welcome and keepalives like Twitch; keepalive_timeout_seconds may be as low
+as 1 here. Subscriptions for websocket sessions cost 1 each, up to
+--max-cost per session, and go when their session disconnects.
+
+GET /ws?keepalive_timeout_seconds=...
+                                   a new session
+POST /helix/eventsub/subscriptions like helix, transport websocket only; 202,
+                                   409 if it exists, 429 above the cost
+GET /standin/eventsub?max_cost=... the cost each session may have
+GET /standin/online?id=...[&lag=1][&duplicate=1]
+                                   the user goes live: stream.online to its
+                                   subscribers and its stream back into
+                                   helix/streams, unless lag; duplicate sends
+                                   the notification twice
+GET /standin/offline?id=...[&lag=1] the user goes offline, the same way
+GET /standin/update?id=...&title=...&game=...
+                                   channel.update to the subscribers, the
+                                   stream in helix/streams keeps its title
+GET /standin/reconnect             session_reconnect to every session; the
+                                   new connection takes the session over
+GET /standin/revoke?id=...&type=... revokes that subscription
+GET /standin/silence               no more keepalives for the open sessions
+GET /standin/close                 closes every session
+"""
+
+import argparse
+import base64
+import csv
+import hashlib
+import json
+import mimetypes
+import os
+import posixpath
+import re
+import select
+import socket
+import sys
+import threading
+import time
+import uuid
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlsplit
+
+PICTURE = re.compile(r"^/jtv_user_pictures/(.+)-profile_image-(\d+x\d+)\.(\w+)$")
+WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+EVENTSUB_TYPES = {"stream.online": "1", "stream.offline": "1", "channel.update": "2"}
+
+
+def timestamp():
+    return time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime())
+
+
+class Session:
+    """An EventSub WebSocket session, on the connection that has it now"""
+
+    def __init__(self, keepalive):
+        self.id = base64.urlsafe_b64encode(uuid.uuid4().bytes).decode().rstrip("=")
+        self.keepalive = keepalive
+        self.lock = threading.Lock()
+        self.connection = None
+        self.last_sent = 0
+        self.silent = False
+        self.cost = 0
+        self.subscriptions = {}  # id -> subscription
+
+    def send_frame(self, opcode, payload, connection=None):
+        with self.lock:
+            connection = connection or self.connection
+            if connection is None:
+                return False
+            head = bytes([0x80 | opcode])
+            if len(payload) < 126:
+                head += bytes([len(payload)])
+            elif len(payload) < 65536:
+                head += bytes([126]) + len(payload).to_bytes(2, "big")
+            else:
+                head += bytes([127]) + len(payload).to_bytes(8, "big")
+            try:
+                connection.sendall(head + payload)
+            except OSError:
+                return False
+            self.last_sent = time.time()
+            return True
+
+    def send(self, message_type, payload, subscription=None, connection=None, message_id=None):
+        metadata = {
+            "message_id": message_id or str(uuid.uuid4()),
+            "message_type": message_type,
+            "message_timestamp": timestamp(),
+        }
+        if subscription:
+            metadata["subscription_type"] = subscription["type"]
+            metadata["subscription_version"] = subscription["version"]
+        body = json.dumps({"metadata": metadata, "payload": payload}, ensure_ascii=False)
+        return self.send_frame(0x1, body.encode(), connection)
+
+    def session_payload(self, status, reconnect_url=None):
+        return {"session": {
+            "id": self.id,
+            "status": status,
+            "connected_at": timestamp(),
+            "keepalive_timeout_seconds": self.keepalive if status == "connected" else None,
+            "reconnect_url": reconnect_url,
+            "recovery_url": None,
+        }}
+
+
+class EventSub:
+    """The sessions and their subscriptions"""
+
+    def __init__(self, max_cost):
+        self.lock = threading.Lock()
+        self.max_cost = max_cost
+        self.sessions = {}  # id -> Session
+
+    def subscribers(self, sub_type, user_id):
+        with self.lock:
+            return [(session, sub) for session in self.sessions.values() for sub in session.subscriptions.values()
+                    if sub["type"] == sub_type and sub["condition"]["broadcaster_user_id"] == user_id]
+
+    def notify(self, sub_type, user_id, event, duplicate=False):
+        sent = 0
+        for session, sub in self.subscribers(sub_type, user_id):
+            message_id = str(uuid.uuid4())
+            for _ in range(2 if duplicate else 1):
+                sent += session.send("notification", {"subscription": sub, "event": event},
+                                     subscription=sub, message_id=message_id)
+        return sent
+
+
+class Bucket:
+    """The points of the token, refilled evenly over a minute like helix"""
+
+    def __init__(self, limit):
+        self.lock = threading.Lock()
+        self.reset_to(limit)
+
+    def reset_to(self, limit):
+        with self.lock:
+            self.limit = limit
+            self.points = float(limit)
+            self.when = time.time()
+
+    def take(self):
+        """Takes a point, returns whether there was one and the headers"""
+        with self.lock:
+            now = time.time()
+            self.points = min(self.limit, self.points + (now - self.when) * self.limit / 60)
+            self.when = now
+            ok = self.points >= 1
+            if ok:
+                self.points -= 1
+            reset = now + (self.limit - self.points) * 60 / self.limit
+            return ok, {
+                "Ratelimit-Limit": str(self.limit),
+                "Ratelimit-Remaining": str(int(self.points)),
+                "Ratelimit-Reset": str(int(reset) + 1),
+            }
+
+
+class Users:
+    def __init__(self, path):
+        self.base = os.path.dirname(os.path.abspath(path))
+        self.users = {}   # id -> (login, image path)
+        self.images = {}  # name in the URL -> image path
+        with open(path, newline="") as f:
+            for row in csv.reader(f):
+                if not row or row[0].startswith("#"):
+                    continue
+                self.set_image(row[0].strip(), row[1].strip(), row[2].strip())
+
+    def set_image(self, user_id, login, image):
+        path = os.path.normpath(os.path.join(self.base, image))
+        if not os.path.isfile(path):
+            raise ValueError("no such image: %s" % image)
+        name = "%s-%s" % (login, os.path.splitext(os.path.basename(path))[0])
+        self.users[user_id] = (login, path)
+        self.images[name] = path
+        return name
+
+
+def make_handler(users, streams, idle_timeout, keep_alive_requests, bucket, eventsub, port):
+    settings = {"delay": 0.0, "page": 0, "fail": 0, "fail_count": 0}
+    gone = {}  # user id -> stream, of the users that went offline
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+        timeout = idle_timeout
+
+        def setup(self):
+            super().setup()
+            # headers and body go out in separate writes
+            self.connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            self.requests = 0
+            self.rate_headers = {}
+
+        def send_head(self, code, content_type):
+            self.requests += 1
+            self.send_response(code)
+            self.send_header("Content-Type", content_type)
+            for name, value in self.rate_headers.items():
+                self.send_header(name, value)
+            if self.requests >= keep_alive_requests:
+                self.send_header("Connection", "close")
+
+        def send(self, code, body, content_type="application/json"):
+            self.send_head(code, content_type)
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def send_chunked(self, code, body, content_type="application/json", chunk=512):
+            if self.request_version != "HTTP/1.1":
+                self.send(code, body, content_type)
+                return
+            self.send_head(code, content_type)
+            self.send_header("Transfer-Encoding", "chunked")
+            self.end_headers()
+            for i in range(0, len(body), chunk):
+                part = body[i:i + chunk]
+                self.wfile.write(b"%x\r\n%s\r\n" % (len(part), part))
+            self.wfile.write(b"0\r\n\r\n")
+
+        def bad_request(self, message):
+            body = {"error": "Bad Request", "status": 400, "message": message}
+            self.send(400, json.dumps(body).encode())
+
+        def authorized(self):
+            if self.headers.get("Authorization", "").startswith("Bearer "):
+                return True
+            self.send(401, b'{"error":"Unauthorized","status":401,"message":"OAuth token is missing"}')
+            return False
+
+        def picture_url(self, login, path):
+            name = "%s-%s" % (login, os.path.splitext(os.path.basename(path))[0])
+            ext = os.path.splitext(path)[1].lstrip(".")
+            host = self.headers.get("Host", "127.0.0.1")
+            return "http://%s/jtv_user_pictures/%s-profile_image-300x300.%s" % (host, name, ext)
+
+        def helix_taken(self, url):
+            """Delay, points and failures of helix requests; True if answered"""
+            self.rate_headers = {}
+            if not url.path.startswith("/helix/"):
+                return False
+            time.sleep(settings["delay"])
+            ok, self.rate_headers = bucket.take()
+            if not ok:
+                self.send(429, b'{"error":"Too Many Requests","status":429,"message":"Too Many Requests"}')
+                return True
+            if settings["fail_count"]:
+                settings["fail_count"] -= 1
+                body = {"error": "Service Unavailable", "status": settings["fail"], "message": ""}
+                self.send(settings["fail"], json.dumps(body).encode())
+                return True
+            return False
+
+        def do_POST(self):
+            url = urlsplit(self.path)
+            url = url._replace(path=posixpath.normpath(url.path))
+            body = self.rfile.read(int(self.headers.get("Content-Length", "0")))
+            if self.helix_taken(url):
+                return
+            if url.path != "/helix/eventsub/subscriptions":
+                self.send(404, b"not found", "text/plain")
+                return
+            if not self.authorized():
+                return
+            try:
+                wanted = json.loads(body)
+                sub_type = wanted["type"]
+                version = wanted["version"]
+                user_id = wanted["condition"]["broadcaster_user_id"]
+                transport = wanted["transport"]
+            except (ValueError, KeyError, TypeError):
+                self.bad_request("Malformed request body")
+                return
+            if EVENTSUB_TYPES.get(sub_type) != version:
+                self.bad_request("The subscription type and version are not supported")
+                return
+            if transport.get("method") != "websocket":
+                self.bad_request("The stand-in only has websocket transports")
+                return
+            with eventsub.lock:
+                session = eventsub.sessions.get(transport.get("session_id"))
+                if session is None:
+                    self.bad_request("The websocket session is not connected")
+                    return
+                for sub in session.subscriptions.values():
+                    if sub["type"] == sub_type and sub["condition"]["broadcaster_user_id"] == user_id:
+                        self.send(409, b'{"error":"Conflict","status":409,"message":"subscription already exists"}')
+                        return
+                if session.cost + 1 > eventsub.max_cost:
+                    self.send(429, b'{"error":"Too Many Requests","status":429,"message":"max total cost exceeded"}')
+                    return
+                sub = {
+                    "id": str(uuid.uuid4()),
+                    "status": "enabled",
+                    "type": sub_type,
+                    "version": version,
+                    "cost": 1,
+                    "condition": {"broadcaster_user_id": user_id},
+                    "transport": {"method": "websocket", "session_id": session.id, "connected_at": timestamp()},
+                    "created_at": timestamp(),
+                }
+                session.subscriptions[sub["id"]] = sub
+                session.cost += 1
+                answer = {"data": [sub], "total": len(session.subscriptions), "total_cost": session.cost,
+                          "max_total_cost": eventsub.max_cost}
+            self.send(202, json.dumps(answer).encode())
+
+        def websocket(self, query):
+            """Runs an EventSub session on this connection until it closes"""
+            key = self.headers.get("Sec-WebSocket-Key")
+            if self.headers.get("Upgrade", "").lower() != "websocket" or not key:
+                self.send(400, b"not a websocket request", "text/plain")
+                return
+            accept = base64.b64encode(hashlib.sha1((key + WEBSOCKET_GUID).encode()).digest()).decode()
+            self.send_response(101)
+            self.send_header("Upgrade", "websocket")
+            self.send_header("Connection", "Upgrade")
+            self.send_header("Sec-WebSocket-Accept", accept)
+            self.end_headers()
+            self.wfile.flush()
+            self.close_connection = True
+            connection = self.connection
+            connection.settimeout(None)
+
+            old = None
+            with eventsub.lock:
+                moving = eventsub.sessions.get(query.get("reconnect", [""])[0])
+                if moving:
+                    # the session and its subscriptions come to this connection
+                    session = moving
+                    old = session.connection
+                else:
+                    keepalive = int(query.get("keepalive_timeout_seconds", ["10"])[0])
+                    session = Session(min(max(keepalive, 1), 600))
+                    eventsub.sessions[session.id] = session
+            with session.lock:
+                session.connection = connection
+            session.send("session_welcome", session.session_payload("connected"))
+            if old is not None:
+                session.send_frame(0x8, (4004).to_bytes(2, "big"), old)
+                try:
+                    old.shutdown(socket.SHUT_RDWR)
+                except OSError:
+                    pass
+
+            received = b""
+            try:
+                while session.connection is connection:
+                    wait = max(0.05, session.last_sent + session.keepalive - time.time())
+                    readable, _, _ = select.select([connection], [], [], min(wait, 0.2))
+                    if readable:
+                        data = connection.recv(4096)
+                        if not data:
+                            break
+                        received += data
+                        closed = False
+                        while len(received) >= 6:
+                            length = received[1] & 0x7F
+                            head = 2
+                            if length == 126:
+                                length = int.from_bytes(received[2:4], "big")
+                                head = 4
+                            elif length == 127:
+                                length = int.from_bytes(received[2:10], "big")
+                                head = 10
+                            if len(received) < head + 4 + length:
+                                break
+                            mask = received[head:head + 4]
+                            payload = bytes(b ^ mask[i % 4] for i, b in enumerate(received[head + 4:head + 4 + length]))
+                            opcode = received[0] & 0x0F
+                            received = received[head + 4 + length:]
+                            if opcode == 0x8:
+                                session.send_frame(0x8, payload[:2], connection)
+                                closed = True
+                                break
+                            if opcode == 0x9:
+                                session.send_frame(0xA, payload, connection)
+                        if closed:
+                            break
+                    elif not session.silent and time.time() - session.last_sent >= session.keepalive:
+                        session.send("session_keepalive", {})
+            except OSError:
+                pass
+            with eventsub.lock:
+                if session.connection is connection:
+                    # gone for good, and the subscriptions with it
+                    session.connection = None
+                    eventsub.sessions.pop(session.id, None)
+
+        def user_event(self, user_id):
+            login = users.users[user_id][0] if user_id in users.users else user_id
+            return {"broadcaster_user_id": user_id, "broadcaster_user_login": login,
+                    "broadcaster_user_name": login.capitalize()}
+
+        def eventsub_standin(self, url, query):
+            """The /standin/ settings of EventSub, True if it was one"""
+            user_id = query.get("id", [""])[0]
+            if url.path == "/standin/eventsub":
+                eventsub.max_cost = int(query.get("max_cost", ["10"])[0])
+            elif url.path == "/standin/online":
+                if "lag" not in query and user_id in gone:
+                    stream = gone.pop(user_id)
+                    stream["started_at"] = timestamp()
+                    streams.append(stream)
+                event = dict(self.user_event(user_id), id=str(int(time.time())), type="live", started_at=timestamp())
+                eventsub.notify("stream.online", user_id, event, "duplicate" in query)
+            elif url.path == "/standin/offline":
+                if "lag" not in query:
+                    for stream in [s for s in streams if s["user_id"] == user_id]:
+                        streams.remove(stream)
+                        gone[user_id] = stream
+                eventsub.notify("stream.offline", user_id, self.user_event(user_id))
+            elif url.path == "/standin/update":
+                event = dict(self.user_event(user_id), title=query.get("title", [""])[0], language="de",
+                             category_id="509658", category_name=query.get("game", [""])[0],
+                             content_classification_labels=[])
+                eventsub.notify("channel.update", user_id, event)
+            elif url.path == "/standin/reconnect":
+                with eventsub.lock:
+                    sessions = list(eventsub.sessions.values())
+                for session in sessions:
+                    reconnect_url = "ws://127.0.0.1:%d/ws?reconnect=%s" % (port, session.id)
+                    session.send("session_reconnect", session.session_payload("reconnecting", reconnect_url))
+            elif url.path == "/standin/revoke":
+                sub_type = query.get("type", ["stream.online"])[0]
+                for session, sub in eventsub.subscribers(sub_type, user_id):
+                    with eventsub.lock:
+                        session.subscriptions.pop(sub["id"], None)
+                        session.cost -= sub["cost"]
+                    sub = dict(sub, status="authorization_revoked")
+                    session.send("revocation", {"subscription": sub}, subscription=sub)
+            elif url.path == "/standin/silence":
+                with eventsub.lock:
+                    for session in eventsub.sessions.values():
+                        session.silent = True
+            elif url.path == "/standin/close":
+                with eventsub.lock:
+                    sessions = list(eventsub.sessions.values())
+                for session in sessions:
+                    with session.lock:
+                        connection = session.connection
+                    if connection is not None:
+                        session.send_frame(0x8, (4000).to_bytes(2, "big"), connection)
+                        try:
+                            connection.shutdown(socket.SHUT_RDWR)
+                        except OSError:
+                            pass
+            else:
+                return False
+            self.send(200, b"ok", "text/plain")
+            return True
+
+        def do_GET(self):
+            url = urlsplit(self.path)
+            url = url._replace(path=posixpath.normpath(url.path))
+            query = parse_qs(url.query)
+            if url.path == "/ws":
+                self.websocket(query)
+                return
+            if self.helix_taken(url):
+                return
+            if url.path == "/helix/streams":
+                if not self.authorized():
+                    return
+                wanted = query.get("user_id", [])
+                if len(wanted) > 100:
+                    self.bad_request("The parameter \"user_id\" was malformed: the value must be at most 100 items")
+                    return
+                first = int(query.get("first", ["20"])[0])
+                if not 1 <= first <= 100:
+                    self.bad_request("The parameter \"first\" was malformed: the value must be between 1 and 100")
+                    return
+                if settings["page"]:
+                    first = min(first, settings["page"])
+                # the cursor is opaque to clients, here it is the offset
+                offset = 0
+                if "after" in query:
+                    try:
+                        offset = json.loads(base64.b64decode(query["after"][0]))["o"]
+                    except (ValueError, KeyError, TypeError):
+                        self.bad_request("Invalid cursor")
+                        return
+                data = [s for s in streams if s["user_id"] in wanted]
+                pagination = {}
+                if offset + first < len(data):
+                    pagination["cursor"] = base64.b64encode(json.dumps({"o": offset + first}).encode()).decode()
+                data = data[offset:offset + first]
+                body = json.dumps({"data": data, "pagination": pagination}, ensure_ascii=False, separators=(",", ":"))
+                self.send_chunked(200, body.encode())
+                return
+
+            if url.path == "/helix/users":
+                if not self.authorized():
+                    return
+                data = []
+                for user_id in query.get("id", []):
+                    if user_id not in users.users:
+                        continue
+                    login, path = users.users[user_id]
+                    data.append({
+                        "id": user_id,
+                        "login": login,
+                        "display_name": login,
+                        "type": "",
+                        "broadcaster_type": "partner",
+                        "description": "Stand-in user for the avatar download",
+                        "profile_image_url": self.picture_url(login, path),
+                        "offline_image_url": "",
+                        "view_count": 0,
+                        "created_at": "2016-01-01T00:00:00Z",
+                    })
+                self.send(200, json.dumps({"data": data}).encode())
+                return
+
+            match = PICTURE.match(url.path)
+            if match:
+                path = users.images.get(match.group(1))
+                if path is None or match.group(2) != "70x70":
+                    self.send(404, b"not found", "text/plain")
+                    return
+                with open(path, "rb") as f:
+                    body = f.read()
+                self.send(200, body, mimetypes.guess_type(path)[0] or "application/octet-stream")
+                return
+
+            if url.path == "/standin/swap":
+                user_id = query.get("id", [""])[0]
+                if user_id not in users.users:
+                    self.send(404, b"unknown user", "text/plain")
+                    return
+                try:
+                    users.set_image(user_id, users.users[user_id][0], query.get("image", [""])[0])
+                except ValueError as e:
+                    self.send(400, str(e).encode(), "text/plain")
+                    return
+                self.send(200, b"ok", "text/plain")
+                return
+
+            if url.path == "/standin/page":
+                settings["page"] = int(query.get("size", ["0"])[0])
+                self.send(200, b"ok", "text/plain")
+                return
+
+            if url.path == "/standin/ratelimit":
+                bucket.reset_to(int(query.get("limit", ["800"])[0]))
+                self.send(200, b"ok", "text/plain")
+                return
+
+            if url.path == "/standin/fail":
+                settings["fail"] = int(query.get("code", ["503"])[0])
+                settings["fail_count"] = int(query.get("count", ["1"])[0])
+                self.send(200, b"ok", "text/plain")
+                return
+
+            if self.eventsub_standin(url, query):
+                return
+
+            if url.path == "/standin/delay":
+                settings["delay"] = int(query.get("ms", ["0"])[0]) / 1000
+                self.send(200, b"ok", "text/plain")
+                return
+
+            self.send(404, b"not found", "text/plain")
+
+        def log_message(self, format, *args):
+            sys.stderr.write("[standin] %s\n" % (format % args))
+
+    return Handler
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8089)
+    parser.add_argument("--users", default=os.path.join(here, "fixtures", "users.csv"))
+    parser.add_argument("--streams", default=os.path.join(here, "fixtures", "streams", "all.json"))
+    parser.add_argument("--idle-timeout", type=float, default=3)
+    parser.add_argument("--keep-alive-requests", type=int, default=8)
+    parser.add_argument("--rate-limit", type=int, default=800)
+    parser.add_argument("--max-cost", type=int, default=10)
+    args = parser.parse_args()
+    with open(args.streams, encoding="utf-8") as f:
+        streams = json.load(f)["data"]
+    handler = make_handler(Users(args.users), streams, args.idle_timeout, args.keep_alive_requests,
+                           Bucket(args.rate_limit), EventSub(args.max_cost), args.port)
+    server = ThreadingHTTPServer(("127.0.0.1", args.port), handler)
+    print("helix stand-in on http://127.0.0.1:%d/helix/" % args.port, flush=True)
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
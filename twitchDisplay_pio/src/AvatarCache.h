@@ -0,0 +1,182 @@
+#ifndef AVATAR_CACHE_H
+#define AVATAR_CACHE_H
+
+// Avatars downloaded at runtime (AvatarFetch.h), kept in their own flash
+// partition ("avatars") so the next boot can show them without going to
+// the network. Every slot holds the wire order pixels of one channel, two
+// sectors. Their headers, with the hash of the profile image URL they came
+// from so a changed profile image is noticed without downloading it, are
+// appended to a journal in the first sector; the newest header of a slot
+// counts. A full journal is erased and written again with the current
+// headers.
+//
+// A slot is written pixels first and header last, a slot torn by a reset
+// fails its magic or CRC and counts as empty, as do slots whose header was
+// lost while the journal was written again. Like the assets partition the
+// cache is mapped, get() returns a pointer straight into flash.
+
+#include <Arduino.h>
+
+#include "MappedPartition.h"
+#include "AvatarStore.h"
+
+#define AVATAR_CACHE_PARTITION "avatars"
+
+class AvatarCache {
+  public:
+    static const uint32_t PIXEL_BYTES = AvatarStore::PIXELS*2;
+
+    struct Header {
+      char magic[4];    // "TDAJ"
+      uint32_t urlHash;
+      char id[12];      // channel id, zero padded
+      uint32_t seq;     // write order, the lowest is replaced first
+      uint32_t crc;     // CRC-32 of the pixels
+      uint32_t slot;
+    };
+
+    static const uint32_t SLOT_BYTES = (PIXEL_BYTES + MappedPartition::SECTOR_SIZE - 1)
+      / MappedPartition::SECTOR_SIZE * MappedPartition::SECTOR_SIZE;
+    // Headers the journal sector holds before it is written again
+    static const uint32_t JOURNAL_HEADERS = MappedPartition::SECTOR_SIZE / sizeof(Header);
+    // Size of the stand-in partition on the host, as in the partition table
+    static const uint32_t HOST_SLOTS = 10;
+
+    // Maps the partition and checks every slot
+    bool begin(){
+      end();
+      if (!partition.begin(AVATAR_CACHE_PARTITION, MappedPartition::SECTOR_SIZE + HOST_SLOTS*SLOT_BYTES)) return false;
+      if (partition.size() < MappedPartition::SECTOR_SIZE) return false;
+      slots = std::min<uint32_t>((partition.size() - MappedPartition::SECTOR_SIZE)/SLOT_BYTES, MAX_SLOTS);
+      // the newest header of every slot, up to the first unwritten one
+      const uint32_t erased = 0xFFFFFFFF;
+      for (journalUsed = 0; journalUsed < JOURNAL_HEADERS; journalUsed++) {
+        const Header& h = journal(journalUsed);
+        if (memcmp(h.magic, &erased, 4) == 0) break;
+        if (memcmp(h.magic, "TDAJ", 4) != 0 || h.slot >= slots || h.id[sizeof(h.id)-1] != '\0') continue;
+        if (!valid[h.slot] || h.seq > header(h.slot).seq) {
+          current[h.slot] = journalUsed;
+          valid[h.slot] = true;
+        }
+      }
+      for (uint32_t i = 0; i < slots; i++) {
+        if (valid[i] && AvatarStore::crc32(pixels(i), PIXEL_BYTES) != header(i).crc) valid[i] = false;
+        if (valid[i]) {
+          count++;
+          seq = std::max(seq, header(i).seq);
+        }
+      }
+      return slots > 0;
+    }
+
+    void end(){
+      partition.end();
+      slots = 0;
+      count = 0;
+      seq = 0;
+      journalUsed = 0;
+      memset(valid, 0, sizeof(valid));
+    }
+
+    // Wire order pixels of the cached avatar of channel id, nullptr if
+    // there is none. Valid until the next store().
+    const uint8_t* get(const char* id) const {
+      int16_t i = find(id);
+      return i < 0 ? nullptr : pixels(i);
+    }
+
+    // Hash of the image URL the avatar of channel id is cached from, 0 if
+    // there is none
+    uint32_t urlHash(const char* id) const {
+      int16_t i = find(id);
+      return i < 0 ? 0 : header(i).urlHash;
+    }
+
+    // Replaces the avatar of channel id, or takes an empty slot, or the one
+    // written longest ago
+    bool store(const char* id, uint32_t urlHash, const uint16_t* pixelData){
+      if (!slots) return false;
+      int16_t slot = find(id);
+      if (slot < 0) {
+        for (uint32_t i = 0; i < slots && slot < 0; i++) {
+          if (!valid[i]) slot = i;
+        }
+      }
+      if (slot < 0) {
+        slot = 0;
+        for (uint32_t i = 1; i < slots; i++) {
+          if (header(i).seq < header(slot).seq) slot = i;
+        }
+      }
+
+      if (valid[slot]) count--;
+      valid[slot] = false;
+      Header h = {};
+      memcpy(h.magic, "TDAJ", 4);
+      h.urlHash = urlHash;
+      strncpy(h.id, id, sizeof(h.id) - 1);
+      h.id[sizeof(h.id) - 1] = '\0';
+      h.seq = ++seq;
+      h.crc = AvatarStore::crc32((const uint8_t*)pixelData, PIXEL_BYTES);
+      h.slot = slot;
+      uint32_t offset = MappedPartition::SECTOR_SIZE + slot*SLOT_BYTES;
+      if (!partition.erase(offset, SLOT_BYTES)) return false;
+      if (!partition.write(offset, pixelData, PIXEL_BYTES)) return false;
+      if (journalUsed == JOURNAL_HEADERS && !rewriteJournal()) return false;
+      if (!partition.write(journalUsed*sizeof(Header), &h, sizeof(h))) return false;
+      current[slot] = journalUsed++;
+      valid[slot] = true;
+      count++;
+      return true;
+    }
+
+    uint16_t size() const { return count; }
+    uint16_t capacity() const { return slots; }
+
+  private:
+    static const uint32_t MAX_SLOTS = 32;
+
+    const Header& journal(uint32_t i) const {
+      return *(const Header*)(partition.data() + i*sizeof(Header));
+    }
+    const Header& header(uint32_t slot) const {
+      return journal(current[slot]);
+    }
+    const uint8_t* pixels(uint32_t slot) const {
+      return partition.data() + MappedPartition::SECTOR_SIZE + slot*SLOT_BYTES;
+    }
+
+    // Erases the full journal and writes the headers of the valid slots
+    // back at its start
+    bool rewriteJournal(){
+      Header kept[MAX_SLOTS];
+      uint32_t n = 0;
+      for (uint32_t i = 0; i < slots; i++) {
+        if (valid[i]) kept[n++] = header(i);
+      }
+      journalUsed = 0;
+      if (!partition.erase(0, MappedPartition::SECTOR_SIZE)) return false;
+      for (uint32_t i = 0; i < n; i++) {
+        if (!partition.write(journalUsed*sizeof(Header), &kept[i], sizeof(Header))) return false;
+        current[kept[i].slot] = journalUsed++;
+      }
+      return true;
+    }
+
+    int16_t find(const char* id) const {
+      for (uint32_t i = 0; i < slots; i++) {
+        if (valid[i] && strncmp(id, header(i).id, sizeof(Header::id)) == 0) return i;
+      }
+      return -1;
+    }
+
+    MappedPartition partition;
+    uint32_t slots = 0;
+    uint16_t count = 0;
+    uint32_t seq = 0;
+    uint32_t journalUsed = 0;
+    uint8_t current[MAX_SLOTS] = {};  // journal index of the header of every slot
+    bool valid[MAX_SLOTS] = {};
+};
+
+#endif
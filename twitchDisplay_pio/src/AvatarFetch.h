@@ -0,0 +1,246 @@
+#ifndef AVATAR_FETCH_H
+#define AVATAR_FETCH_H
+
+// Downloads the profile images of the channels through helix/users, turns
+// them into avatars (AvatarImage.h) and keeps them in avatarCache. Only
+// channels whose profile image URL changed since it was cached are
+// downloaded again, so once every channel is cached a boot does not touch
+// the network at all.
+//
+// fetchAvatars() does all of it at once, at boot. The daily refresh goes
+// through avatarRefresh instead: the live poll task (LivePoller.h) does the
+// requests and the decoding, loop() stores what it hands over and repaints,
+// so the ticker keeps running and only loop() touches the cache.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Debug.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+#include "AvatarImage.h"
+#include "HelixClient.h"
+#include "SpscQueue.h"
+
+// Profile images are a few KB, anything bigger is not downloaded
+#define AVATAR_MAX_DOWNLOAD (64*1024)
+// How often the poll task looks whether loop() took the last avatar
+#define AVATAR_HANDOVER_WAIT_MS 10
+
+// FNV-1a of the profile image URL helix reports
+uint32_t avatarUrlHash(const char* url){
+  uint32_t hash = 2166136261UL;
+  while (*url) {
+    hash ^= (uint8_t)*url++;
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+// helix hands out the 300x300 variant, the CDN has a 70x70 one next to it
+// which is all a 64x64 avatar needs
+String avatarDownloadUrl(const char* url){
+  String s(url);
+  s.replace("-300x300.", "-70x70.");
+  return s;
+}
+
+// Downloads url into body, false if that failed or it is too big
+bool downloadAvatarImage(const String& url, std::vector<uint8_t>& body){
+  HTTPClient http;
+  http.begin(url);
+  http.useHTTP10(true);
+  int httpCode = http.GET();
+  if (httpCode != HTTP_CODE_OK) {
+    DEBUG_W.printf("[HTTP] GET %s failed, error: %s\n", url.c_str(),
+      (httpCode<=0) ? http.errorToString(httpCode).c_str() : String(httpCode).c_str());
+    http.end();
+    return false;
+  }
+  int size = http.getSize();  // -1 without Content-Length
+  if (size > AVATAR_MAX_DOWNLOAD) {
+    DEBUG_W.printf("[%s] Profile image %s is too big (%d bytes)\n", DEBUG_TAG, url.c_str(), size);
+    http.end();
+    return false;
+  }
+  body.clear();
+  body.reserve(size > 0 ? size : 8192);
+  WiFiClient& stream = http.getStream();
+  uint8_t buf[512];
+  while (size < 0 || body.size() < (size_t)size) {
+    size_t want = sizeof(buf);
+    if (size >= 0) want = std::min<size_t>(want, size - body.size());
+    size_t n = stream.readBytes(buf, want);
+    if (!n) break;
+    body.insert(body.end(), buf, buf + n);
+    if (body.size() > AVATAR_MAX_DOWNLOAD) break;
+  }
+  http.end();
+  return (size < 0 || body.size() == (size_t)size) && body.size() <= AVATAR_MAX_DOWNLOAD;
+}
+
+// A channel to look up and the URL hash of its cached avatar
+struct avatarWanted {
+  std::string id;
+  bool cached;
+  uint32_t urlHash;
+};
+
+// Channels whose avatar is missing in avatarCache, or all of them
+std::vector<avatarWanted> wantedAvatars(bool all){
+  std::vector<avatarWanted> wanted;
+  for (auto& channel : channels) {
+    const char* id = channel.id.c_str();
+    bool cached = avatarCache.get(id);
+    if (!all && cached) continue;
+    wanted.push_back({channel.id, cached, cached ? avatarCache.urlHash(id) : 0});
+  }
+  return wanted;
+}
+
+// Looks up the profile image URLs of the wanted channels and downloads and
+// decodes the ones that are not cached from that URL. Every avatar goes to
+// got(), which returns whether it was kept. Does not touch avatarCache.
+// Returns the number of avatars kept, -1 if helix could not be asked.
+int downloadAvatars(const std::vector<avatarWanted>& wanted,
+    std::function<bool(const char* id, uint32_t urlHash, std::vector<uint16_t>& pixels)> got){
+  String path = "users";
+  for (size_t i = 0; i < wanted.size(); i++) {
+    path += i ? "&id=" : "?id=";
+    path += wanted[i].id.c_str();
+  }
+
+  DEBUG_I.printf("[%s] Looking up %u profile images: %s\n", DEBUG_TAG, (uint32_t)wanted.size(), path.c_str());
+  int httpCode = helix.get(path);
+  if (httpCode != HTTP_CODE_OK) {
+    DEBUG_W.printf("[HTTP] GET failed, error: %s\n",
+      (httpCode<=0) ? HTTPClient::errorToString(httpCode).c_str() : String(httpCode).c_str());
+    helix.end();
+    return -1;
+  }
+
+  JsonDocument filter;
+  filter["data"][0]["id"] = true;
+  filter["data"][0]["profile_image_url"] = true;
+  JsonDocument doc;
+  DeserializationError err = deserializeJson(doc, helix.body(), DeserializationOption::Filter(filter));
+  helix.end();
+  if (err) {
+    DEBUG_W.print("[JSON] deserializeJson() failed with code ");
+    DEBUG_W.println(err.f_str());
+    return -1;
+  }
+
+  int updated = 0;
+  std::vector<uint8_t> body;
+  for (JsonObject user : doc["data"].as<JsonArray>()) {
+    const char* id = user["id"];
+    const char* image = user["profile_image_url"];
+    if (!id || !image || !*image) continue;
+    uint32_t hash = avatarUrlHash(image);
+    auto channel = std::find_if(wanted.begin(), wanted.end(), [&](const avatarWanted& w){ return w.id == id; });
+    if (channel == wanted.end() || (channel->cached && channel->urlHash == hash)) continue;
+
+    String imageUrl = avatarDownloadUrl(image);
+    unsigned long t = millis();
+    if (!downloadAvatarImage(imageUrl, body)) continue;
+    std::vector<uint16_t> pixels(AvatarStore::PIXELS);
+    if (!decodeAvatarImage(body.data(), body.size(), pixels.data())) {
+      DEBUG_W.printf("[%s] Cannot decode profile image of %s (%u bytes)\n", DEBUG_TAG, id, (uint32_t)body.size());
+      continue;
+    }
+    if (!got(id, hash, pixels)) continue;
+    DEBUG_I.printf("[%s] Avatar of %s updated from %u bytes in %lu ms\n", DEBUG_TAG, id, (uint32_t)body.size(), millis() - t);
+    updated++;
+  }
+  return updated;
+}
+
+// Stores an avatar in avatarCache and repaints it where it is shown
+bool storeAvatar(const char* id, uint32_t urlHash, const std::vector<uint16_t>& pixels){
+  if (!avatarCache.store(id, urlHash, pixels.data())) {
+    DEBUG_E.printf("[%s] Cannot store avatar of %s\n", DEBUG_TAG, id);
+    return false;
+  }
+  avatarChanged(id);
+  return true;
+}
+
+// Looks up the profile image URLs of the channels missing in avatarCache,
+// or of all channels to notice changed images, and downloads the ones that
+// are not cached. Holds up the caller until it is done. Returns the number
+// of avatars updated, -1 if helix could not be asked.
+int fetchAvatars(bool all){
+  std::vector<avatarWanted> wanted = wantedAvatars(all);
+  if (wanted.empty()) {
+    DEBUG_I.printf("[%s] All %u avatars cached\n", DEBUG_TAG, avatarCache.size());
+    return 0;
+  }
+  return downloadAvatars(wanted, [](const char* id, uint32_t urlHash, std::vector<uint16_t>& pixels){
+    return storeAvatar(id, urlHash, pixels);
+  });
+}
+
+// Looks all channels up again on the live poll task
+class AvatarRefresh {
+  public:
+    // An avatar the poll task got, for loop() to store
+    struct fetched {
+      std::string id;
+      uint32_t urlHash;
+      std::vector<uint16_t> pixels;
+    };
+
+    // Starts a refresh with the next poll, unless one is under way. Call
+    // from loop().
+    void request(){
+      if (busy.load(std::memory_order_acquire)) return;
+      wanted = wantedAvatars(true);
+      busy.store(true, std::memory_order_release);
+    }
+
+    // Does a requested refresh, call on the poll task before a poll
+    void run(){
+      if (!busy.load(std::memory_order_acquire)) return;
+      int updated = downloadAvatars(wanted, [this](const char* id, uint32_t urlHash, std::vector<uint16_t>& pixels){
+        fetched avatar = {id, urlHash, std::move(pixels)};
+        // every avatar waits in the queue until loop() takes it
+        while (!fetchedAvatars.push(std::move(avatar))) delay(AVATAR_HANDOVER_WAIT_MS);
+        return true;
+      });
+      DEBUG_I.printf("[%s] Avatar refresh: %d updated\n", DEBUG_TAG, updated);
+      wanted.clear();
+      busy.store(false, std::memory_order_release);
+    }
+
+    // Stores what the poll task handed over and repaints it, call from
+    // loop(). Returns the number of avatars stored.
+    int apply(){
+      int stored = 0;
+      fetched avatar;
+      while (fetchedAvatars.pop(avatar)) {
+        if (storeAvatar(avatar.id.c_str(), avatar.urlHash, avatar.pixels)) stored++;
+        avatar.pixels = std::vector<uint16_t>();
+      }
+      return stored;
+    }
+
+    // Whether a requested refresh is not done yet
+    bool pending() const { return busy.load(std::memory_order_acquire) || !fetchedAvatars.empty(); }
+
+  private:
+    // Written by loop() while not busy, read by the poll task while busy
+    std::vector<avatarWanted> wanted;
+    std::atomic<bool> busy{false};
+    SpscQueue<fetched, 2> fetchedAvatars;
+};
+
+AvatarRefresh avatarRefresh;
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef AVATAR_IMAGE_H
+#define AVATAR_IMAGE_H
+
+// Turns a downloaded profile image (PNG or baseline JPEG) into an avatar:
+// the centered square of the image scaled to AVATAR_SIZE, as RGB565 in
+// wire order like the pics in the assets partition. Downscaling averages
+// all source pixels of a target pixel (a box filter), smaller images are
+// scaled up by repeating pixels.
+
+#include <Arduino.h>
+#include <vector>
+
+#include "AvatarStore.h"
+#include "PngDecoder.h"
+#include "JpegDecoder.h"
+
+// Row sink for the decoders
+class AvatarScaler {
+  public:
+    explicit AvatarScaler(uint16_t* pixels) : pixels(pixels) {}
+
+    void begin(uint32_t w, uint32_t h){
+      side = std::min(w, h);
+      left = (w - side)/2;
+      top = (h - side)/2;
+      y = 0;
+      target = 0;
+      sums.assign(AVATAR_SIZE*3, 0);
+      rows = 0;
+    }
+
+    void row(const uint8_t* rgb){
+      uint32_t sy = y++;
+      if (sy < top || sy >= top + side || target >= AVATAR_SIZE) return;
+      sy -= top;
+      // a source row can belong to several target rows when upscaling
+      while (target < AVATAR_SIZE && sy >= first(target)) {
+        if (sy < last(target)) add(rgb);
+        if (sy + 1 < last(target)) break;
+        flush();
+      }
+    }
+
+    // All target rows written
+    bool done() const { return target == AVATAR_SIZE; }
+
+  private:
+    // Source range [first, last) of target pixel d, never empty
+    uint32_t first(uint32_t d) const { return d*side/AVATAR_SIZE; }
+    uint32_t last(uint32_t d) const { return std::max((d + 1)*side/AVATAR_SIZE, first(d) + 1); }
+
+    void add(const uint8_t* rgb){
+      const uint8_t* src = rgb + left*3;
+      for (uint32_t d = 0; d < AVATAR_SIZE; d++) {
+        for (uint32_t x = first(d); x < last(d); x++) {
+          sums[d*3] += src[x*3];
+          sums[d*3+1] += src[x*3+1];
+          sums[d*3+2] += src[x*3+2];
+        }
+      }
+      rows++;
+    }
+
+    void flush(){
+      uint16_t* out = pixels + target*AVATAR_SIZE;
+      for (uint32_t d = 0; d < AVATAR_SIZE; d++) {
+        uint32_t n = (last(d) - first(d))*rows;
+        uint32_t r = (sums[d*3] + n/2)/n, g = (sums[d*3+1] + n/2)/n, b = (sums[d*3+2] + n/2)/n;
+        // same rounding as pics_build.py
+        uint16_t c = ((r*31 + 127)/255 << 11) | ((g*63 + 127)/255 << 5) | (b*31 + 127)/255;
+        out[d] = (c >> 8) | (c << 8);
+      }
+      sums.assign(AVATAR_SIZE*3, 0);
+      rows = 0;
+      target++;
+    }
+
+    uint16_t* pixels;
+    uint32_t side = 0, left = 0, top = 0;
+    uint32_t y = 0, target = 0;
+    std::vector<uint32_t> sums;
+    uint32_t rows = 0;
+};
+
+// Decodes a PNG or JPEG into AVATAR_SIZE*AVATAR_SIZE wire order pixels
+bool decodeAvatarImage(const uint8_t* data, size_t len, uint16_t* pixels){
+  AvatarScaler scaler(pixels);
+  bool ok;
+  if (len >= 8 && memcmp(data, "\x89PNG", 4) == 0) {
+    ok = PngDecoder::decode(data, len, scaler);
+  } else if (len >= 2 && data[0] == 0xFF && data[1] == 0xD8) {
+    ok = JpegDecoder::decode(data, len, scaler);
+  } else {
+    return false;
+  }
+  return ok && scaler.done();
+}
+
+#endif
@@ -0,0 +1,233 @@
+#ifndef AVATAR_STORE_H
+#define AVATAR_STORE_H
+
+// Channel avatars kept in their own flash partition ("assets") instead of
+// in the app image. scripts/pics_build.py writes the partition contents to
+// data/assets.bin: a header, an index sorted by channel id and the pics,
+// packed (PicDecoder.h), with a palette (PaletteDecoder.h) or as RGB565 in
+// wire order. The partition is mapped into the address space, so raw pics
+// are sent straight from flash and the others are decoded from there
+// without a file system.
+//
+// draw() expands palette avatars straight into the line buffers. Packed
+// avatars used last are kept decoded in a few RAM tiles, so drawing a hot
+// avatar again is only a copy into the line buffers. A tile is only
+// allocated once it is needed, with palette pics none are.
+//
+// The partition has the spiffs subtype, so an OTA filesystem update
+// (`pio run -t uploadassets`) replaces the avatars without touching the app.
+
+#include <Arduino.h>
+
+#include "MappedPartition.h"
+#include "PicDecoder.h"
+#include "PaletteDecoder.h"
+#include <new>
+
+// Edge length of an avatar, has to match size in the [pics] section
+#define AVATAR_SIZE 64
+// Decoded packed avatars kept in RAM, 8 KB each
+#define AVATAR_CACHE_TILES 6
+#define AVATAR_PARTITION "assets"
+
+class AvatarStore {
+  public:
+    static const uint32_t PIXELS = AVATAR_SIZE*AVATAR_SIZE;
+    static const uint8_t VERSION = 1;
+    static const uint8_t FORMAT_RAW = 0;
+    static const uint8_t FORMAT_PACKED = 1;
+    static const uint8_t FORMAT_PALETTE = 2;
+
+    // Little endian, as written by pics_build.py
+    struct Header {
+      char magic[4];    // "TDAS"
+      uint8_t version;
+      uint8_t picSize;
+      uint16_t count;   // index entries
+      uint32_t length;  // bytes after the header
+      uint32_t crc;     // CRC-32 of those bytes
+    };
+    struct Entry {
+      char id[12];      // channel id, zero padded
+      uint32_t offset;  // from the start of the partition
+      uint16_t length;
+      uint8_t format;
+      uint8_t reserved;
+    };
+
+    struct Stats {
+      uint32_t mapped;  // raw avatars sent straight from flash
+      uint32_t expanded; // palette avatars drawn from flash
+      uint32_t hits;
+      uint32_t loads;
+      uint32_t failed;  // not in the index
+      uint32_t loadMicros;
+      uint32_t tileBytes; // RAM of the allocated tiles
+    };
+
+    ~AvatarStore(){
+      for (Tile& tile : tiles) delete[] tile.pixels;
+    }
+
+    // Maps the partition and checks the blob in it. Without a valid one
+    // every get() returns nullptr.
+    bool begin(){
+      end();
+      if (!partition.begin(AVATAR_PARTITION)) return false;
+      base = partition.data();
+      if (!check(partition.size())) {
+        end();
+        return false;
+      }
+      clear();
+      return true;
+    }
+
+    // Unmaps the partition, e.g. before an update rewrites it
+    void end(){
+      partition.end();
+      base = nullptr;
+      index = nullptr;
+      count = 0;
+    }
+
+    // Wire order pixels of the avatar of channel id, nullptr if there is
+    // none. Valid until the next call.
+    const uint8_t* get(const char* id){
+      const Entry* e = find(id);
+      if (!e) {
+        st.failed++;
+        return nullptr;
+      }
+      if (e->format == FORMAT_RAW) {
+        st.mapped++;
+        return base + e->offset;
+      }
+
+      uint16_t entry = e - index;
+      Tile* victim = &tiles[0];
+      for (Tile& tile : tiles) {
+        if (tile.used && tile.entry == entry) {
+          tile.used = ++clock;
+          st.hits++;
+          return (const uint8_t*)tile.pixels;
+        }
+        if (tile.used < victim->used) victim = &tile;
+      }
+      if (!victim->pixels) {
+        victim->pixels = new (std::nothrow) uint16_t[PIXELS];
+        if (!victim->pixels) return nullptr;
+        st.tileBytes += PIXELS*2;
+      }
+      unsigned long t = micros();
+      if (e->format == FORMAT_PACKED) {
+        PicDecoder(base + e->offset).decode(victim->pixels, PIXELS);
+      } else {
+        PaletteDecoder(base + e->offset).decode(victim->pixels, PIXELS);
+      }
+      st.loadMicros += micros() - t;
+      st.loads++;
+      victim->entry = entry;
+      victim->used = ++clock;
+      return (const uint8_t*)victim->pixels;
+    }
+
+    // Draws the avatar of channel id with its top left corner at x, y.
+    // False if there is none.
+    template<typename Queue>
+    bool draw(Queue& queue, int16_t x, int16_t y, const char* id){
+      const Entry* e = find(id);
+      if (e && e->format == FORMAT_PALETTE) {
+        PaletteDecoder pic(base + e->offset);
+        queue.setAddrWindow(x, y, AVATAR_SIZE, AVATAR_SIZE);
+        queue.writeFrom(pic, PIXELS);
+        st.expanded++;
+        return true;
+      }
+      const uint8_t* pic = get(id);
+      if (!pic) return false;
+      queue.drawRawBitmap(x, y, pic, AVATAR_SIZE, AVATAR_SIZE);
+      return true;
+    }
+
+    // Forget all decoded avatars
+    void clear(){
+      for (Tile& tile : tiles) tile.used = 0;
+    }
+
+    uint16_t size() const { return count; }
+    const Stats& stats() const { return st; }
+    void resetStats(){
+      uint32_t tileBytes = st.tileBytes;
+      st = Stats();
+      st.tileBytes = tileBytes;
+    }
+
+    // Same as zlib's crc32()
+    static uint32_t crc32(const uint8_t* data, uint32_t len){
+      uint32_t crc = 0xFFFFFFFF;
+      while (len--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+      }
+      return ~crc;
+    }
+
+  private:
+    struct Tile {
+      uint16_t entry;
+      uint32_t used;  // clock of the last get(), 0 when empty
+      uint16_t* pixels;  // allocated on first use
+    };
+
+    // Header, CRC and every index entry, so get() can trust them
+    bool check(uint32_t size){
+      Header h;
+      if (size < sizeof(h)) return false;
+      memcpy(&h, base, sizeof(h));
+      if (memcmp(h.magic, "TDAS", 4) != 0 || h.version != VERSION || h.picSize != AVATAR_SIZE) return false;
+      if (h.length > size - sizeof(h) || (uint32_t)h.count*sizeof(Entry) > h.length) return false;
+      if (crc32(base + sizeof(h), h.length) != h.crc) return false;
+
+      const Entry* entries = (const Entry*)(base + sizeof(h));
+      for (uint16_t i = 0; i < h.count; i++) {
+        const Entry& e = entries[i];
+        if (e.id[sizeof(e.id)-1] != '\0') return false;
+        uint32_t end = sizeof(h) + h.length;
+        if (e.offset < sizeof(h) || e.offset > end || e.length > end - e.offset) return false;
+        switch (e.format) {
+          case FORMAT_RAW: if (e.length != PIXELS*2) return false; break;
+          case FORMAT_PACKED: break;
+          case FORMAT_PALETTE:
+            if (e.offset % 2 || !PaletteDecoder::valid(base + e.offset, e.length, PIXELS)) return false;
+            break;
+          default: return false;
+        }
+      }
+      index = entries;
+      count = h.count;
+      return true;
+    }
+
+    const Entry* find(const char* id) const {
+      uint16_t lo = 0, hi = count;
+      while (lo < hi) {
+        uint16_t mid = (lo + hi)/2;
+        int c = strncmp(id, index[mid].id, sizeof(index[mid].id));
+        if (c == 0) return &index[mid];
+        if (c < 0) hi = mid;
+        else lo = mid + 1;
+      }
+      return nullptr;
+    }
+
+    MappedPartition partition;
+    const uint8_t* base = nullptr;
+    const Entry* index = nullptr;
+    uint16_t count = 0;
+    Tile tiles[AVATAR_CACHE_TILES] = {};
+    uint32_t clock = 0;
+    Stats st = {};
+};
+
+#endif
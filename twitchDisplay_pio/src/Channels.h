@@ -0,0 +1,39 @@
+#ifndef CHANNELS_H
+#define CHANNELS_H
+
+#include <Arduino.h>
+#include <array>
+#include <bitset>
+#include <deque>
+#include <string>
+
+struct channelInfo {
+  std::string id;
+  bool isLive;
+  std::string streamTitle;
+  int8_t slotNum;
+};
+
+// lidi, pietsmiet, bonjwa, bonjwachill, gronkh, dhalucard, trilluxe, dracon, maxim, finanzfluss
+std::array<channelInfo, 10> channels = {{
+  {"761017145", false, "", -1},
+  {"21991090", false, "", -1},
+  {"73437396", false, "", -1},
+  {"1024088182", false, "", -1},
+  {"12875057", false, "", -1},
+//  {"106159308", false, "", -1}, gronkhtv
+  {"16064695", false, "", -1},
+  {"55898523", false, "", -1},
+  {"38770961", false, "", -1},
+  {"172376071", false, "", -1},
+  {"549536744", false, "", -1}
+}};
+
+// A set of channels, bit i for channels[i]
+typedef std::bitset<std::tuple_size<decltype(channels)>::value> channelSet;
+
+uint16_t live_num = 0;
+
+std::deque<channelInfo*> titleChangeQueue;
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef DEBUG_H
+#define DEBUG_H
+
+// PROGMEM and F() are pointless in ESP32
+static const char DEBUG_TAG[] = "TwitchDisplay";
+// inspiration from https://forum.arduino.cc/t/single-line-define-to-disable-code/636044/5
+
+#define SERIAL_PORT Serial
+#define USE_SERIAL true
+#define DEBUG_ERROR true
+#define DEBUG_WARNING true
+#define DEBUG_INFO true
+#define S if(USE_SERIAL)SERIAL_PORT
+#define DEBUG_E if(DEBUG_ERROR)SERIAL_PORT
+#define DEBUG_W if(DEBUG_WARNING)SERIAL_PORT
+#define DEBUG_I if(DEBUG_INFO)SERIAL_PORT
+
+#endif
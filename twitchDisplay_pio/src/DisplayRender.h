@@ -0,0 +1,361 @@
+#ifndef DISPLAY_RENDER_H
+#define DISPLAY_RENDER_H
+
+// Everything that draws to the panel. Shared by the firmware and the native
+// simulation ([env:native]) so rendering can be measured without a board.
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>    // Core graphics library
+#include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
+
+#include "Debug.h"
+#include "Channels.h"
+#include "TftDmaQueue.h"
+#include "FramePacer.h"
+#include "Scene.h"
+#include "AvatarStore.h"
+#include "AvatarCache.h"
+
+#define MAX_TITLE_REPEAT 2
+
+// Text size of the scrolling title, glyphs are 6x8 cells scaled up by this
+#define TICKER_SCALE 8
+#define TICKER_COLOR ST77XX_CYAN
+// Scroll speed in pixels per second
+#define TICKER_SPEED 360
+// Pixels the title moves per frame. Has to divide TICKER_SCALE so every
+// glyph pixel stays on screen for the same time. Since only changed columns
+// are sent, a smaller step costs about the same bandwidth at the same speed.
+#define TICKER_PIXEL_STEP 4
+#define TICKER_FPS ((float)TICKER_SPEED/TICKER_PIXEL_STEP)
+// Stream the ticker column by column with MADCTL_MV cleared and only send
+// the columns that changed since the last frame. Set to false for the
+// plain row by row blit.
+#define TICKER_COLUMN_MAJOR true
+
+// The 170 pixel panel sits in the middle of the 240 pixel wide controller
+// memory, Adafruit_ST7789 adds this to y in setAddrWindow()
+#define TFT_COLSTART 35
+// Rotation 1 is MY|MV. Without MV the column address runs along y, so the
+// controller fills its memory column by column.
+#define TFT_MADCTL_ROTATION1 (ST77XX_MADCTL_MY | ST77XX_MADCTL_MV | ST77XX_MADCTL_RGB)
+#define TFT_MADCTL_COLUMNS (ST77XX_MADCTL_MY | ST77XX_MADCTL_RGB)
+
+static_assert(TICKER_SCALE % TICKER_PIXEL_STEP == 0, "TICKER_PIXEL_STEP has to divide TICKER_SCALE");
+static_assert(AVATAR_SIZE == SLOT_SIZE, "avatars have to fill a slot");
+
+// Defined by whoever includes this file
+extern Adafruit_ST7789 tft;
+
+// All drawing goes through here once tft has initialized the panel
+TftDmaQueue tftQueue(tft, 0, TFT_COLSTART);
+FramePacer tickerPacer(TICKER_FPS);
+AvatarStore avatars;
+// Downloaded avatars, preferred over the ones in avatars
+AvatarCache avatarCache;
+
+// Only for generated tiles like "+N", pics come from avatars
+GFXcanvas16 pic_canvas(64, 64); // 16-bit, 64x64 pixels
+// Scratch space to rasterize one size 1 glyph of the title
+GFXcanvas1 glyph_canvas(6, 8);
+
+struct {
+  channelInfo* channel;
+  // The title rendered once at text size 1, one byte per pixel column
+  // with the top row in bit 0. Scaled up by TICKER_SCALE when sent.
+  std::vector<uint8_t> columns;
+  uint16_t scrollX;
+  uint8_t repeats;
+  uint16_t frames;
+  TftDmaQueue::Stats statsAtStart; // to log what the whole title cost
+} channelTitleInfo;
+
+bool isTitleDisplaying = false;
+
+// What should be on the panel and what was last sent to it, see commitScene()
+Scene scene = blankScene();
+Scene shownScene = blankScene();
+
+// Pixel masks of the ticker columns currently on the panel
+uint64_t tickerShownColumns[TICKER_W];
+bool tickerShownValid = false;
+
+// Call after tftQueue.begin()
+void setupRender(){
+  if(avatars.begin()){
+    DEBUG_I.printf("[%s] %u channel pics in the %s partition\n", DEBUG_TAG, avatars.size(), AVATAR_PARTITION);
+  } else {
+    DEBUG_E.printf("[%s] No valid %s partition, channel pics stay blank\n", DEBUG_TAG, AVATAR_PARTITION);
+  }
+  if(avatarCache.begin()){
+    DEBUG_I.printf("[%s] %u of %u avatar slots in the %s partition used\n", DEBUG_TAG,
+      avatarCache.size(), avatarCache.capacity(), AVATAR_CACHE_PARTITION);
+  } else {
+    DEBUG_E.printf("[%s] No %s partition, avatars are not downloaded\n", DEBUG_TAG, AVATAR_CACHE_PARTITION);
+  }
+  tftQueue.fillRect(0, 0, tft.width(), tft.height(), ST77XX_BLACK);
+  scene = shownScene = blankScene();
+}
+
+void renderTitleStrip(const std::string& title){
+  std::vector<uint8_t>& columns = channelTitleInfo.columns;
+  columns.assign(title.length()*6, 0);
+  for (std::size_t i = 0; i < title.length(); i++) {
+    glyph_canvas.fillScreen(0);
+    glyph_canvas.drawChar(0, 0, title[i], 1, 0, 1);
+    for (int16_t c = 0; c < 6; c++) {
+      for (int16_t r = 0; r < 8; r++) {
+        if (glyph_canvas.getPixel(c, r)) columns[i*6+c] |= 1 << r;
+      }
+    }
+  }
+}
+
+// Pixel mask (top row in bit 0) of column x of the scaled up title strip
+uint64_t tickerColumnMask(uint16_t x){
+  std::size_t col = x/TICKER_SCALE;
+  if (col >= channelTitleInfo.columns.size()) return 0;
+  uint8_t bits = channelTitleInfo.columns[col];
+  uint64_t mask = 0;
+  for (uint8_t r = 0; r < 8; r++) {
+    if (bits & (1 << r)) mask |= (((uint64_t)1 << TICKER_SCALE) - 1) << (r*TICKER_SCALE);
+  }
+  return mask;
+}
+
+void drawTickerRows(int16_t x, int16_t y, uint16_t scroll_x, int16_t w) {
+  tftQueue.setAddrWindow(x, y, w, TICKER_H);
+  for (int16_t j = 0; j < TICKER_H; j++) {
+    for (int16_t c = 0; c < w; c++) {
+      tftQueue.writeBits(tickerColumnMask(scroll_x+c) >> j, 1, TICKER_COLOR, ST77XX_BLACK);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Draw the title strip column by column, skipping the columns
+            that already show the same pixels
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    scroll_x  Column of the scaled up title shown at x
+    @param    w   Width in pixels
+    @return   Number of pixel bytes sent
+*/
+/**************************************************************************/
+uint32_t drawTickerColumns(int16_t x, int16_t y, uint16_t scroll_x, int16_t w) {
+  const int16_t h = TICKER_H;
+  uint32_t sent = 0;
+  bool flipped = false;
+
+  for (int16_t c = 0; c < w;) {
+    uint64_t mask = tickerColumnMask(scroll_x+c);
+    if (tickerShownValid && tickerShownColumns[c] == mask) {
+      c++;
+      continue;
+    }
+    int16_t end = c;
+    do {
+      tickerShownColumns[end++] = mask;
+      if (end == w) break;
+      mask = tickerColumnMask(scroll_x+end);
+    } while (!tickerShownValid || tickerShownColumns[end] != mask);
+
+    if (!flipped) {
+      const uint8_t madctl = TFT_MADCTL_COLUMNS;
+      tftQueue.command(ST77XX_MADCTL);
+      tftQueue.data(&madctl, 1);
+      flipped = true;
+    }
+    tftQueue.setAddrWindowColumns(x+c, y, end-c, h);
+    for (; c < end; c++) {
+      tftQueue.writeBits(tickerShownColumns[c], h, TICKER_COLOR, ST77XX_BLACK);
+      sent += h*2;
+    }
+  }
+  if (flipped) {
+    const uint8_t madctl = TFT_MADCTL_ROTATION1;
+    tftQueue.command(ST77XX_MADCTL);
+    tftQueue.data(&madctl, 1);
+  }
+  tickerShownValid = true;
+  return sent;
+}
+
+void drawSlotPic(const SceneRect& r, const SlotScene& slot){
+  if(slot.overflow){
+    pic_canvas.fillScreen(ST77XX_BLACK);
+    pic_canvas.setCursor(4, 14);
+    pic_canvas.setTextSize(5);
+    pic_canvas.printf("+%d", slot.overflow);
+    tftQueue.drawRGBBitmap(r.x, r.y, pic_canvas.getBuffer(), pic_canvas.width(), pic_canvas.height());
+    return;
+  }
+  const uint8_t* pic = slot.avatar ? avatarCache.get(slot.avatar) : nullptr;
+  if(pic){
+    tftQueue.drawRawBitmap(r.x, r.y, pic, SLOT_SIZE, SLOT_SIZE);
+  } else if(!slot.avatar || !avatars.draw(tftQueue, r.x, r.y, slot.avatar)){
+    tftQueue.fillRect(r.x, r.y, r.w, r.h, ST77XX_BLACK);
+  }
+}
+
+// Sends what differs between scene and shownScene as one frame.
+// Returns the number of pixel bytes sent.
+uint32_t commitScene(){
+  static SceneUpdate updates[SCENE_MAX_UPDATES];
+  uint8_t n = diffScene(shownScene, scene, updates);
+
+  tftQueue.startFrame();
+  uint32_t sent = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    const SceneUpdate& u = updates[i];
+    switch(u.item){
+      case SCENE_SLOT_PIC:
+        drawSlotPic(u.rect, scene.slots[u.slot]);
+        sent += SLOT_PIC_BYTES;
+        break;
+      case SCENE_BORDER:
+        tftQueue.fillRect(u.rect.x, u.rect.y, u.rect.w, u.rect.h, scene.slots[u.slot].border);
+        sent += u.rect.w*u.rect.h*2;
+        break;
+      case SCENE_TICKER:
+        // the columns drawn before are only still there if the band stayed
+        if (shownScene.tickerRow != scene.tickerRow) tickerShownValid = false;
+        if (TICKER_COLUMN_MAJOR) {
+          sent += drawTickerColumns(u.rect.x, u.rect.y, scene.tickerScroll, u.rect.w);
+        } else {
+          drawTickerRows(u.rect.x, u.rect.y, scene.tickerScroll, u.rect.w);
+          sent += u.rect.w*u.rect.h*2;
+        }
+        break;
+    }
+  }
+  tftQueue.flush();
+  shownScene = scene;
+  return sent;
+}
+
+// Repaints the slots showing channel id after its avatar changed
+void avatarChanged(const char* id){
+  for (uint8_t i = 0; i < MAX_NUM_PICS; i++) {
+    const char* shown = shownScene.slots[i].avatar;
+    if (shown && strcmp(shown, id) == 0) shownScene.slots[i].avatar = nullptr;
+  }
+  commitScene();
+}
+
+void redrawLiveChannelPics(){
+  uint64_t overdraw = tftQueue.stats().overdrawPixels;
+  uint32_t loads = avatars.stats().loads;
+
+  std::size_t i=0;
+  for (channelInfo& channel : channels) {
+    if(channel.isLive) i++;
+    else channel.slotNum = -1;
+  }
+  // the last slot turns into a "+N" tile if not all live channels fit
+  uint8_t pic_slots = (i>MAX_NUM_PICS)?MAX_NUM_PICS-1:MAX_NUM_PICS;
+
+  // live channels keep their slot, the new ones and the ones behind the
+  // "+N" tile take the free slots from the left, the rest count on behind it
+  bool taken[MAX_NUM_PICS] = {};
+  for (channelInfo& channel : channels) {
+    if(!channel.isLive) continue;
+    if(channel.slotNum>=0 && channel.slotNum<pic_slots && !taken[channel.slotNum]){
+      taken[channel.slotNum] = true;
+    } else {
+      channel.slotNum = -1;
+    }
+  }
+  uint8_t free_slot = 0, hidden = pic_slots;
+  for (channelInfo& channel : channels) {
+    if(!channel.isLive || channel.slotNum>=0) continue;
+    while(free_slot<pic_slots && taken[free_slot]) free_slot++;
+    if(free_slot<pic_slots){
+      channel.slotNum = free_slot;
+      taken[free_slot] = true;
+    } else {
+      channel.slotNum = hidden++;
+    }
+  }
+
+  for (SlotScene& slot : scene.slots) {
+    slot.avatar = nullptr;
+    slot.overflow = 0;
+  }
+  for (channelInfo& channel : channels) {
+    if(channel.isLive && channel.slotNum<pic_slots){
+      scene.slots[channel.slotNum].avatar = channel.id.c_str();
+    }
+  }
+  if(i>MAX_NUM_PICS){
+    scene.slots[MAX_NUM_PICS-1].overflow = i-(MAX_NUM_PICS-1);
+  }
+  uint32_t sent = commitScene();
+
+  const uint32_t full = MAX_NUM_PICS*(SLOT_PIC_BYTES+SLOT_BORDER_BYTES);
+  DEBUG_I.printf("[%s] Redrew live channel pics: %u bytes sent, %u bytes saved, %u pixels overdrawn, %u avatars loaded\n", DEBUG_TAG,
+    sent, full-sent, (uint32_t)(tftQueue.stats().overdrawPixels - overdraw), avatars.stats().loads - loads);
+}
+
+// Advances the scrolling title of the channel at the front of
+// titleChangeQueue when its next frame is due. Call once per loop().
+// Returns true if a frame was sent.
+bool updateTitleTicker(){
+  if(!isTitleDisplaying && !titleChangeQueue.empty()) {
+    channelTitleInfo.channel = titleChangeQueue.front();
+    titleChangeQueue.pop_front();
+    renderTitleStrip(channelTitleInfo.channel->streamTitle);
+    channelTitleInfo.scrollX = 0;
+    channelTitleInfo.repeats = 0;
+    channelTitleInfo.frames = 0;
+    channelTitleInfo.statsAtStart = tftQueue.stats();
+    isTitleDisplaying = true;
+    tickerPacer.restart();
+  }
+  // TODO: cleanup text when done
+  if(!isTitleDisplaying) return false;
+
+  // one TICKER_PIXEL_STEP per frame period, periods the loop was too busy
+  // for are caught up in one bigger step to keep the speed
+  uint8_t steps = tickerPacer.due();
+  if(!steps) return false;
+
+  // highlight the channel and run the ticker over the other row of slots
+  int8_t slot_num = channelTitleInfo.channel->slotNum;
+  if (slot_num>MAX_NUM_PICS-1) slot_num = MAX_NUM_PICS-1;
+  for (uint8_t i = 0; i < MAX_NUM_PICS; i++) {
+    scene.slots[i].border = (i==slot_num)?ST77XX_GREEN:ST77XX_BLACK;
+  }
+  scene.tickerRow = (channelTitleInfo.channel->slotNum>=SLOTS_PER_ROW)?0:1;
+  scene.tickerScroll = channelTitleInfo.scrollX;
+  commitScene();
+  channelTitleInfo.frames++;
+  channelTitleInfo.scrollX += steps*TICKER_PIXEL_STEP;
+
+  // start over once the last five characters have scrolled in
+  std::size_t title_len = channelTitleInfo.columns.size()/6;
+  uint16_t wrap_x = ((title_len>5)?title_len-5:1)*6*TICKER_SCALE;
+  if (channelTitleInfo.scrollX >= wrap_x) {
+    channelTitleInfo.scrollX = 0;
+    if(++channelTitleInfo.repeats==MAX_TITLE_REPEAT){
+      const TftDmaQueue::Stats& st = tftQueue.stats();
+      DEBUG_I.printf("[%s] Title ticker done: %u frames, %u bytes sent, %u pixels overdrawn\n", DEBUG_TAG,
+        channelTitleInfo.frames, (uint32_t)(st.bytes - channelTitleInfo.statsAtStart.bytes),
+        (uint32_t)(st.overdrawPixels - channelTitleInfo.statsAtStart.overdrawPixels));
+      DEBUG_I.printf("[%s] Title ticker pacing: %.1f of %.1f fps, %.0f us jitter, %u merged, %u dropped\n", DEBUG_TAG,
+        tickerPacer.fps(), TICKER_FPS, tickerPacer.jitterMicros(),
+        tickerPacer.stats().merged, tickerPacer.stats().dropped);
+      isTitleDisplaying=false;
+      tickerPacer.stop();
+      scene.tickerRow = -1;
+      for (SlotScene& slot : scene.slots) {
+        slot.border = ST77XX_BLACK;
+      }
+      redrawLiveChannelPics();
+    }
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,425 @@
+#ifndef EVENTSUB_H
+#define EVENTSUB_H
+
+// Twitch EventSub over a WebSocket, so a channel going live, going offline or
+// changing its title shows up within a second instead of at the next poll.
+// The WebSocket, its TLS connects included, runs on the live poll task
+// (LivePoller.h) between polls, so a handshake does not hold the ticker up;
+// what it reports is queued and applied by EventSubClient::apply() in loop()
+// (LiveSet.h). The subscriptions are helix requests, they are made on the
+// same task after every welcome, which then polls for what happened while
+// there was no session. The polls stay:
+// they bring the titles of streams that just went live and catch up on
+// anything EventSub could not be subscribed for.
+//
+// A WebSocket session may only have subscriptions of a total cost of 10, and
+// one for a channel that is not the token's costs 1. So stream.online goes
+// first for every channel, then stream.offline, then channel.update, until
+// helix answers that the cost is used up.
+//
+// EventSub sends a keepalive whenever there was nothing else for
+// keepalive_timeout_seconds; without any message for longer the session is
+// taken as lost and a new one is started. A session_reconnect is followed on
+// a second WebSocket, which takes over with the subscriptions once it got its
+// welcome.
+//
+// https://dev.twitch.tv/docs/eventsub/handling-websocket-events/
+
+#include <Arduino.h>
+#include <WebSocketsClient.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Debug.h"
+#include "Channels.h"
+#include "EventSubMessage.h"
+#include "HelixClient.h"
+#include "LivePoller.h"
+#include "LiveSet.h"
+#include "SpscQueue.h"
+
+#ifndef EVENTSUB_URL
+#define EVENTSUB_URL "wss://eventsub.wss.twitch.tv/ws"
+#endif
+// Seconds without a message after which EventSub sends a keepalive, 10 to 600
+#ifndef EVENTSUB_KEEPALIVE_S
+#define EVENTSUB_KEEPALIVE_S 10
+#endif
+// How late a keepalive may be before the session is taken as lost
+#define EVENTSUB_KEEPALIVE_SLACK_MS 3000
+// Wait between attempts to connect
+#define EVENTSUB_RETRY_MS 2000
+// Message ids kept to drop notifications EventSub sends again
+#define EVENTSUB_SEEN_IDS 16
+
+struct eventSubType {
+  const char* type;
+  const char* version;
+};
+
+// In the order they are subscribed, most wanted first
+static const eventSubType eventSubTypes[] = {
+  {"stream.online", "1"},
+  {"stream.offline", "1"},
+  {"channel.update", "2"},
+};
+#define EVENTSUB_TYPES (sizeof(eventSubTypes)/sizeof(eventSubTypes[0]))
+
+// wss://host[:port]/path or ws://...
+struct eventSubUrl {
+  bool ssl;
+  String host;
+  uint16_t port;
+  String path;
+};
+
+bool parseEventSubUrl(const String& url, eventSubUrl& parsed){
+  size_t start;
+  if (url.startsWith("wss://")) {
+    parsed.ssl = true;
+    start = 6;
+  } else if (url.startsWith("ws://")) {
+    parsed.ssl = false;
+    start = 5;
+  } else {
+    return false;
+  }
+  int slash = url.indexOf('/', start);
+  String hostPort = slash < 0 ? url.substring(start) : url.substring(start, slash);
+  parsed.path = slash < 0 ? String("/") : url.substring(slash);
+  int colon = hostPort.indexOf(':');
+  parsed.host = colon < 0 ? hostPort : hostPort.substring(0, colon);
+  parsed.port = colon < 0 ? (parsed.ssl ? 443 : 80) : hostPort.substring(colon + 1).toInt();
+  return parsed.host.length() && parsed.port;
+}
+
+class EventSubClient {
+  public:
+    // Written by the poll task
+    struct Stats {
+      std::atomic<uint32_t> sessions{0};          // welcomes of new sessions
+      std::atomic<uint32_t> reconnects{0};        // session_reconnects followed
+      std::atomic<uint32_t> notifications{0};
+      std::atomic<uint32_t> duplicates{0};        // notifications dropped as sent before
+      std::atomic<uint32_t> keepaliveTimeouts{0};
+      std::atomic<uint32_t> revocations{0};
+    };
+
+    // Has the WebSocket run and the subscriptions made on the live poll
+    // task, call it before livePoller.begin()
+    void begin(){
+      for (uint8_t i = 0; i < 2; i++) {
+        sockets[i].onEvent([this, i](WStype_t type, uint8_t* payload, size_t length){ onEvent(i, type, payload, length); });
+        sockets[i].setReconnectInterval(EVENTSUB_RETRY_MS);
+      }
+      livePoller.beforePoll([this]{ subscribe(); });
+      livePoller.betweenPolls([this]{ loop(); });
+    }
+
+    // Shows what the notifications since the last call reported, call it
+    // from loop()
+    void apply(){
+      std::vector<liveEvent> events;
+      liveEvent event;
+      while (notified.pop(event)) {
+        if (event.type == TitleChanged) {
+          holdTitle(event.channel);
+        } else {
+          holdLive(event.channel);
+          // the title comes with the next poll
+          if (event.type == WentLive && channels[event.channel].isLive) continue;
+        }
+        events.push_back(std::move(event));
+      }
+      applyLiveEvents(events);
+    }
+
+    // Whether there is a session and it got all the subscriptions it could
+    bool ready(){
+      std::lock_guard<std::mutex> lock(sessionLock);
+      return hasSession && doneSession == sessionId;
+    }
+
+    const Stats& getStats() const { return stats; }
+
+    // Subscriptions of the current session and how many of them helix
+    // took, written by the poll task
+    uint32_t subscriptions() const { return subscribedCount; }
+    bool costUsedUp() const { return costFull; }
+
+  private:
+    static String defaultUrl(){
+      return String(EVENTSUB_URL "?keepalive_timeout_seconds=") + String(EVENTSUB_KEEPALIVE_S);
+    }
+
+    // On the poll task, between polls
+    void loop(){
+      unsigned long now = millis();
+      if (!connected) {
+        connected = true;
+        connect(active, defaultUrl());
+      }
+      // a poll or the subscriptions held the task up, not the session
+      if (now - lastLoop > EVENTSUB_KEEPALIVE_SLACK_MS) lastMessage = now;
+      lastLoop = now;
+      // before the library reconnects to the URL it had
+      if (restart) {
+        restart = false;
+        connect(active, defaultUrl());
+      }
+      // EventSub closes the old connection once it sent the welcome on the
+      // new one
+      if (pending >= 0) sockets[pending].loop();
+      if (!activeGone) sockets[active].loop();
+      if (hasSession && millis() - lastMessage > keepaliveS * 1000UL + EVENTSUB_KEEPALIVE_SLACK_MS) {
+        DEBUG_W.printf("[%s] EventSub: nothing for %lu ms, starting a new session\n", DEBUG_TAG, millis() - lastMessage);
+        stats.keepaliveTimeouts++;
+        dropPending();
+        // the session goes and with it the subscriptions
+        sockets[active].disconnect();
+      }
+    }
+
+    void connect(uint8_t socket, const String& url){
+      eventSubUrl parsed;
+      if (!parseEventSubUrl(url, parsed)) {
+        DEBUG_E.printf("[%s] EventSub: cannot connect to %s\n", DEBUG_TAG, url.c_str());
+        return;
+      }
+      DEBUG_I.printf("[%s] EventSub: connecting to %s\n", DEBUG_TAG, url.c_str());
+      if (parsed.ssl) {
+        sockets[socket].beginSSL(parsed.host.c_str(), parsed.port, parsed.path.c_str());
+      } else {
+        sockets[socket].begin(parsed.host.c_str(), parsed.port, parsed.path.c_str());
+      }
+      onDefault[socket] = url == defaultUrl();
+      if (socket == active) lastMessage = millis();
+    }
+
+    void dropPending(){
+      int8_t socket = pending;
+      pending = -1;
+      if (socket >= 0) sockets[socket].disconnect();
+    }
+
+    void onEvent(uint8_t socket, WStype_t type, uint8_t* payload, size_t length){
+      switch (type) {
+        case WStype_DISCONNECTED:
+          if (socket == pending) {
+            pending = -1;
+            if (!activeGone) {
+              DEBUG_W.printf("[%s] EventSub: could not follow the reconnect, staying\n", DEBUG_TAG);
+              break;
+            }
+          }
+          if (socket == active && pending >= 0) {
+            // the welcome on the new connection takes over
+            activeGone = true;
+          } else if (socket == active || activeGone) {
+            bool gone = activeGone;
+            activeGone = false;
+            if (hasSession) DEBUG_W.printf("[%s] EventSub: session lost\n", DEBUG_TAG);
+            setSession("", false);
+            dropPending();
+            // reconnect_url is only good once, on the default one the
+            // library tries again on its own
+            if (gone || !onDefault[active]) restart = true;
+          }
+          break;
+        case WStype_CONNECTED:
+          DEBUG_I.printf("[%s] EventSub: connected\n", DEBUG_TAG);
+          break;
+        case WStype_TEXT:
+          onMessage(socket, payload, length);
+          break;
+        default:
+          break;
+      }
+    }
+
+    void onMessage(uint8_t socket, const uint8_t* payload, size_t length){
+      // only the poll task gets here
+      static eventSubMessage message;
+      if (!readEventSubMessage(payload, length, message)) {
+        DEBUG_W.printf("[%s] EventSub: malformed message of %u bytes\n", DEBUG_TAG, (uint32_t)length);
+        return;
+      }
+      if (socket == active) lastMessage = millis();
+
+      if (strcmp(message.messageType, "session_welcome") == 0) {
+        keepaliveS = message.keepaliveS ? message.keepaliveS : EVENTSUB_KEEPALIVE_S;
+        lastMessage = millis();
+        if (socket == pending) {
+          // the subscriptions came along
+          DEBUG_I.printf("[%s] EventSub: reconnected to session %s\n", DEBUG_TAG, message.sessionId);
+          uint8_t old = active;
+          active = socket;
+          pending = -1;
+          activeGone = false;
+          stats.reconnects++;
+          setSession(message.sessionId, false);
+          sockets[old].disconnect();
+        } else {
+          DEBUG_I.printf("[%s] EventSub: session %s\n", DEBUG_TAG, message.sessionId);
+          stats.sessions++;
+          setSession(message.sessionId, true);
+          // subscribes, then catches up with a poll
+          livePoller.pollNow();
+        }
+      } else if (strcmp(message.messageType, "session_reconnect") == 0) {
+        if (socket != active || pending >= 0) return;
+        DEBUG_I.printf("[%s] EventSub: asked to reconnect\n", DEBUG_TAG);
+        pending = !active;
+        connect(pending, message.reconnectUrl);
+      } else if (strcmp(message.messageType, "notification") == 0) {
+        if (seenBefore(message.messageId)) {
+          stats.duplicates++;
+          return;
+        }
+        stats.notifications++;
+        onNotification(message);
+      } else if (strcmp(message.messageType, "revocation") == 0) {
+        // polls still cover the channel
+        DEBUG_W.printf("[%s] EventSub: %s of %s revoked (%s)\n", DEBUG_TAG,
+          message.subscriptionType, message.userId, message.status);
+        stats.revocations++;
+      }
+    }
+
+    void onNotification(const eventSubMessage& message){
+      auto channel = std::find_if(channels.begin(), channels.end(), [&](const channelInfo& x){return x.id == message.userId;});
+      if (channel == channels.end()) {
+        DEBUG_W.printf("[%s] EventSub reported unknown channel id %s\n", DEBUG_TAG, message.userId);
+        return;
+      }
+      uint8_t index = channel - channels.begin();
+      liveEvent event;
+      if (strcmp(message.subscriptionType, "stream.online") == 0) {
+        event = {WentLive, index, std::string("    ") + message.userName + " is live   "};
+      } else if (strcmp(message.subscriptionType, "stream.offline") == 0) {
+        event = {WentOffline, index, ""};
+      } else if (strcmp(message.subscriptionType, "channel.update") == 0) {
+        event = {TitleChanged, index, std::string("    ") + message.title + " | " + message.categoryName + "   "};
+      } else {
+        return;
+      }
+      // the display state is loop()'s, apply() takes it from here
+      if (!notified.push(std::move(event))) {
+        DEBUG_W.printf("[%s] EventSub: notifications not taken, dropped %s of %s\n", DEBUG_TAG,
+          message.subscriptionType, message.userId);
+      }
+    }
+
+    // Whether a notification with this id came before, remembers it if not
+    bool seenBefore(const char* id){
+      // FNV-1a
+      uint32_t hash = 2166136261u;
+      for (const char* c = id; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619u;
+      for (uint32_t seen : seenIds) {
+        if (seen == hash) return true;
+      }
+      seenIds[seenNext] = hash;
+      seenNext = (seenNext + 1) % EVENTSUB_SEEN_IDS;
+      return false;
+    }
+
+    void setSession(const char* id, bool subscribe){
+      std::lock_guard<std::mutex> lock(sessionLock);
+      sessionId = id;
+      hasSession = *id;
+      if (subscribe) toSubscribe = true;
+    }
+
+    // On the poll task: makes the subscriptions of a new session, in the
+    // order of eventSubTypes and channels, until the cost is used up
+    void subscribe(){
+      std::string session;
+      {
+        std::lock_guard<std::mutex> lock(sessionLock);
+        if (!toSubscribe || sessionId.empty()) return;
+        toSubscribe = false;
+        session = sessionId;
+        if (subscribedSession != session) {
+          subscribedSession = session;
+          nextSubscription = 0;
+          subscribedCount = 0;
+          costFull = false;
+        }
+      }
+
+      const size_t total = EVENTSUB_TYPES * channels.size();
+      while (nextSubscription < total && !costFull) {
+        {
+          // a new session subscribes on its own
+          std::lock_guard<std::mutex> lock(sessionLock);
+          if (sessionId != session) return;
+        }
+        const eventSubType& type = eventSubTypes[nextSubscription / channels.size()];
+        const channelInfo& channel = channels[nextSubscription % channels.size()];
+        String body = String("{\"type\":\"") + type.type + "\",\"version\":\"" + type.version
+          + "\",\"condition\":{\"broadcaster_user_id\":\"" + channel.id.c_str()
+          + "\"},\"transport\":{\"method\":\"websocket\",\"session_id\":\"" + session.c_str() + "\"}}";
+        int code = helix.post("eventsub/subscriptions", body);
+        bool throttled = code == 429 && helix.rateLimit().known && helix.rateLimit().remaining == 0;
+        helix.end();
+
+        if (code == 202 || code == 409) {
+          // 409: it is there already
+          subscribedCount++;
+          nextSubscription++;
+        } else if (code == 429 && !throttled) {
+          DEBUG_W.printf("[%s] EventSub: cost used up after %u subscriptions, polls cover the rest\n", DEBUG_TAG, subscribedCount.load());
+          costFull = true;
+        } else if (code <= 0 || code == 429 || code >= 500) {
+          // again before the next poll
+          DEBUG_W.printf("[%s] EventSub: %s of %s failed with %d, trying again later\n", DEBUG_TAG, type.type, channel.id.c_str(), code);
+          std::lock_guard<std::mutex> lock(sessionLock);
+          if (sessionId == session) toSubscribe = true;
+          return;
+        } else {
+          DEBUG_W.printf("[%s] EventSub: helix refused %s of %s with %d\n", DEBUG_TAG, type.type, channel.id.c_str(), code);
+          nextSubscription++;
+        }
+      }
+      DEBUG_I.printf("[%s] EventSub: %u of %u subscriptions made\n", DEBUG_TAG, subscribedCount.load(), (uint32_t)total);
+      std::lock_guard<std::mutex> lock(sessionLock);
+      doneSession = session;
+    }
+
+    // poll task only
+    WebSocketsClient sockets[2];
+    uint8_t active = 0;
+    int8_t pending = -1;   // socket following a session_reconnect
+    bool activeGone = false; // closed, with a reconnect pending
+    bool onDefault[2] = {};
+    bool restart = false;  // connect the active socket to the default URL
+    bool connected = false; // the first connect was made
+    unsigned long lastMessage = 0;
+    unsigned long lastLoop = 0;
+    uint16_t keepaliveS = EVENTSUB_KEEPALIVE_S;
+    uint32_t seenIds[EVENTSUB_SEEN_IDS] = {};
+    uint8_t seenNext = 0;
+    Stats stats;
+
+    // the poll task pushes, apply() in loop() pops
+    SpscQueue<liveEvent, 8> notified;
+
+    // shared with loop()
+    std::mutex sessionLock;
+    std::string sessionId;
+    std::atomic<bool> hasSession{false};
+    bool toSubscribe = false;
+    std::string doneSession; // the last one that got its subscriptions
+
+    // poll task only, apart from the counters
+    std::string subscribedSession;
+    size_t nextSubscription = 0;
+    std::atomic<uint32_t> subscribedCount{0};
+    std::atomic<bool> costFull{false};
+};
+
+EventSubClient eventSub;
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef EVENTSUB_MESSAGE_H
+#define EVENTSUB_MESSAGE_H
+
+// Parsing of the messages EventSub sends over the WebSocket. Only the fields
+// below are kept, read with JsonTokenizer.h straight from the frame, so a
+// message needs no JsonDocument.
+//
+//   eventSubMessage message;
+//   readEventSubMessage(payload, length, message);
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "HelixStreams.h"
+#include "JsonTokenizer.h"
+
+// https://dev.twitch.tv/docs/eventsub/websocket-reference/
+struct eventSubMessage {
+  char messageId[40];
+  char messageType[24];      // session_welcome, session_keepalive, notification, ...
+  char subscriptionType[24]; // of a notification or revocation
+  char sessionId[128];
+  char reconnectUrl[256];
+  uint16_t keepaliveS;       // keepalive_timeout_seconds of a welcome
+  char status[40];           // of a revoked subscription
+  char userId[24];           // broadcaster_user_id of the event or the revoked subscription
+  char userName[100];
+  char title[STREAM_TITLE_MAX];
+  char categoryName[256];
+};
+
+// The message as a readBytes() input for JsonTokenizer
+struct eventSubPayload {
+  const uint8_t* p;
+  size_t left;
+  size_t readBytes(char* buf, size_t len){
+    len = std::min(len, left);
+    memcpy(buf, p, len);
+    p += len;
+    left -= len;
+    return len;
+  }
+};
+
+#define EVENTSUB_FIELD(path, field) {path, offsetof(eventSubMessage, field), sizeof(eventSubMessage::field)}
+
+struct eventSubField {
+  const char* path;
+  size_t offset;
+  size_t size;
+};
+
+static const eventSubField eventSubFields[] = {
+  EVENTSUB_FIELD("metadata.message_id", messageId),
+  EVENTSUB_FIELD("metadata.message_type", messageType),
+  EVENTSUB_FIELD("metadata.subscription_type", subscriptionType),
+  EVENTSUB_FIELD("payload.session.id", sessionId),
+  EVENTSUB_FIELD("payload.session.reconnect_url", reconnectUrl),
+  EVENTSUB_FIELD("payload.subscription.status", status),
+  EVENTSUB_FIELD("payload.subscription.condition.broadcaster_user_id", userId),
+  EVENTSUB_FIELD("payload.event.broadcaster_user_id", userId),
+  EVENTSUB_FIELD("payload.event.broadcaster_user_name", userName),
+  EVENTSUB_FIELD("payload.event.title", title),
+  EVENTSUB_FIELD("payload.event.category_name", categoryName),
+};
+
+// Reads the value after a key of the object at path, which is pathLen long
+// and has room for more keys. False if the message is malformed.
+template<typename Tokenizer>
+bool readEventSubValue(Tokenizer& json, char* path, size_t pathLen, size_t pathSize, eventSubMessage& message){
+  typename Tokenizer::Token t = json.next();
+  // nothing we keep is in an array
+  if (t == Tokenizer::BeginArray) return json.skipContainer();
+  if (t == Tokenizer::BeginObject) {
+    while ((t = json.next()) == Tokenizer::Key) {
+      size_t keyLen = json.length();
+      if (pathLen + 1 + keyLen >= pathSize) {
+        // deeper than any field we keep, its value is not read yet
+        if (!json.skipValue()) return false;
+        continue;
+      }
+      size_t len = pathLen;
+      if (len) path[len++] = '.';
+      memcpy(path + len, json.text(), keyLen + 1);
+      if (!readEventSubValue(json, path, len + keyLen, pathSize, message)) return false;
+      path[pathLen] = 0;
+    }
+    return t == Tokenizer::EndObject;
+  }
+  if (t == Tokenizer::String) {
+    for (const eventSubField& field : eventSubFields) {
+      if (strcmp(path, field.path) != 0) continue;
+      copyStreamField((char*)&message + field.offset, field.size, json.text(), json.length());
+    }
+    return true;
+  }
+  if (t == Tokenizer::Number) {
+    if (strcmp(path, "payload.session.keepalive_timeout_seconds") == 0) message.keepaliveS = atoi(json.text());
+    return true;
+  }
+  return t == Tokenizer::True || t == Tokenizer::False || t == Tokenizer::Null;
+}
+
+// Reads a message into message, false if it is malformed
+inline bool readEventSubMessage(const uint8_t* payload, size_t length, eventSubMessage& message){
+  typedef JsonTokenizer<eventSubPayload, STREAM_TITLE_MAX> Tokenizer;
+  eventSubPayload input = {payload, length};
+  Tokenizer json(input);
+  // room for the longest path of eventSubFields
+  char path[64] = "";
+  memset(&message, 0, sizeof(message));
+  return readEventSubValue(json, path, 0, sizeof(path), message) && json.next() == Tokenizer::End;
+}
+
+#endif
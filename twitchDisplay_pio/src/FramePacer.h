@@ -0,0 +1,101 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+// Fixed frame rate scheduling on micros() deadlines.
+//
+// due() is polled from loop() and tells how many frame periods have passed
+// since the last frame. When the loop was held up (HTTP poll, OTA) the missed
+// frames are merged into the next one so animations keep their speed, up to
+// maxMerge periods; anything beyond that is dropped and the schedule restarts
+// from now instead of rushing to catch up.
+
+#include <Arduino.h>
+#include <math.h>
+
+class FramePacer {
+  public:
+    struct Stats {
+      uint32_t frames;
+      uint32_t merged;   // periods folded into a later frame
+      uint32_t dropped;  // periods skipped altogether
+      uint64_t sqDevSum; // squared deviation of frame intervals, us^2
+      unsigned long start, last;
+    };
+
+    FramePacer(float fps, uint8_t maxMerge = 4) : maxMerge(maxMerge) {
+      setFps(fps);
+    }
+
+    void setFps(float fps){
+      period = 1e6/fps;
+    }
+
+    // Starts a new schedule with the first frame due now and clears the stats
+    void restart(){
+      running = true;
+      next = micros();
+      st = {};
+      st.start = st.last = next;
+    }
+
+    // Ends the schedule, untilNext() no longer counts down to a frame
+    void stop(){
+      running = false;
+    }
+
+    // Returns the number of frame periods to advance by, 0 if no frame is due yet
+    uint8_t due(){
+      unsigned long now = micros();
+      if ((long)(now - next) < 0) return 0;
+
+      uint32_t periods = 1 + (now - next)/period;
+      if (periods > maxMerge) {
+        st.dropped += periods - maxMerge;
+        periods = maxMerge;
+        next = now + period;
+      } else {
+        next += periods*period;
+      }
+      st.merged += periods - 1;
+
+      // deviation from the interval the frame was scheduled for
+      if (st.frames) {
+        long dev = (long)(now - st.last) - (long)(periods*period);
+        st.sqDevSum += (uint64_t)((int64_t)dev*dev);
+      }
+      st.frames++;
+      st.last = now;
+      return periods;
+    }
+
+    // Microseconds until the next frame is due, 0 when late, a whole period
+    // when stopped
+    uint32_t untilNext() const {
+      if (!running) return period;
+      long d = (long)(next - micros());
+      return (d > 0) ? d : 0;
+    }
+
+    // Frames actually sent per second since restart()
+    float fps() const {
+      if (st.frames < 2) return 0;
+      return (st.frames - 1) * 1e6f / (st.last - st.start);
+    }
+
+    // RMS deviation of the frame intervals from the schedule in microseconds
+    float jitterMicros() const {
+      if (st.frames < 2) return 0;
+      return sqrtf((float)st.sqDevSum / (st.frames - 1));
+    }
+
+    const Stats& stats() const { return st; }
+
+  private:
+    uint32_t period;
+    uint8_t maxMerge;
+    unsigned long next = 0;
+    bool running = false;
+    Stats st = {};
+};
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef HELIX_CLIENT_H
+#define HELIX_CLIENT_H
+
+// One long lived HTTPS connection to helix for the polls. HTTPClient keeps
+// the TLS session open between requests (HTTP/1.1 keep-alive) as long as
+// the server does, so a poll only pays for a handshake after helix closed
+// the connection. The answer is read through HelixBody, which undoes the
+// chunked transfer encoding and reads the rest of the body after the
+// caller, so the next request finds the connection clean. One request at a
+// time: get() waits while another task has a request open.
+//
+//   if (helix.get("streams?user_id=...") == HTTP_CODE_OK) {
+//     deserializeJson(doc, helix.body());
+//   }
+//   helix.end();
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include <mutex>
+
+#include "Debug.h"
+#include "HelixTime.h"
+
+#ifndef HELIX_URL
+#define HELIX_URL "https://api.twitch.tv/helix/"
+#endif
+
+// Defined by whoever includes this file, sets up auth for helix requests
+void commonHttpInit(HTTPClient& http_client);
+
+// The body of a response, from the connection the response came on. Reads
+// return -1 at its end, so ArduinoJson cannot run into the next response.
+class HelixBody {
+  public:
+    // size from the Content-Length header, -1 without one
+    void begin(WiFiClient& client, int size, bool chunked){
+      stream = &client;
+      isChunked = chunked;
+      left = chunked ? 0 : size;
+      chunkRead = false;
+      done = false;
+      failed = false;
+    }
+
+    // Next byte of the body, -1 at its end
+    int read(){
+      uint8_t c;
+      return readBytes((char*)&c, 1) == 1 ? c : -1;
+    }
+
+    size_t readBytes(char* buf, size_t len){
+      size_t n = 0;
+      while (n < len && !done) {
+        if (!left && !(isChunked && nextChunk())) {
+          done = true;
+          break;
+        }
+        size_t want = len - n;
+        if (left > 0 && (size_t)left < want) want = left;
+        size_t got = stream->readBytes(buf + n, want);
+        n += got;
+        if (left > 0) left -= got;
+        if (got < want) {
+          // the connection is gone; an error unless the body ends with it
+          failed = left >= 0;
+          done = true;
+        }
+      }
+      return n;
+    }
+
+    // Reads whatever is left of the body, false if it did not arrive whole
+    bool drain(){
+      char buf[128];
+      while (readBytes(buf, sizeof(buf))) {}
+      return !failed && left <= 0;
+    }
+
+  private:
+    // Reads the size line of the next chunk, false after the last one
+    bool nextChunk(){
+      if (chunkRead && !skipLine()) return false;  // the CRLF after the data
+      chunkRead = true;
+      String line;
+      if (!readLine(line)) return false;
+      left = strtol(line.c_str(), nullptr, 16);
+      if (left > 0) return true;
+      // the last chunk, then trailers up to an empty line
+      while (readLine(line) && line.length()) {}
+      chunkRead = false;
+      return false;
+    }
+
+    bool readLine(String& line){
+      line = "";
+      char c;
+      while (stream->readBytes(&c, 1) == 1) {
+        if (c == '\n') return true;
+        if (c != '\r') line += c;
+      }
+      failed = true;
+      return false;
+    }
+
+    bool skipLine(){
+      String line;
+      return readLine(line);
+    }
+
+    WiFiClient* stream = nullptr;
+    int32_t left = 0;  // of the body or the current chunk, -1 until the connection closes
+    bool isChunked = false;
+    bool chunkRead = false;
+    bool done = true;
+    bool failed = false;
+};
+
+class HelixClient {
+  public:
+    struct Stats {
+      uint32_t reusedPolls = 0;
+      uint32_t newPolls = 0;
+      uint32_t failedPolls = 0;
+      unsigned long reusedMs = 0;
+      unsigned long newMs = 0;
+    };
+
+    // The points helix gives the token, as of the last answer
+    struct RateLimit {
+      bool known = false;
+      uint32_t limit = 0;
+      uint32_t remaining = 0;
+      uint32_t reset = 0; // seconds since 1970 when the bucket is full again
+    };
+
+    HelixClient(){
+      // no certificate check, as HTTPClient did for https URLs
+      client.setInsecure();
+    }
+
+    // GET of HELIX_URL + path, returns the HTTP code. Read the body from
+    // body() and call end() after, whatever the code.
+    int get(const String& path){
+      return start(path, nullptr);
+    }
+
+    // POST of the JSON payload to HELIX_URL + path, like get()
+    int post(const String& path, const String& payload){
+      return start(path, &payload);
+    }
+
+    HelixBody& body(){ return response; }
+
+    // Finishes the request. The connection stays open if helix lets it and
+    // the whole body arrived.
+    void end(){
+      bool whole = lastCode > 0 && response.drain();
+      http.end();
+      if (!whole) client.stop();
+
+      unsigned long ms = millis() - started;
+      if (lastCode != HTTP_CODE_OK) {
+        stats.failedPolls++;
+      } else if (reused) {
+        stats.reusedPolls++;
+        stats.reusedMs += ms;
+      } else {
+        stats.newPolls++;
+        stats.newMs += ms;
+      }
+      DEBUG_I.printf("[HTTP] %.*s took %lu ms on a %s connection (%lu ms average reused, %lu ms new)\n",
+        (int)strcspn(path.c_str(), "?"), path.c_str(), ms, reused ? "reused" : "new",
+        stats.reusedPolls ? stats.reusedMs/stats.reusedPolls : 0, stats.newPolls ? stats.newMs/stats.newPolls : 0);
+      busy.unlock();
+    }
+
+    // Whether the connection is still open for the next request
+    bool connected(){ return http.connected(); }
+
+    const Stats& getStats() const { return stats; }
+
+    // Both as of the last answer, read them between get() and end()
+    const RateLimit& rateLimit() const { return rate; }
+    // Seconds since 1970 by the clock of helix, 0 before the first answer
+    uint32_t now() const {
+      return serverTime ? serverTime + (millis() - serverTimeMs)/1000 : 0;
+    }
+
+  private:
+    int start(const String& path, const String* payload){
+      busy.lock();
+      started = millis();
+      this->path = path;
+      reused = http.connected();
+      int code = request(payload);
+      if (code <= 0 && reused) {
+        // helix closed the connection while it was idle
+        DEBUG_I.printf("[HTTP] Kept connection is gone, reconnecting...\n");
+        http.end();
+        client.stop();
+        reused = false;
+        code = request(payload);
+      }
+      if (code > 0) {
+        response.begin(http.getStream(), http.getSize(), http.header("Transfer-Encoding").equalsIgnoreCase("chunked"));
+        readHeaders();
+      }
+      lastCode = code;
+      return code;
+    }
+
+    int request(const String* payload){
+      http.setReuse(true);
+      http.useHTTP10(false);
+      if (!http.begin(client, String(HELIX_URL) + path)) return HTTPC_ERROR_CONNECTION_REFUSED;
+      static const char* headerKeys[] = {"Transfer-Encoding", "Date",
+        "Ratelimit-Limit", "Ratelimit-Remaining", "Ratelimit-Reset"};
+      http.collectHeaders(headerKeys, sizeof(headerKeys)/sizeof(headerKeys[0]));
+      commonHttpInit(http);
+      if (!payload) return http.GET();
+      http.addHeader("Content-Type", "application/json");
+      return http.POST(*payload);
+    }
+
+    void readHeaders(){
+      uint32_t date = parseHttpDate(http.header("Date").c_str());
+      if (date) {
+        serverTime = date;
+        serverTimeMs = millis();
+      }
+      String limit = http.header("Ratelimit-Limit");
+      if (limit.length()) {
+        rate.known = true;
+        rate.limit = strtoul(limit.c_str(), nullptr, 10);
+        rate.remaining = strtoul(http.header("Ratelimit-Remaining").c_str(), nullptr, 10);
+        rate.reset = strtoul(http.header("Ratelimit-Reset").c_str(), nullptr, 10);
+      }
+    }
+
+    std::mutex busy; // held from get() or post() to end()
+    WiFiClientSecure client;
+    HTTPClient http;
+    HelixBody response;
+    String path;
+    int lastCode = 0;
+    bool reused = false;
+    unsigned long started = 0;
+    Stats stats;
+    RateLimit rate;
+    uint32_t serverTime = 0;
+    unsigned long serverTimeMs = 0;
+};
+
+HelixClient helix;
+
+#endif
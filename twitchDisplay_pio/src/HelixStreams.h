@@ -0,0 +1,138 @@
+#ifndef HELIX_STREAMS_H
+#define HELIX_STREAMS_H
+
+// Parsing of helix/streams answers. Every live channel comes with about 1 KB
+// of thumbnail URL, tags, timestamps and counters we never show, so only the
+// fields below are kept in the JsonDocument and the rest is skipped while
+// reading the stream. readStreams() gets the same fields without a
+// JsonDocument at all, through JsonTokenizer.h.
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <string.h>
+
+#include "JsonTokenizer.h"
+
+// Room for the longest title helix allows, 140 characters of up to 4 bytes
+#define STREAM_TITLE_MAX 564
+
+// The fields of every stream that are kept
+void streamsFilter(JsonDocument& filter){
+  JsonVariant stream = filter["data"][0];
+  stream["user_id"] = true;
+  stream["user_name"] = true;
+  stream["title"] = true;
+  stream["game_name"] = true;
+}
+
+// deserializeJson() of a helix/streams answer, keeping only streamsFilter()
+template<typename TInput>
+DeserializationError deserializeStreams(JsonDocument& doc, TInput&& input){
+  JsonDocument filter;
+  streamsFilter(filter);
+  return deserializeJson(doc, input, DeserializationOption::Filter(filter));
+}
+
+// The fields of a stream readStreams() hands over, cut to fit
+struct streamFields {
+  char userId[24];
+  char userName[100];
+  char title[STREAM_TITLE_MAX];
+  char gameName[256];
+  char startedAt[24];
+};
+
+// Copies a field into one of streamFields, cut at a whole UTF-8 character
+inline void copyStreamField(char* field, size_t size, const char* text, size_t len){
+  if (len >= size) {
+    len = size - 1;
+    while (len && ((uint8_t)text[len] & 0xC0) == 0x80) len--;
+  }
+  memcpy(field, text, len);
+  field[len] = 0;
+}
+
+// Reads a helix/streams answer from input and calls onStream(const
+// streamFields&) for every stream in it, without allocating anything. The
+// pagination cursor goes to cursor, empty if there is no next page.
+// Returns false if the answer is malformed or cut off; the streams before
+// that have been handed over already.
+//
+// The live polls use this one rather than deserializeStreams(): it reads
+// straight from the connection, and the tokenizer and one streamFields on the
+// stack are all it needs, however many streams a page has. The filtered
+// JsonDocument still grows with the page on the heap, which is fragmented by
+// then. native_streamsParse prints both.
+template<typename TInput, typename Callback>
+bool readStreams(TInput& input, Callback onStream, char* cursor = nullptr, size_t cursorSize = 0){
+  typedef JsonTokenizer<TInput, STREAM_TITLE_MAX> Tokenizer;
+  Tokenizer json(input);
+  streamFields fields;
+
+  if (cursor) *cursor = 0;
+  if (json.next() != Tokenizer::BeginObject) return false;
+  for (;;) {
+    typename Tokenizer::Token t = json.next();
+    if (t == Tokenizer::EndObject) break;
+    if (t != Tokenizer::Key) return false;
+    if (cursor && strcmp(json.text(), "pagination") == 0) {
+      if (json.next() != Tokenizer::BeginObject) return false;
+      while ((t = json.next()) == Tokenizer::Key) {
+        if (strcmp(json.text(), "cursor") != 0) {
+          if (!json.skipValue()) return false;
+          continue;
+        }
+        // a cut off cursor would ask for the wrong page
+        if (json.next() != Tokenizer::String || json.truncated() || json.length() >= cursorSize) return false;
+        memcpy(cursor, json.text(), json.length() + 1);
+      }
+      if (t != Tokenizer::EndObject) return false;
+      continue;
+    }
+    if (strcmp(json.text(), "data") != 0) {
+      if (!json.skipValue()) return false;
+      continue;
+    }
+
+    if (json.next() != Tokenizer::BeginArray) return false;
+    while ((t = json.next()) == Tokenizer::BeginObject) {
+      memset(&fields, 0, sizeof(fields));
+      while ((t = json.next()) == Tokenizer::Key) {
+        char* field = nullptr;
+        size_t size = 0;
+        if (strcmp(json.text(), "user_id") == 0) {
+          field = fields.userId;
+          size = sizeof(fields.userId);
+        } else if (strcmp(json.text(), "user_name") == 0) {
+          field = fields.userName;
+          size = sizeof(fields.userName);
+        } else if (strcmp(json.text(), "title") == 0) {
+          field = fields.title;
+          size = sizeof(fields.title);
+        } else if (strcmp(json.text(), "game_name") == 0) {
+          field = fields.gameName;
+          size = sizeof(fields.gameName);
+        } else if (strcmp(json.text(), "started_at") == 0) {
+          field = fields.startedAt;
+          size = sizeof(fields.startedAt);
+        }
+        if (!field) {
+          if (!json.skipValue()) return false;
+          continue;
+        }
+        t = json.next();
+        if (t == Tokenizer::String) {
+          copyStreamField(field, size, json.text(), json.length());
+        } else if (t != Tokenizer::Null) {
+          return false;
+        }
+      }
+      if (t != Tokenizer::EndObject) return false;
+      onStream((const streamFields&)fields);
+    }
+    if (t != Tokenizer::EndArray) return false;
+  }
+  return json.next() == Tokenizer::End;
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef HELIX_TIME_H
+#define HELIX_TIME_H
+
+// Times helix sends, as seconds since 1970 UTC. The display has no clock of
+// its own; HelixClient takes the time from the Date header of every answer.
+
+#include <Arduino.h>
+#include <string.h>
+
+// Seconds since 1970 of a UTC date, month and day from 1
+inline uint32_t epochFromCivil(int year, int month, int day, int hour, int minute, int second){
+  // days since 1970-01-01 in the proleptic Gregorian calendar, years from March
+  year -= month <= 2;
+  int era = year / 400;
+  int yearOfEra = year - era * 400;
+  int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  int32_t days = era * 146097 + dayOfEra - 719468;
+  return days * 86400UL + hour * 3600UL + minute * 60UL + second;
+}
+
+// started_at of a stream, "2024-05-01T18:02:11Z", 0 if it is not one
+inline uint32_t parseIsoTime(const char* s){
+  int year, month, day, hour, minute, second;
+  if (sscanf(s, "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &day, &hour, &minute, &second) != 6) return 0;
+  if (year < 1970 || month < 1 || month > 12) return 0;
+  return epochFromCivil(year, month, day, hour, minute, second);
+}
+
+// Date header, "Wed, 01 May 2024 18:02:11 GMT", 0 if it is not one
+inline uint32_t parseHttpDate(const char* s){
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char name[4];
+  int year, day, hour, minute, second;
+  if (sscanf(s, "%*3s, %2d %3s %4d %2d:%2d:%2d", &day, name, &year, &hour, &minute, &second) != 6) return 0;
+  const char* month = strstr(months, name);
+  if (!month || strlen(name) != 3 || (month - months) % 3) return 0;
+  return epochFromCivil(year, (month - months) / 3 + 1, day, hour, minute, second);
+}
+
+#endif
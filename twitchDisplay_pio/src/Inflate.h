@@ -0,0 +1,242 @@
+#ifndef INFLATE_H
+#define INFLATE_H
+
+// Small streaming inflate (RFC 1950/1951) for PNG avatars, along the lines
+// of zlib's contrib/puff. Compressed bytes come from source.next() (-1 at
+// the end) and every output byte goes to sink.put(b), which returns false
+// to stop. Back references are resolved in a 32 KB window on the heap, so
+// the output never has to be in RAM as a whole. The code tables of a block
+// are members, allocate it on the heap to keep them off a task's stack.
+
+#include <Arduino.h>
+#include <new>
+
+template<typename Source, typename Sink>
+class Inflate {
+  public:
+    static const uint32_t WINDOW = 32768;
+
+    Inflate(Source& source, Sink& sink) : source(source), sink(sink) {}
+    ~Inflate(){ delete[] window; }
+
+    // zlib stream, true if it ended cleanly. The Adler-32 is not checked.
+    bool zlib(){
+      int cmf = source.next(), flg = source.next();
+      if (cmf < 0 || flg < 0 || (cmf & 0x0F) != 8 || ((cmf << 8) | flg) % 31 || (flg & 0x20)) return false;
+      return deflate();
+    }
+
+    // Raw deflate stream
+    bool deflate(){
+      if (!window) window = new (std::nothrow) uint8_t[WINDOW];
+      if (!window) return false;
+      bool last;
+      do {
+        last = bits(1);
+        switch (bits(2)) {
+          case 0: stored(); break;
+          case 1: fixed(); break;
+          case 2: dynamic(); break;
+          default: failed = true;
+        }
+      } while (!last && !failed);
+      return !failed;
+    }
+
+  private:
+    static const uint8_t MAX_BITS = 15;
+    static const uint16_t MAX_LCODES = 286;
+    static const uint16_t MAX_DCODES = 30;
+    static const uint16_t FIX_LCODES = 288;
+
+    struct Huffman {
+      uint16_t count[MAX_BITS+1];  // codes of each length
+      uint16_t symbol[FIX_LCODES]; // symbols ordered by code
+    };
+
+    uint32_t bits(uint8_t need){
+      while (bitCount < need) {
+        int b = source.next();
+        if (b < 0) {
+          failed = true;
+          return 0;
+        }
+        bitBuf |= (uint32_t)b << bitCount;
+        bitCount += 8;
+      }
+      uint32_t v = bitBuf & ((1UL << need) - 1);
+      bitBuf >>= need;
+      bitCount -= need;
+      return v;
+    }
+
+    void out(uint8_t b){
+      window[written++ % WINDOW] = b;
+      if (!sink.put(b)) failed = true;
+    }
+
+    void stored(){
+      bitBuf = 0;
+      bitCount = 0;
+      int b[4];
+      for (int& v : b) v = source.next();
+      if (b[3] < 0 || (b[0] | (b[1] << 8)) != (~(b[2] | (b[3] << 8)) & 0xFFFF)) {
+        failed = true;
+        return;
+      }
+      for (uint16_t len = b[0] | (b[1] << 8); len && !failed; len--) {
+        int v = source.next();
+        if (v < 0) failed = true;
+        else out(v);
+      }
+    }
+
+    // <0 over-subscribed, >0 incomplete, 0 complete (or no codes)
+    static int construct(Huffman& h, const uint8_t* length, uint16_t n){
+      for (uint16_t& c : h.count) c = 0;
+      for (uint16_t s = 0; s < n; s++) h.count[length[s]]++;
+      if (h.count[0] == n) return 0;
+      int left = 1;
+      for (uint8_t len = 1; len <= MAX_BITS; len++) {
+        left = (left << 1) - h.count[len];
+        if (left < 0) return left;
+      }
+      uint16_t offs[MAX_BITS+1];
+      offs[1] = 0;
+      for (uint8_t len = 1; len < MAX_BITS; len++) offs[len+1] = offs[len] + h.count[len];
+      for (uint16_t s = 0; s < n; s++) {
+        if (length[s]) h.symbol[offs[length[s]]++] = s;
+      }
+      return left;
+    }
+
+    int decode(const Huffman& h){
+      int code = 0, first = 0, index = 0;
+      for (uint8_t len = 1; len <= MAX_BITS; len++) {
+        code |= bits(1);
+        int count = h.count[len];
+        if (code - count < first) return h.symbol[index + (code - first)];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+      }
+      failed = true;
+      return -1;
+    }
+
+    void codes(const Huffman& lencode, const Huffman& distcode){
+      static const uint16_t LBASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+      static const uint8_t LEXT[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+      static const uint16_t DBASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+      static const uint8_t DEXT[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+      while (!failed) {
+        int sym = decode(lencode);
+        if (sym < 256) {
+          if (sym >= 0) out(sym);
+        } else if (sym == 256) {
+          return;
+        } else {
+          sym -= 257;
+          if (sym >= 29) break;
+          uint16_t len = LBASE[sym] + bits(LEXT[sym]);
+          int dsym = decode(distcode);
+          if (dsym < 0 || dsym >= 30) break;
+          uint32_t dist = DBASE[dsym] + bits(DEXT[dsym]);
+          if (dist > written || dist > WINDOW) break;
+          while (len-- && !failed) out(window[(written - dist) % WINDOW]);
+        }
+      }
+      failed = true;
+    }
+
+    void fixed(){
+      static Huffman fixedLen, fixedDist;
+      static bool built = false;
+      if (!built) {
+        uint16_t s = 0;
+        for (; s < 144; s++) lengths[s] = 8;
+        for (; s < 256; s++) lengths[s] = 9;
+        for (; s < 280; s++) lengths[s] = 7;
+        for (; s < FIX_LCODES; s++) lengths[s] = 8;
+        construct(fixedLen, lengths, FIX_LCODES);
+        for (s = 0; s < MAX_DCODES; s++) lengths[s] = 5;
+        construct(fixedDist, lengths, MAX_DCODES);
+        built = true;
+      }
+      codes(fixedLen, fixedDist);
+    }
+
+    void dynamic(){
+      static const uint8_t ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+      uint16_t nlen = bits(5) + 257, ndist = bits(5) + 1, ncode = bits(4) + 4;
+      if (failed || nlen > MAX_LCODES || ndist > MAX_DCODES) {
+        failed = true;
+        return;
+      }
+      uint16_t index = 0;
+      for (; index < ncode; index++) lengths[ORDER[index]] = bits(3);
+      for (; index < 19; index++) lengths[ORDER[index]] = 0;
+      if (construct(lencode, lengths, 19) != 0) {
+        failed = true;
+        return;
+      }
+
+      for (index = 0; index < nlen + ndist && !failed;) {
+        int sym = decode(lencode);
+        if (sym < 0) return;
+        if (sym < 16) {
+          lengths[index++] = sym;
+          continue;
+        }
+        uint8_t len = 0;
+        uint8_t repeat;
+        if (sym == 16) {
+          if (index == 0) break;
+          len = lengths[index - 1];
+          repeat = 3 + bits(2);
+        } else if (sym == 17) {
+          repeat = 3 + bits(3);
+        } else {
+          repeat = 11 + bits(7);
+        }
+        if (index + repeat > nlen + ndist) break;
+        while (repeat--) lengths[index++] = len;
+      }
+      if (failed || index < nlen + ndist || lengths[256] == 0) {
+        failed = true;
+        return;
+      }
+
+      // a single length code may be incomplete, like zlib allows
+      int err = construct(lencode, lengths, nlen);
+      if (err && (err < 0 || nlen != lencode.count[0] + lencode.count[1])) {
+        failed = true;
+        return;
+      }
+      err = construct(distcode, lengths + nlen, ndist);
+      if (err && (err < 0 || ndist != distcode.count[0] + distcode.count[1])) {
+        failed = true;
+        return;
+      }
+      codes(lencode, distcode);
+    }
+
+    Source& source;
+    Sink& sink;
+    uint8_t* window = nullptr;
+    uint32_t written = 0;
+    uint32_t bitBuf = 0;
+    uint8_t bitCount = 0;
+    bool failed = false;
+    // of the dynamic block being read
+    uint8_t lengths[MAX_LCODES + MAX_DCODES];
+    Huffman lencode, distcode;
+};
+
+#endif
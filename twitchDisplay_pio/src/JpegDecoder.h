@@ -0,0 +1,376 @@
+#ifndef JPEG_DECODER_H
+#define JPEG_DECODER_H
+
+// Baseline JPEG decoder for downloaded avatars: grey or YCbCr, chroma
+// subsampled by up to 2 in each direction, with restart markers.
+// Progressive and arithmetic coded files are refused. After
+// sink.begin(width, height) every row goes to sink.row(rgb) as RGB888, one
+// row of MCUs is in RAM at a time. Chroma is upsampled by repeating
+// samples and the IDCT is a plain fixed point matrix product, which is
+// plenty for a 70x70 thumbnail.
+
+#include <Arduino.h>
+#include <math.h>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Larger images are refused rather than running out of memory
+#define JPEG_MAX_SIZE 1024
+
+class JpegDecoder {
+  public:
+    template<typename Sink>
+    static bool decode(const uint8_t* data, size_t len, Sink& sink){
+      // about 4 KB of tables, kept off the decoding task's stack
+      std::unique_ptr<JpegDecoder> jpeg(new (std::nothrow) JpegDecoder(data, len));
+      return jpeg && jpeg->run(sink);
+    }
+
+  private:
+    JpegDecoder(const uint8_t* data, size_t len) : data(data), len(len) {}
+
+    static const uint8_t COMPONENTS = 3;
+
+    struct Huffman {
+      uint8_t values[256];
+      int32_t maxCode[18];  // largest code of each length, -1 if none
+      int32_t offset[17];   // values index minus the first code of each length
+      bool defined = false;
+    };
+
+    struct Component {
+      uint8_t id;
+      uint8_t h, v;         // sampling factors
+      uint8_t quant;
+      uint8_t dcTable, acTable;
+      int16_t pred;         // DC of the previous block
+      uint16_t stride;      // of the MCU row buffer
+      std::vector<uint8_t> samples;
+    };
+
+    // Entropy coded bits, with stuffed zero bytes removed. Stops at the
+    // next marker and feeds zeros from there on.
+    struct Bits {
+      const uint8_t* data;
+      size_t len;
+      size_t pos;
+      uint32_t buf = 0;
+      uint8_t count = 0;
+      bool marker = false;
+
+      void fill(){
+        while (count <= 24) {
+          uint8_t b = 0;
+          if (!marker && pos < len) {
+            b = data[pos];
+            if (b == 0xFF) {
+              if (pos + 1 < len && data[pos+1] == 0x00) {
+                pos += 2;
+              } else {
+                marker = true;
+                b = 0;
+              }
+            } else {
+              pos++;
+            }
+          }
+          buf |= (uint32_t)b << (24 - count);
+          count += 8;
+        }
+      }
+
+      uint32_t get(uint8_t n){
+        if (!n) return 0;
+        if (count < n) fill();
+        uint32_t v = buf >> (32 - n);
+        buf <<= n;
+        count -= n;
+        return v;
+      }
+
+      // Skips the RSTn marker that has to follow now
+      bool restart(){
+        buf = 0;
+        count = 0;
+        marker = false;
+        while (pos + 1 < len && data[pos] == 0xFF && data[pos+1] == 0xFF) pos++;
+        if (pos + 1 >= len || data[pos] != 0xFF || (data[pos+1] & 0xF8) != 0xD0) return false;
+        pos += 2;
+        return true;
+      }
+    };
+
+    static uint16_t be16(const uint8_t* p){ return (p[0] << 8) | p[1]; }
+
+    template<typename Sink>
+    bool run(Sink& sink){
+      if (len < 4 || data[0] != 0xFF || data[1] != 0xD8) return false;
+      size_t pos = 2;
+      while (pos + 4 <= len) {
+        if (data[pos] != 0xFF) return false;
+        uint8_t marker = data[pos+1];
+        if (marker == 0xFF) {
+          pos++;
+          continue;
+        }
+        uint16_t n = be16(data + pos + 2);
+        if (n < 2 || n > len - pos - 2) return false;
+        const uint8_t* body = data + pos + 4;
+        n -= 2;
+        switch (marker) {
+          case 0xDB: if (!readQuant(body, n)) return false; break;
+          case 0xC4: if (!readHuffman(body, n)) return false; break;
+          case 0xDD:
+            if (n < 2) return false;
+            restartInterval = be16(body);
+            break;
+          case 0xC0: case 0xC1: if (!readFrame(body, n)) return false; break;
+          case 0xDA: return readScan(body, n) && scan(body + n, sink);
+          case 0xD9: return false;
+          default:
+            // other SOFs (progressive, lossless, arithmetic) are not supported
+            if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) return false;
+            break;
+        }
+        pos += 4 + n;
+      }
+      return false;
+    }
+
+    bool readQuant(const uint8_t* p, uint16_t n){
+      while (n) {
+        uint8_t precision = p[0] >> 4, table = p[0] & 0x0F;
+        uint16_t size = 1 + (precision ? 128 : 64);
+        if (table > 3 || n < size) return false;
+        for (uint8_t k = 0; k < 64; k++) quant[table][k] = precision ? be16(p + 1 + k*2) : p[1 + k];
+        p += size;
+        n -= size;
+      }
+      return true;
+    }
+
+    bool readHuffman(const uint8_t* p, uint16_t n){
+      while (n) {
+        if (n < 17) return false;
+        uint8_t cls = p[0] >> 4, table = p[0] & 0x0F;
+        if (cls > 1 || table > 3) return false;
+        Huffman& h = huffman[cls][table];
+        uint16_t total = 0;
+        for (uint8_t l = 1; l <= 16; l++) total += p[l];
+        if (total > 256 || n < 17 + total) return false;
+        memcpy(h.values, p + 17, total);
+
+        // canonical codes, JPEG spec F.2.2.3
+        int32_t code = 0;
+        uint16_t index = 0;
+        for (uint8_t l = 1; l <= 16; l++) {
+          h.offset[l] = index - code;
+          code += p[l];
+          index += p[l];
+          h.maxCode[l] = p[l] ? code - 1 : -1;
+          code <<= 1;
+        }
+        h.maxCode[17] = INT32_MAX;
+        h.defined = true;
+        p += 17 + total;
+        n -= 17 + total;
+      }
+      return true;
+    }
+
+    bool readFrame(const uint8_t* p, uint16_t n){
+      if (n < 6 || p[0] != 8) return false;
+      height = be16(p + 1);
+      width = be16(p + 3);
+      count = p[5];
+      if (!width || !height || width > JPEG_MAX_SIZE || height > JPEG_MAX_SIZE) return false;
+      if ((count != 1 && count != 3) || n < 6 + count*3) return false;
+      hMax = vMax = 1;
+      for (uint8_t i = 0; i < count; i++) {
+        Component& c = comps[i];
+        c.id = p[6 + i*3];
+        c.h = p[7 + i*3] >> 4;
+        c.v = p[7 + i*3] & 0x0F;
+        c.quant = p[8 + i*3];
+        if (c.h < 1 || c.h > 2 || c.v < 1 || c.v > 2 || c.quant > 3) return false;
+        hMax = std::max(hMax, c.h);
+        vMax = std::max(vMax, c.v);
+      }
+      // a single component is always coded block by block
+      if (count == 1) comps[0].h = comps[0].v = hMax = vMax = 1;
+      return true;
+    }
+
+    bool readScan(const uint8_t* p, uint16_t n){
+      // one interleaved scan with every component
+      if (!count || n < 1 || p[0] != count || n < 4 + count*2) return false;
+      for (uint8_t i = 0; i < count; i++) {
+        uint8_t id = p[1 + i*2], tables = p[2 + i*2];
+        Component* c = std::find_if(comps, comps + count, [id](const Component& x){ return x.id == id; });
+        if (c == comps + count) return false;
+        c->dcTable = tables >> 4;
+        c->acTable = tables & 0x0F;
+        if (c->dcTable > 3 || c->acTable > 3) return false;
+        if (!huffman[0][c->dcTable].defined || !huffman[1][c->acTable].defined) return false;
+      }
+      return true;
+    }
+
+    template<typename Sink>
+    bool scan(const uint8_t* start, Sink& sink){
+      uint16_t mcuW = 8*hMax, mcuH = 8*vMax;
+      uint16_t mcusX = (width + mcuW - 1)/mcuW, mcusY = (height + mcuH - 1)/mcuH;
+      for (uint8_t i = 0; i < count; i++) {
+        Component& c = comps[i];
+        c.pred = 0;
+        c.stride = mcusX*c.h*8;
+        c.samples.assign(c.stride*c.v*8, 0);
+      }
+      std::vector<uint8_t> rgb(width*3);
+      sink.begin(width, height);
+
+      Bits bits = {data, len, (size_t)(start - data)};
+      uint32_t mcus = 0;
+      for (uint16_t my = 0; my < mcusY; my++) {
+        for (uint16_t mx = 0; mx < mcusX; mx++) {
+          if (restartInterval && mcus && mcus % restartInterval == 0) {
+            if (!bits.restart()) return false;
+            for (uint8_t i = 0; i < count; i++) comps[i].pred = 0;
+          }
+          mcus++;
+          for (uint8_t i = 0; i < count; i++) {
+            Component& c = comps[i];
+            for (uint8_t by = 0; by < c.v; by++) {
+              for (uint8_t bx = 0; bx < c.h; bx++) {
+                int16_t block[64];
+                if (!decodeBlock(bits, c, block)) return false;
+                idct(block, c.samples.data() + by*8*c.stride + (mx*c.h + bx)*8, c.stride);
+              }
+            }
+          }
+        }
+
+        for (uint16_t y = 0; y < mcuH && my*mcuH + y < height; y++) {
+          for (uint16_t x = 0; x < width; x++) {
+            uint8_t* px = &rgb[x*3];
+            const Component& l = comps[0];
+            int32_t luma = l.samples[(y*l.v/vMax)*l.stride + x*l.h/hMax];
+            if (count == 1) {
+              px[0] = px[1] = px[2] = luma;
+              continue;
+            }
+            const Component& b = comps[1];
+            const Component& r = comps[2];
+            int32_t cb = b.samples[(y*b.v/vMax)*b.stride + x*b.h/hMax] - 128;
+            int32_t cr = r.samples[(y*r.v/vMax)*r.stride + x*r.h/hMax] - 128;
+            // JFIF YCbCr to RGB in 16.16 fixed point
+            px[0] = clamp(luma + ((91881*cr + 32768) >> 16));
+            px[1] = clamp(luma - ((22554*cb + 46802*cr - 32768) >> 16));
+            px[2] = clamp(luma + ((116130*cb + 32768) >> 16));
+          }
+          sink.row(rgb.data());
+        }
+      }
+      return true;
+    }
+
+    int decodeSymbol(Bits& bits, const Huffman& h){
+      int32_t code = 0;
+      for (uint8_t l = 1; l <= 16; l++) {
+        code = (code << 1) | bits.get(1);
+        if (code <= h.maxCode[l]) return h.values[h.offset[l] + code];
+      }
+      return -1;
+    }
+
+    static int32_t extend(uint32_t v, uint8_t size){
+      return v < (1UL << (size - 1)) ? (int32_t)v - (1 << size) + 1 : (int32_t)v;
+    }
+
+    // Dequantized coefficients in natural order
+    bool decodeBlock(Bits& bits, Component& c, int16_t* block){
+      static const uint8_t ZIGZAG[64] = {
+         0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+        12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+        35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+        58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+      const uint16_t* q = quant[c.quant];
+      memset(block, 0, 64*sizeof(int16_t));
+
+      int s = decodeSymbol(bits, huffman[0][c.dcTable]);
+      if (s < 0 || s > 11) return false;
+      c.pred += s ? extend(bits.get(s), s) : 0;
+      block[0] = dequant(c.pred, q[0]);
+
+      for (uint8_t k = 1; k < 64;) {
+        int rs = decodeSymbol(bits, huffman[1][c.acTable]);
+        if (rs < 0) return false;
+        uint8_t run = rs >> 4, size = rs & 0x0F;
+        if (!size) {
+          if (run != 15) break;  // end of block
+          k += 16;
+          continue;
+        }
+        k += run;
+        if (k > 63 || size > 10) return false;
+        block[ZIGZAG[k]] = dequant(extend(bits.get(size), size), q[k]);
+        k++;
+      }
+      return true;
+    }
+
+    // 8 bit samples keep every coefficient within +-2048, anything beyond
+    // is a broken file and clamping it keeps the IDCT from overflowing
+    static int16_t dequant(int32_t v, uint16_t q){
+      return std::max<int32_t>(-2048, std::min<int32_t>(2047, v*q));
+    }
+
+    static uint8_t clamp(int32_t v){
+      return v < 0 ? 0 : (v > 255 ? 255 : v);
+    }
+
+    // f(x) = sum over u of C(u)/2 cos((2x+1)u pi/16) F(u), rows then columns
+    static void idct(const int16_t* block, uint8_t* out, uint16_t stride){
+      static int16_t basis[8][8];  // [x][u], 4.12 fixed point
+      static bool built = false;
+      if (!built) {
+        for (uint8_t x = 0; x < 8; x++) {
+          for (uint8_t u = 0; u < 8; u++) {
+            double c = (u ? 0.5 : 0.5/sqrt(2.0))*cos((2*x + 1)*u*M_PI/16);
+            basis[x][u] = (int16_t)lround(c*4096);
+          }
+        }
+        built = true;
+      }
+
+      int32_t tmp[64];
+      for (uint8_t v = 0; v < 8; v++) {
+        const int16_t* in = block + v*8;
+        for (uint8_t x = 0; x < 8; x++) {
+          int32_t sum = 0;
+          for (uint8_t u = 0; u < 8; u++) sum += basis[x][u]*in[u];
+          tmp[v*8 + x] = (sum + (1 << 8)) >> 9;  // keep 3 fraction bits
+        }
+      }
+      for (uint8_t y = 0; y < 8; y++) {
+        for (uint8_t x = 0; x < 8; x++) {
+          int32_t sum = 0;
+          for (uint8_t v = 0; v < 8; v++) sum += basis[y][v]*tmp[v*8 + x];
+          out[y*stride + x] = clamp(((sum + (1 << 14)) >> 15) + 128);
+        }
+      }
+    }
+
+    const uint8_t* data;
+    size_t len;
+    uint16_t width = 0, height = 0;
+    uint8_t count = 0;
+    uint8_t hMax = 1, vMax = 1;
+    uint16_t restartInterval = 0;
+    uint16_t quant[4][64] = {};
+    Huffman huffman[2][4];
+    Component comps[COMPONENTS];
+};
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef JSON_TOKENIZER_H
+#define JSON_TOKENIZER_H
+
+// Pull tokenizer for JSON read from a stream, for answers too big to be
+// worth a JsonDocument when only a few fields of them are needed. next()
+// reads one token at a time from the input, which it takes INPUT_WINDOW
+// bytes at a time with readBytes(); keys, strings and numbers land in a
+// fixed buffer, so nothing is allocated however big the input is. Strings
+// longer than the buffer are cut at a whole UTF-8 character and flagged as
+// truncated(). \u escapes become UTF-8.
+//
+// It is lenient about where commas and colons are; the input is trusted to
+// be JSON, only what would derail the token stream is an Error.
+//
+//   JsonTokenizer<HelixBody, 64> json(helix.body());
+//   while ((token = json.next()) != json.End && token != json.Error) ...
+
+#include <Arduino.h>
+
+// Bytes taken from the input per readBytes() call
+#ifndef INPUT_WINDOW
+#define INPUT_WINDOW 64
+#endif
+
+template<typename TInput, size_t BUFFER>
+class JsonTokenizer {
+  static_assert(INPUT_WINDOW <= 255, "the window position is a uint8_t");
+
+  public:
+    enum Token : uint8_t {
+      BeginObject, EndObject, BeginArray, EndArray,
+      Key, String, Number, True, False, Null,
+      End,   // the input ended after a whole value
+      Error  // malformed input, nested too deep or cut off
+    };
+
+    // Containers nested deeper than this are an Error
+    static const uint8_t MAX_DEPTH = 32;
+
+    explicit JsonTokenizer(TInput& input) : input(input) {}
+
+    Token next(){
+      for (;;) {
+        int c = skipSpace();
+        switch (c) {
+          case -1:
+            return depth == 0 && started ? End : Error;
+          case '{':
+          case '[':
+            if (depth == MAX_DEPTH) return Error;
+            if (c == '{') objects |= 1UL << depth;
+            else objects &= ~(1UL << depth);
+            depth++;
+            started = true;
+            expectKey = c == '{';
+            return c == '{' ? BeginObject : BeginArray;
+          case '}':
+          case ']':
+            if (!depth || inObject() != (c == '}')) return Error;
+            depth--;
+            expectKey = false;
+            return c == '}' ? EndObject : EndArray;
+          case ',':
+            expectKey = inObject();
+            continue;
+          case ':':
+            continue;
+          case '"':
+            started = true;
+            if (!readString()) return Error;
+            if (expectKey) {
+              expectKey = false;
+              return Key;
+            }
+            return String;
+          case 't':
+            return literal("rue") ? True : Error;
+          case 'f':
+            return literal("alse") ? False : Error;
+          case 'n':
+            return literal("ull") ? Null : Error;
+          default:
+            if (c != '-' && (c < '0' || c > '9')) return Error;
+            started = true;
+            readNumber(c);
+            return Number;
+        }
+      }
+    }
+
+    // Skips the value that comes next, containers included. False on an
+    // Error or the end of the input.
+    bool skipValue(){
+      uint8_t start = depth;
+      do {
+        Token t = next();
+        if (t == Error || t == End) return false;
+        if (t == EndObject || t == EndArray) {
+          if (depth < start) return false; // there was no value
+        }
+      } while (depth > start);
+      return true;
+    }
+
+    // Skips the rest of the container whose BeginObject or BeginArray was
+    // the last token. False on an Error or the end of the input.
+    bool skipContainer(){
+      if (!depth) return false;
+      uint8_t start = depth;
+      do {
+        Token t = next();
+        if (t == Error || t == End) return false;
+      } while (depth >= start);
+      return true;
+    }
+
+    // Text of the last Key, String or Number
+    const char* text() const { return buffer; }
+    size_t length() const { return len; }
+    bool truncated() const { return cut; }
+
+    // Number of containers the tokenizer is in
+    uint8_t level() const { return depth; }
+
+  private:
+    bool inObject() const { return depth && (objects >> (depth - 1)) & 1; }
+
+    int get(){
+      if (peeked != NONE) {
+        int c = peeked;
+        peeked = NONE;
+        return c;
+      }
+      if (windowPos == windowLen) {
+        windowLen = input.readBytes(window, sizeof(window));
+        windowPos = 0;
+        if (!windowLen) return -1;
+      }
+      return (uint8_t)window[windowPos++];
+    }
+
+    int skipSpace(){
+      int c;
+      do {
+        c = get();
+      } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+      return c;
+    }
+
+    bool literal(const char* rest){
+      started = true;
+      while (*rest) {
+        if (get() != *rest++) return false;
+      }
+      return true;
+    }
+
+    void readNumber(int c){
+      clear();
+      do {
+        put(c);
+        c = get();
+      } while ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '-' || c == '+');
+      peeked = c;
+      finish();
+    }
+
+    bool readString(){
+      clear();
+      for (;;) {
+        int c = get();
+        if (c < 0) return false;
+        if (c == '"') break;
+        if (c != '\\') {
+          put(c);
+          continue;
+        }
+        c = get();
+        switch (c) {
+          case 'b': put('\b'); break;
+          case 'f': put('\f'); break;
+          case 'n': put('\n'); break;
+          case 'r': put('\r'); break;
+          case 't': put('\t'); break;
+          case 'u': {
+            int32_t cp = hex4();
+            if (cp < 0) return false;
+            if (cp >= 0xD800 && cp < 0xDC00) {
+              // high surrogate, the low one has to follow
+              if (get() != '\\' || get() != 'u') return false;
+              int32_t low = hex4();
+              if (low < 0xDC00 || low >= 0xE000) return false;
+              cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+            }
+            putUtf8(cp);
+            break;
+          }
+          default:
+            if (c < 0) return false;
+            put(c); // \" \\ \/
+        }
+      }
+      finish();
+      return true;
+    }
+
+    int32_t hex4(){
+      int32_t v = 0;
+      for (uint8_t i = 0; i < 4; i++) {
+        int c = get();
+        if (c >= '0' && c <= '9') v = v*16 + c - '0';
+        else if (c >= 'a' && c <= 'f') v = v*16 + c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') v = v*16 + c - 'A' + 10;
+        else return -1;
+      }
+      return v;
+    }
+
+    void putUtf8(uint32_t cp){
+      if (cp < 0x80) {
+        put(cp);
+      } else if (cp < 0x800) {
+        put(0xC0 | cp >> 6);
+        put(0x80 | (cp & 0x3F));
+      } else if (cp < 0x10000) {
+        put(0xE0 | cp >> 12);
+        put(0x80 | ((cp >> 6) & 0x3F));
+        put(0x80 | (cp & 0x3F));
+      } else {
+        put(0xF0 | cp >> 18);
+        put(0x80 | ((cp >> 12) & 0x3F));
+        put(0x80 | ((cp >> 6) & 0x3F));
+        put(0x80 | (cp & 0x3F));
+      }
+    }
+
+    void clear(){
+      len = 0;
+      cut = false;
+    }
+
+    void put(int c){
+      if (len < BUFFER - 1) buffer[len++] = c;
+      else cut = true;
+    }
+
+    // Terminates the text, a cut one before the character it ends in the middle of
+    void finish(){
+      if (cut) {
+        size_t lead = len;
+        while (lead && (buffer[lead - 1] & 0xC0) == 0x80) lead--;
+        if (lead) {
+          uint8_t b = buffer[lead - 1];
+          size_t need = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : b >= 0xC0 ? 2 : 1;
+          if (len - (lead - 1) < need) len = lead - 1;
+        }
+      }
+      buffer[len] = 0;
+    }
+
+    static const int NONE = -2;
+
+    TInput& input;
+    char window[INPUT_WINDOW];
+    uint8_t windowPos = 0;
+    uint8_t windowLen = 0;
+    int peeked = NONE;
+    uint32_t objects = 0; // bit n: the container at depth n is an object
+    uint8_t depth = 0;
+    bool expectKey = false;
+    bool started = false;
+    char buffer[BUFFER];
+    size_t len = 0;
+    bool cut = false;
+};
+
+#endif
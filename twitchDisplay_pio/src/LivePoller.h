@@ -0,0 +1,290 @@
+#ifndef LIVE_POLLER_H
+#define LIVE_POLLER_H
+
+// Polls helix/streams on a task of its own, so loop() keeps running the
+// ticker, the backlight and OTA while DNS, TLS, the request and the parse
+// take their time. Every poll that got an answer posts the live set it
+// found to liveUpdates; loop() applies the newest one with
+// applyLiveUpdates(). The poll task only reads the ids in channels, all
+// state the display uses is changed on the loop() side. When it polls next
+// is up to PollScheduler.h. Other helix requests that would hold loop() up,
+// like the EventSub subscriptions and the avatar refresh, run on the task
+// before a poll; the EventSub WebSocket, whose connects would too, is run
+// between polls.
+//
+// On the host ([env:native_livePoll]) the task is a std::thread.
+
+#include <Arduino.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Debug.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+#include "HelixClient.h"
+#include "HelixStreams.h"
+#include "HelixTime.h"
+#include "LiveSet.h"
+#include "PollScheduler.h"
+#include "SpscQueue.h"
+#include "StreamsQuery.h"
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// TLS needs about as much stack as loop() has. The avatar refresh runs here
+// too, its decoders keep their tables on the heap. Every poll logs how much
+// of the stack was never used.
+#define LIVE_POLL_STACK 8192
+// Same as loop(), which gives the task the CPU whenever it sleeps
+#define LIVE_POLL_PRIORITY 1
+// How often the jobs between polls run
+#define LIVE_POLL_SLICE_MS 20
+
+struct liveStream {
+  uint8_t channel; // index into channels
+  std::string name;
+  std::string title; // as the ticker shows it
+  uint32_t startedAt; // helix time
+};
+
+struct liveUpdate {
+  uint32_t poll;        // number of the poll it came from
+  unsigned long pollMs; // time the poll took
+  std::vector<liveStream> streams;
+};
+
+// Only the newest update counts, a few slots are enough for a loop() that
+// was held up by an avatar refresh
+SpscQueue<liveUpdate, 4> liveUpdates;
+
+// Asks helix which channels are live, false if that did not work. The
+// update only gets the live set once every batch and page of it arrived.
+bool pollLiveChannels(liveUpdate& update, streamsFetch* fetch = nullptr){
+  std::vector<const char*> ids;
+  for (auto& channel : channels) ids.push_back(channel.id.c_str());
+
+  std::vector<bool> seen(channels.size());
+  update.streams.clear();
+  bool ok = fetchStreams(ids, [&](const streamFields& stream){
+    auto channel = std::find_if(channels.begin(), channels.end(), [&](const channelInfo& x){return x.id == stream.userId;});
+    if (channel == channels.end()) {
+      DEBUG_W.printf("[%s] helix reported unknown channel id %s\n", DEBUG_TAG, stream.userId);
+      return;
+    }
+    size_t index = channel - channels.begin();
+    // the pages shifted while helix was asked
+    if (seen[index]) return;
+    seen[index] = true;
+    liveStream live;
+    live.channel = index;
+    live.name = stream.userName;
+    live.title = "    ";
+    live.title += stream.title;
+    live.title += " | ";
+    live.title += stream.gameName;
+    live.title += "   ";
+    live.startedAt = parseIsoTime(stream.startedAt);
+    update.streams.push_back(std::move(live));
+  }, fetch);
+  if (!ok) update.streams.clear();
+  return ok;
+}
+
+class LivePoller {
+  public:
+    // Starts polling about every intervalMs, the first poll right away
+    bool begin(uint32_t intervalMs){
+      scheduler.setInterval(intervalMs);
+      started.assign(channels.size(), 0);
+      firstPoll = true;
+      stopping = false;
+#ifdef ESP_PLATFORM
+      return xTaskCreate(task, "livePoll", LIVE_POLL_STACK, this, LIVE_POLL_PRIORITY, &handle) == pdPASS;
+#else
+      woken = false;
+      thread = std::thread([this]{ run(); });
+      return true;
+#endif
+    }
+
+    // Stops polling once a poll that is under way is done. On the host it
+    // also waits for that.
+    void end(){
+      stopping = true;
+      pollNow();
+#ifndef ESP_PLATFORM
+      if (thread.joinable()) thread.join();
+#endif
+    }
+
+    // Polls right away instead of at the end of the interval
+    void pollNow(){
+#ifdef ESP_PLATFORM
+      if (handle) xTaskNotifyGive(handle);
+#else
+      {
+        std::lock_guard<std::mutex> lock(wakeLock);
+        woken = true;
+      }
+      wake.notify_one();
+#endif
+    }
+
+    // Runs job on the poll task before every poll, after the jobs added
+    // before it. Add them before begin().
+    void beforePoll(std::function<void()> job){ prePolls.push_back(job); }
+
+    // Runs job on the poll task every LIVE_POLL_SLICE_MS while it waits for
+    // the next poll. Add them before begin().
+    void betweenPolls(std::function<void()> job){ idleJobs.push_back(job); }
+
+    uint32_t polls() const { return pollCount; }
+    uint32_t failures() const { return failureCount; }
+
+    // Read it once polling ended, the poll task changes it
+    const PollScheduler& schedule() const { return scheduler; }
+
+  private:
+    // Polls and returns how long to wait for the next one
+    uint32_t poll(){
+      for (auto& job : prePolls) job();
+      liveUpdate update;
+      streamsFetch fetch;
+      update.poll = ++pollCount;
+      unsigned long t = millis();
+      bool ok = pollLiveChannels(update, &fetch);
+      update.pollMs = millis() - t;
+      if (ok) {
+        noteGoLives(update, fetch.now);
+        if (!liveUpdates.push(std::move(update))) {
+          DEBUG_W.printf("[%s] Live updates not taken, dropped poll %u\n", DEBUG_TAG, pollCount.load());
+        }
+      } else {
+        failureCount++;
+      }
+      uint32_t wait = scheduler.next(ok, fetch.code, fetch.requests, fetch.rate, fetch.now);
+      DEBUG_I.printf("[%s] Next poll in %u ms (%u of %u points left)\n", DEBUG_TAG,
+        wait, fetch.rate.remaining, fetch.rate.limit);
+#ifdef ESP_PLATFORM
+      // in bytes on ESP-IDF
+      DEBUG_I.printf("[%s] Poll task: %u of %u stack bytes never used\n", DEBUG_TAG,
+        (uint32_t)uxTaskGetStackHighWaterMark(nullptr), LIVE_POLL_STACK);
+#endif
+      return wait;
+    }
+
+    // Tells the scheduler about the streams that were not live at the last poll
+    void noteGoLives(const liveUpdate& update, uint32_t now){
+      std::vector<uint32_t> live(channels.size(), 0);
+      for (const liveStream& stream : update.streams) {
+        live[stream.channel] = stream.startedAt;
+        if (started[stream.channel] == stream.startedAt) continue;
+        scheduler.wentLive(stream.startedAt, firstPoll ? 0 : now);
+        if (!firstPoll && now >= stream.startedAt) {
+          DEBUG_I.printf("[%s] %s went live %u s before it showed up\n", DEBUG_TAG,
+            stream.name.c_str(), now - stream.startedAt);
+        }
+      }
+      started = std::move(live);
+      firstPoll = false;
+    }
+
+#ifdef ESP_PLATFORM
+    static void task(void* arg){
+      LivePoller* self = (LivePoller*)arg;
+      while (!self->stopping) {
+        uint32_t wait = self->poll();
+        unsigned long start = millis();
+        for (;;) {
+          uint32_t waited = millis() - start;
+          if (waited >= wait) break;
+          uint32_t slice = self->idleJobs.empty() ? wait - waited : std::min<uint32_t>(wait - waited, LIVE_POLL_SLICE_MS);
+          if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(slice)) || self->stopping) break;
+          for (auto& job : self->idleJobs) job();
+        }
+      }
+      self->handle = nullptr;
+      vTaskDelete(nullptr);
+    }
+
+    TaskHandle_t handle = nullptr;
+#else
+    void run(){
+      std::unique_lock<std::mutex> lock(wakeLock);
+      while (!stopping) {
+        lock.unlock();
+        uint32_t wait = poll();
+        lock.lock();
+        auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait);
+        for (;;) {
+          auto slice = idleJobs.empty() ? until
+            : std::min(until, std::chrono::steady_clock::now() + std::chrono::milliseconds(LIVE_POLL_SLICE_MS));
+          if (wake.wait_until(lock, slice, [this]{ return woken || stopping; })) break;
+          if (std::chrono::steady_clock::now() >= until) break;
+          lock.unlock();
+          for (auto& job : idleJobs) job();
+          lock.lock();
+        }
+        woken = false;
+      }
+    }
+
+    std::thread thread;
+    std::mutex wakeLock;
+    std::condition_variable wake;
+    bool woken = false;
+#endif
+
+    PollScheduler scheduler;
+    std::vector<std::function<void()>> prePolls;
+    std::vector<std::function<void()>> idleJobs;
+    std::vector<uint32_t> started; // per channel, 0 while offline
+    bool firstPoll = true;
+    std::atomic<bool> stopping{false};
+    std::atomic<uint32_t> pollCount{0};
+    std::atomic<uint32_t> failureCount{0};
+};
+
+LivePoller livePoller;
+
+// Makes a live set the one on the display. Only what changed since the last
+// one is redrawn or queued for the ticker, see LiveSet.h; channels EventSub
+// changed lately keep what it said. Returns the number of changes.
+size_t applyLiveUpdate(const liveUpdate& update){
+  channelSet live;
+  const std::string* titles[std::tuple_size<decltype(channels)>::value] = {};
+  for (const liveStream& stream : update.streams) {
+    live.set(stream.channel);
+    titles[stream.channel] = &stream.title;
+  }
+  channelSet shown = shownLiveSet();
+  keepHeld(shown, live, titles);
+  std::vector<liveEvent> events;
+  diffLiveSets(shown, live, titles, events);
+  DEBUG_I.printf("[%s] Poll %u took %lu ms, %u channels live, %u changes\n", DEBUG_TAG,
+    update.poll, update.pollMs, (uint32_t)live.count(), (uint32_t)events.size());
+  applyLiveEvents(events);
+  return events.size();
+}
+
+// Applies the newest of the live sets posted since the last call, returns
+// false if there was none. Call from loop().
+bool applyLiveUpdates(){
+  liveUpdate update, newer;
+  if (!liveUpdates.pop(update)) return false;
+  while (liveUpdates.pop(newer)) update = std::move(newer);
+  applyLiveUpdate(update);
+  return true;
+}
+
+#endif
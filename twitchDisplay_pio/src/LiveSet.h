@@ -0,0 +1,147 @@
+#ifndef LIVE_SET_H
+#define LIVE_SET_H
+
+// Changes of the live channels as events, so the display only redraws what
+// changed: a channel going live takes a free slot, one going offline frees
+// its slot, and the channels that stay live keep theirs. A new title only
+// goes to the ticker.
+//
+//   diffLiveSets(was, is, titles, events);
+//   applyLiveEvents(events);
+//
+// What EventSub reports is ahead of helix/streams by a minute or two, so a
+// change it made is held against the polls for a while, see holdLive().
+
+#include <Arduino.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Debug.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+
+// How long a change EventSub reported wins over what the polls say, unless
+// they agree with it before
+#define LIVE_HOLD_MS (3*60*1000UL)
+
+enum liveEventType : uint8_t {
+  WentLive,
+  WentOffline,
+  TitleChanged
+};
+
+struct liveEvent {
+  liveEventType type;
+  uint8_t channel;   // index into channels
+  std::string title; // as the ticker shows it, empty for WentOffline
+};
+
+// The channels the display shows as live
+channelSet shownLiveSet(){
+  channelSet live;
+  for (size_t i = 0; i < channels.size(); i++) live[i] = channels[i].isLive;
+  return live;
+}
+
+// Channels whose live state or title EventSub changed lately, and when
+struct liveHold {
+  channelSet held;
+  unsigned long since[std::tuple_size<decltype(channels)>::value];
+
+  void hold(uint8_t channel){
+    held.set(channel);
+    since[channel] = millis();
+  }
+
+  // The ones still held
+  const channelSet& current(){
+    for (size_t i = 0; i < channels.size(); i++) {
+      if (held[i] && millis() - since[i] >= LIVE_HOLD_MS) held.reset(i);
+    }
+    return held;
+  }
+};
+
+liveHold liveHolds, titleHolds;
+
+// Keeps polls from undoing for LIVE_HOLD_MS what EventSub just reported
+void holdLive(uint8_t channel){ liveHolds.hold(channel); }
+void holdTitle(uint8_t channel){ titleHolds.hold(channel); }
+
+// Takes the shown state and title over from the display for the channels
+// that are held, in a polled live set and its titles. A poll that agrees
+// ends the hold of the live state.
+void keepHeld(const channelSet& shown, channelSet& live, const std::string* titles[]){
+  channelSet held = liveHolds.current();
+  // helix caught up
+  liveHolds.held &= ~(held & ~(live ^ shown));
+  live = (live & ~held) | (shown & held);
+  const channelSet& titleHeld = titleHolds.current();
+  for (size_t i = 0; i < channels.size(); i++) {
+    if (live[i] && (!titles[i] || titleHeld[i])) titles[i] = &channels[i].streamTitle;
+  }
+}
+
+// Appends the events that turn live set was into is. titles[i] is the title
+// of channels[i] if it is in is.
+void diffLiveSets(const channelSet& was, const channelSet& is, const std::string* const titles[], std::vector<liveEvent>& events){
+  channelSet wentLive = is & ~was;
+  channelSet wentOffline = was & ~is;
+  channelSet stayed = is & was;
+  for (uint8_t i = 0; i < channels.size(); i++) {
+    if (wentLive[i]) {
+      events.push_back({WentLive, i, *titles[i]});
+    } else if (wentOffline[i]) {
+      events.push_back({WentOffline, i, ""});
+    } else if (stayed[i] && channels[i].streamTitle != *titles[i]) {
+      events.push_back({TitleChanged, i, *titles[i]});
+    }
+  }
+}
+
+// Queues the title of ch for the ticker, unless it is queued already
+void queueTitle(channelInfo* ch){
+  if (std::find(titleChangeQueue.begin(), titleChangeQueue.end(), ch) == titleChangeQueue.end()) {
+    titleChangeQueue.push_back(ch);
+  }
+}
+
+// Makes the changes the events describe and redraws the slots if a channel
+// came or went. Events that change nothing, like a WentLive for a channel
+// that is live already, are fine.
+void applyLiveEvents(const std::vector<liveEvent>& events){
+  bool slotsChanged = false;
+  for (const liveEvent& event : events) {
+    channelInfo* ch = &channels[event.channel];
+    switch (event.type) {
+      case WentLive:
+        if (!ch->isLive) {
+          DEBUG_I.printf("[%s] Channel %s went live\n", DEBUG_TAG, ch->id.c_str());
+          ch->isLive = true;
+          live_num++;
+          slotsChanged = true;
+          ch->streamTitle = event.title;
+          queueTitle(ch);
+          break;
+        }
+        // fall through - it is only news if the title is
+      case TitleChanged:
+        if (ch->streamTitle == event.title) break;
+        ch->streamTitle = event.title;
+        if (ch->isLive) queueTitle(ch);
+        break;
+      case WentOffline:
+        if (!ch->isLive) break;
+        DEBUG_I.printf("[%s] Channel %s went offline\n", DEBUG_TAG, ch->id.c_str());
+        ch->isLive = false;
+        live_num--;
+        slotsChanged = true;
+        titleChangeQueue.erase(std::remove(titleChangeQueue.begin(), titleChangeQueue.end(), ch), titleChangeQueue.end());
+        break;
+    }
+  }
+  if (slotsChanged) redrawLiveChannelPics();
+}
+
+#endif
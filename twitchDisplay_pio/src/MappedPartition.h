@@ -0,0 +1,128 @@
+#ifndef MAPPED_PARTITION_H
+#define MAPPED_PARTITION_H
+
+// A data partition mapped into the address space, so its contents can be
+// read (and sent to the panel) through a plain pointer. Writes go through
+// esp_partition_write(), which flushes the flash cache for the range, so
+// the mapping sees them right away.
+//
+// On the host the file <label>.bin stands in for the partition and is
+// written back on every change. It is looked for in $SIM_DATA_DIR, or in
+// data/ of the working directory when that is not set, so a program run from
+// the project directory maps the data/assets.bin scripts/pics_build.py writes.
+
+#include <Arduino.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_partition.h>
+#include <esp_idf_version.h>
+#else
+#include <string>
+#include <vector>
+#endif
+
+class MappedPartition {
+  public:
+    static const uint32_t SECTOR_SIZE = 4096;
+
+    // hostSize is the size of the stand-in on the host if there is no
+    // file for it yet, 0 if it has to exist
+    bool begin(const char* label, uint32_t hostSize = 0){
+      end();
+#ifdef ESP_PLATFORM
+      (void)hostSize;
+      part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+      if (!part) return false;
+      const void* ptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+      if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &handle) != ESP_OK) return false;
+#else
+      if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) return false;
+#endif
+      base = (const uint8_t*)ptr;
+      len = part->size;
+#else
+      const char* dir = getenv("SIM_DATA_DIR");
+      path = std::string(dir ? dir : "data") + "/" + label + ".bin";
+      image.clear();
+      if (FILE* f = fopen(path.c_str(), "rb")) {
+        uint8_t buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) image.insert(image.end(), buf, buf + n);
+        fclose(f);
+      } else if (hostSize) {
+        image.assign(hostSize, 0xFF);
+      } else {
+        return false;
+      }
+      base = image.data();
+      len = image.size();
+#endif
+      return true;
+    }
+
+    void end(){
+#ifdef ESP_PLATFORM
+      if (base) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+        esp_partition_munmap(handle);
+#else
+        spi_flash_munmap(handle);
+#endif
+      }
+      part = nullptr;
+#endif
+      base = nullptr;
+      len = 0;
+    }
+
+    const uint8_t* data() const { return base; }
+    uint32_t size() const { return len; }
+
+    // offset and length have to be multiples of SECTOR_SIZE
+    bool erase(uint32_t offset, uint32_t length){
+      if (!base || offset % SECTOR_SIZE || length % SECTOR_SIZE || offset > len || length > len - offset) return false;
+#ifdef ESP_PLATFORM
+      return esp_partition_erase_range(part, offset, length) == ESP_OK;
+#else
+      std::fill(image.begin() + offset, image.begin() + offset + length, 0xFF);
+      return save();
+#endif
+    }
+
+    // Like flash, only clears bits, so the range has to be erased first
+    bool write(uint32_t offset, const void* src, uint32_t length){
+      if (!base || offset > len || length > len - offset) return false;
+#ifdef ESP_PLATFORM
+      return esp_partition_write(part, offset, src, length) == ESP_OK;
+#else
+      const uint8_t* s = (const uint8_t*)src;
+      for (uint32_t i = 0; i < length; i++) image[offset + i] &= s[i];
+      return save();
+#endif
+    }
+
+  private:
+#ifdef ESP_PLATFORM
+    const esp_partition_t* part = nullptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_mmap_handle_t handle;
+#else
+    spi_flash_mmap_handle_t handle;
+#endif
+#else
+    bool save(){
+      FILE* f = fopen(path.c_str(), "wb");
+      if (!f) return false;
+      bool ok = fwrite(image.data(), 1, image.size(), f) == image.size();
+      return fclose(f) == 0 && ok;
+    }
+
+    std::string path;
+    std::vector<uint8_t> image;
+#endif
+    const uint8_t* base = nullptr;
+    uint32_t len = 0;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef PALETTE_DECODER_H
+#define PALETTE_DECODER_H
+
+// Palette pics (written by scripts/pics_build.py with palette = yes): up to
+// 256 RGB565 colours and one index byte per pixel, about half the size of
+// the pic in wire order.
+//
+//   byte 0        number of colours - 1
+//   byte 1        0
+//   2 * colours   the colours in wire order
+//   pixels        one index per pixel, row by row
+//
+// decode() looks every index up as it goes, so a pic is drawn straight from
+// flash into the SPI line buffers without being unpacked into RAM first.
+
+#include <Arduino.h>
+
+class PaletteDecoder {
+  public:
+    // data has to be 2 byte aligned
+    explicit PaletteDecoder(const uint8_t* data)
+      : colors((const uint16_t*)(data + 2)), p(data + 2 + size(data)*2) {}
+
+    // Writes the next len pixels to dst in wire order
+    void decode(uint16_t* dst, uint32_t len){
+      while (len--) *dst++ = colors[*p++];
+    }
+
+    // Number of colours
+    static uint16_t size(const uint8_t* data){ return data[0] + 1; }
+
+    // Whether the len bytes at data are a valid pic with pixels pixels
+    static bool valid(const uint8_t* data, uint32_t len, uint32_t pixels){
+      if (len < 2 || data[1] != 0 || len != 2 + size(data)*2 + pixels) return false;
+      const uint8_t* index = data + 2 + size(data)*2;
+      for (uint32_t i = 0; i < pixels; i++) {
+        if (index[i] >= size(data)) return false;
+      }
+      return true;
+    }
+
+  private:
+    const uint16_t* colors;
+    const uint8_t* p;
+};
+
+#endif
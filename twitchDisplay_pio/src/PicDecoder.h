@@ -0,0 +1,79 @@
+#ifndef PIC_DECODER_H
+#define PIC_DECODER_H
+
+// Streaming decoder for packed pics (pics.h, written by
+// scripts/pics_build.py). A QOI-like byte code for RGB565:
+//
+//   00iiiiii            INDEX  pixel from a 64 entry table of seen pixels
+//   01rrggbb            DIFF   dr, dg, db in -2..1 (each stored +2)
+//   10gggggg rrrrbbbb   LUMA   dg in -32..31, dr-dg/2 and db-dg/2 in -8..7
+//   11nnnnnn            RUN    previous pixel 1..62 more times (stored -1)
+//   11111110 hi lo      RGB    pixel as is, in wire order
+//
+// decode() can be called with any number of pixels at a time, so a pic is
+// unpacked straight into the SPI line buffers without an 8 KB copy of it.
+
+#include <Arduino.h>
+
+class PicDecoder {
+  public:
+    explicit PicDecoder(const uint8_t* data) : p(data) {}
+
+    // Writes the next len pixels to dst in wire order
+    void decode(uint16_t* dst, uint32_t len){
+      while (len) {
+        if (run) {
+          uint32_t n = std::min<uint32_t>(run, len);
+          std::fill(dst, dst + n, __builtin_bswap16(px));
+          dst += n;
+          len -= n;
+          run -= n;
+          continue;
+        }
+
+        uint8_t op = pgm_read_byte(p++);
+        if (op == OP_RGB) {
+          px = (pgm_read_byte(p) << 8) | pgm_read_byte(p+1);
+          p += 2;
+        } else if ((op & 0xC0) == OP_RUN) {
+          run = (op & 0x3F) + 1;
+          continue;
+        } else if ((op & 0xC0) == OP_INDEX) {
+          px = index[op & 0x3F];
+        } else if ((op & 0xC0) == OP_DIFF) {
+          px = pack(r() + ((op >> 4) & 3) - 2, g() + ((op >> 2) & 3) - 2, b() + (op & 3) - 2);
+        } else {
+          int8_t dg = (op & 0x3F) - 32;
+          uint8_t d = pgm_read_byte(p++);
+          px = pack(r() + (dg >> 1) + (d >> 4) - 8, g() + dg, b() + (dg >> 1) + (d & 15) - 8);
+        }
+        index[slot(px)] = px;
+        *dst++ = __builtin_bswap16(px);
+        len--;
+      }
+    }
+
+  private:
+    static const uint8_t OP_INDEX = 0x00;
+    static const uint8_t OP_DIFF = 0x40;
+    static const uint8_t OP_LUMA = 0x80;
+    static const uint8_t OP_RUN = 0xC0;
+    static const uint8_t OP_RGB = 0xFE;
+
+    int16_t r() const { return (px >> 11) & 31; }
+    int16_t g() const { return (px >> 5) & 63; }
+    int16_t b() const { return px & 31; }
+    static uint16_t pack(int16_t r, int16_t g, int16_t b){
+      return ((r & 31) << 11) | ((g & 63) << 5) | (b & 31);
+    }
+    uint8_t slot(uint16_t c) const {
+      return (((c >> 11) & 31)*3 + ((c >> 5) & 63)*5 + (c & 31)*7) % 64;
+    }
+
+    const uint8_t* p;
+    uint16_t px = 0;
+    uint8_t run = 0;
+    uint16_t index[64] = {};
+};
+
+#endif
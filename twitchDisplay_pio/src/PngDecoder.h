@@ -0,0 +1,223 @@
+#ifndef PNG_DECODER_H
+#define PNG_DECODER_H
+
+// PNG decoder for downloaded avatars: 8 bit grey, RGB, grey+alpha, RGBA and
+// palette images, grey and palette also with 1, 2 or 4 bits, without
+// interlacing. After sink.begin(width, height) every row goes to
+// sink.row(rgb) as RGB888 with transparent parts put on black. Only two
+// rows of the image are in RAM at a time.
+
+#include <Arduino.h>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "Inflate.h"
+
+// Larger images are refused rather than running out of memory
+#define PNG_MAX_SIZE 1024
+
+class PngDecoder {
+  public:
+    template<typename Sink>
+    static bool decode(const uint8_t* data, size_t len, Sink& sink){
+      // the palette, and inflate's tables, stay off the decoding task's stack
+      std::unique_ptr<PngDecoder> png(new (std::nothrow) PngDecoder(data, len));
+      return png && png->run(sink);
+    }
+
+  private:
+    PngDecoder(const uint8_t* data, size_t len) : data(data), len(len) {
+      memset(alpha, 255, sizeof(alpha));
+    }
+
+    static uint32_t be32(const uint8_t* p){
+      return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    // The compressed bytes of all IDAT chunks in a row
+    struct IdatSource {
+      const uint8_t* data;
+      size_t len;
+      size_t pos;
+      size_t end;
+
+      int next(){
+        while (pos == end) {
+          // skip the CRC, the next chunk has to be another IDAT
+          size_t chunk = end + 4;
+          if (chunk + 8 > len || memcmp(data + chunk + 4, "IDAT", 4) != 0) return -1;
+          uint32_t n = be32(data + chunk);
+          if (n > len - chunk - 8) return -1;
+          pos = chunk + 8;
+          end = pos + n;
+        }
+        return data[pos++];
+      }
+    };
+
+    // Collects inflated bytes into rows, undoes the filters and hands
+    // every row on as RGB888
+    template<typename Sink>
+    struct Rows {
+      PngDecoder& png;
+      Sink& sink;
+      std::vector<uint8_t> cur, prev, rgb;
+      uint32_t fill = 0;
+      uint32_t y = 0;
+
+      bool put(uint8_t b){
+        if (y >= png.height) return false;
+        cur[fill++] = b;
+        if (fill < cur.size()) return true;
+        fill = 0;
+        if (!unfilter()) return false;
+        png.convert(cur.data() + 1, rgb.data());
+        sink.row(rgb.data());
+        std::swap(cur, prev);
+        y++;
+        return true;
+      }
+
+      bool unfilter(){
+        uint8_t* row = cur.data() + 1;
+        const uint8_t* up = prev.data() + 1;
+        uint32_t n = cur.size() - 1, bpp = png.filterBytes;
+        switch (cur[0]) {
+          case 0: break;
+          case 1: for (uint32_t i = bpp; i < n; i++) row[i] += row[i-bpp]; break;
+          case 2: for (uint32_t i = 0; i < n; i++) row[i] += up[i]; break;
+          case 3:
+            for (uint32_t i = 0; i < n; i++) row[i] += ((i >= bpp ? row[i-bpp] : 0) + up[i]) >> 1;
+            break;
+          case 4:
+            for (uint32_t i = 0; i < n; i++) {
+              int a = i >= bpp ? row[i-bpp] : 0, b = up[i], c = i >= bpp ? up[i-bpp] : 0;
+              int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+              row[i] += (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+            }
+            break;
+          default: return false;
+        }
+        return true;
+      }
+    };
+
+    template<typename Sink>
+    bool run(Sink& sink){
+      if (len < 8 || memcmp(data, "\x89PNG\r\n\x1a\n", 8) != 0) return false;
+      size_t pos = 8;
+      bool header = false;
+      while (pos + 8 <= len) {
+        uint32_t n = be32(data + pos);
+        const uint8_t* type = data + pos + 4;
+        const uint8_t* body = data + pos + 8;
+        if (n > len - pos - 8) return false;
+        if (memcmp(type, "IHDR", 4) == 0 && n >= 13) {
+          width = be32(body);
+          height = be32(body + 4);
+          depth = body[8];
+          color = body[9];
+          if (body[10] || body[11] || body[12]) return false; // only deflate, filter method 0, no interlacing
+          header = true;
+        } else if (memcmp(type, "PLTE", 4) == 0) {
+          paletteSize = std::min<uint32_t>(n/3, 256);
+          memcpy(palette, body, paletteSize*3);
+        } else if (memcmp(type, "tRNS", 4) == 0) {
+          if (color == 3) {
+            memcpy(alpha, body, std::min<uint32_t>(n, 256));
+          } else if ((color == 0 && n >= 2) || (color == 2 && n >= 6)) {
+            hasKey = true;
+            for (uint8_t c = 0; c < (color ? 3 : 1); c++) key[c] = (body[c*2] << 8) | body[c*2+1];
+          }
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+          if (!header || !setup()) return false;
+          IdatSource source = {data, len, pos + 8, pos + 8 + n};
+          Rows<Sink> rows = {*this, sink, std::vector<uint8_t>(stride + 1), std::vector<uint8_t>(stride + 1),
+            std::vector<uint8_t>(width*3)};
+          sink.begin(width, height);
+          std::unique_ptr<Inflate<IdatSource, Rows<Sink>>> inflate(new (std::nothrow) Inflate<IdatSource, Rows<Sink>>(source, rows));
+          return inflate && inflate->zlib() && rows.y == height;
+        }
+        pos += 12 + n;
+      }
+      return false;
+    }
+
+    bool setup(){
+      if (!width || !height || width > PNG_MAX_SIZE || height > PNG_MAX_SIZE) return false;
+      switch (color) {
+        case 0: channels = 1; break;
+        case 2: channels = 3; break;
+        case 3: channels = 1; break;
+        case 4: channels = 2; break;
+        case 6: channels = 4; break;
+        default: return false;
+      }
+      bool lowDepth = depth == 1 || depth == 2 || depth == 4;
+      if (depth != 8 && !((color == 0 || color == 3) && lowDepth)) return false;
+      if (color == 3 && !paletteSize) return false;
+      stride = (width*channels*depth + 7)/8;
+      filterBytes = std::max<uint32_t>(1, channels*depth/8);
+      return true;
+    }
+
+    // One unfiltered row to RGB888
+    void convert(const uint8_t* row, uint8_t* rgb) const {
+      for (uint32_t x = 0; x < width; x++, rgb += 3) {
+        uint8_t r, g, b, a = 255;
+        if (depth < 8) {
+          uint32_t bit = x*depth;
+          uint8_t v = (row[bit/8] >> (8 - depth - bit%8)) & ((1 << depth) - 1);
+          if (color == 3) {
+            paletteColor(v, r, g, b, a);
+          } else {
+            if (hasKey && v == key[0]) a = 0;
+            r = g = b = v*255/((1 << depth) - 1);
+          }
+        } else {
+          const uint8_t* p = row + x*channels;
+          switch (color) {
+            case 0:
+              r = g = b = p[0];
+              if (hasKey && p[0] == key[0]) a = 0;
+              break;
+            case 2:
+              r = p[0]; g = p[1]; b = p[2];
+              if (hasKey && r == key[0] && g == key[1] && b == key[2]) a = 0;
+              break;
+            case 3: paletteColor(p[0], r, g, b, a); break;
+            case 4: r = g = b = p[0]; a = p[1]; break;
+            default: r = p[0]; g = p[1]; b = p[2]; a = p[3];
+          }
+        }
+        rgb[0] = (r*a + 127)/255;
+        rgb[1] = (g*a + 127)/255;
+        rgb[2] = (b*a + 127)/255;
+      }
+    }
+
+    void paletteColor(uint8_t i, uint8_t& r, uint8_t& g, uint8_t& b, uint8_t& a) const {
+      if (i >= paletteSize) {
+        r = g = b = 0;
+        return;
+      }
+      r = palette[i][0];
+      g = palette[i][1];
+      b = palette[i][2];
+      a = alpha[i];
+    }
+
+    const uint8_t* data;
+    size_t len;
+    uint32_t width = 0, height = 0;
+    uint8_t depth = 0, color = 0, channels = 0;
+    uint32_t stride = 0, filterBytes = 1;
+    uint8_t palette[256][3];
+    uint16_t paletteSize = 0;
+    uint8_t alpha[256];
+    bool hasKey = false;
+    uint16_t key[3] = {};
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+// When the live poll task asks helix next. Normally every interval, more
+// often around the times of day channels went live before, and never faster
+// than the points helix has left for the token allow, so several displays
+// can share one token without being throttled. After a failed poll it backs
+// off exponentially, after a 429 until helix refills the points. Every wait
+// is jittered so displays that started together do not poll in step.
+//
+// It also keeps how long after going live a channel showed up, from the
+// started_at helix reports.
+
+#include <Arduino.h>
+
+#include "HelixClient.h"
+
+// Go-live times are kept per quarter hour of the day, UTC
+#define GO_LIVE_SLOTS 96
+#define GO_LIVE_SLOT_S (24*60*60/GO_LIVE_SLOTS)
+// Quarter hours with this many go-lives before are polled faster, and the
+// one before them
+#define GO_LIVE_TYPICAL 2
+// How much faster
+#define POLL_SPEEDUP 3
+// Percent of the points of the token left for other displays and the
+// avatar lookups
+#define RATE_LIMIT_RESERVE 25
+// Longest wait after failed polls
+#define POLL_MAX_BACKOFF (10*60*1000UL)
+// Percent a wait is moved by at most, either way unless that would be too
+// early for the points of the token
+#define POLL_JITTER 10
+
+class PollScheduler {
+  public:
+    explicit PollScheduler(uint32_t intervalMs = 0) : interval(intervalMs) {}
+
+    void setInterval(uint32_t intervalMs){ interval = intervalMs; }
+
+    // A stream that started at started was seen live for the first time at
+    // detected (both helix time), 0 if it was live before polling started
+    void wentLive(uint32_t started, uint32_t detected){
+      if (!started) return;
+      uint8_t& count = goLives[started % 86400 / GO_LIVE_SLOT_S];
+      if (count == 255) {
+        // halve them all, so old habits fade
+        for (auto& c : goLives) c /= 2;
+      }
+      count++;
+      if (detected && detected >= started) {
+        uint32_t latency = detected - started;
+        detections++;
+        latencySum += latency;
+        latencyMax = std::max(latencyMax, latency);
+      }
+    }
+
+    // Whether now (helix time) is in or just before a quarter hour channels
+    // typically go live in
+    bool nearGoLive(uint32_t now) const {
+      if (!now) return false;
+      uint16_t slot = now % 86400 / GO_LIVE_SLOT_S;
+      return goLives[slot] >= GO_LIVE_TYPICAL || goLives[(slot + 1) % GO_LIVE_SLOTS] >= GO_LIVE_TYPICAL;
+    }
+
+    // Milliseconds to wait after a poll that did or did not work. code is the
+    // HTTP code of its last request, requests how many it took, rate and now
+    // (helix time, 0 if unknown) as of its last answer.
+    uint32_t next(bool ok, int code, uint32_t requests, const HelixClient::RateLimit& rate, uint32_t now){
+      bool limited = rate.known && now && rate.reset > now;
+      uint32_t toReset = limited ? std::min<uint32_t>(rate.reset - now, POLL_MAX_BACKOFF/1000) * 1000 : 0;
+      uint32_t wait;
+      if (ok) {
+        failures = 0;
+        wait = nearGoLive(now) ? interval / POLL_SPEEDUP : interval;
+      } else if (code == 429 && limited) {
+        failures = std::min(failures + 1, 255);
+        wait = toReset;
+      } else {
+        // 5xx, no answer or a broken one: double the wait up to the cap
+        failures = std::min(failures + 1, 255);
+        wait = std::min<uint64_t>(POLL_MAX_BACKOFF, (uint64_t)interval << std::min<uint8_t>(failures, 16));
+      }
+      uint32_t jitter = wait * POLL_JITTER / 100;
+      wait = wait - jitter + random(2 * jitter + 1);
+
+      if (limited) {
+        // spread the points above the reserve until the reset over the
+        // polls; jitter only makes that wait longer
+        uint32_t reserve = rate.limit * RATE_LIMIT_RESERVE / 100;
+        uint32_t budget = rate.remaining > reserve ? rate.remaining - reserve : 0;
+        uint32_t least = budget < requests ? toReset : (uint64_t)toReset * requests / budget;
+        if (wait < least) wait = least + random(least * POLL_JITTER / 100 + 1);
+      }
+      return wait;
+    }
+
+    uint8_t failedPolls() const { return failures; }
+
+    // Go-lives seen while polling and how long they took to show up, seconds
+    uint32_t detectedGoLives() const { return detections; }
+    uint32_t meanLatency() const { return detections ? latencySum / detections : 0; }
+    uint32_t maxLatency() const { return latencyMax; }
+
+  private:
+    uint32_t interval;
+    uint8_t failures = 0;
+    uint8_t goLives[GO_LIVE_SLOTS] = {};
+    uint32_t detections = 0;
+    uint32_t latencySum = 0;
+    uint32_t latencyMax = 0;
+};
+
+#endif
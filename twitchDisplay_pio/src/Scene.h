@@ -0,0 +1,173 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+// Retained description of what the panel shows: the slot grid with the
+// channel pics, their borders, the "+N" tile and the title ticker band that
+// covers one row of slots while a title scrolls.
+//
+// The renderer keeps the scene it last sent and the scene it wants to show.
+// diffScene() works out the rectangles that differ between the two, so all
+// layout arithmetic lives here and the drawing code only fills them in.
+
+#include <Arduino.h>
+#include <Adafruit_ST7789.h>
+#include <array>
+
+#define MAX_NUM_PICS 8
+#define SLOTS_PER_ROW 4
+#define SLOT_SIZE 64
+#define SLOT_BORDER 7
+// Space between two slot pics and above the first row
+#define SLOT_GAP 14
+#define SLOT_X0 11
+#define SLOT_PIC_BYTES (SLOT_SIZE*SLOT_SIZE*2)
+#define SLOT_BORDER_BYTES ((2*(SLOT_SIZE+2*SLOT_BORDER)+2*SLOT_SIZE)*SLOT_BORDER*2)
+
+// The ticker band lies exactly over the pics of one row of slots
+#define TICKER_X SLOT_X0
+#define TICKER_W (SLOTS_PER_ROW*SLOT_SIZE+(SLOTS_PER_ROW-1)*SLOT_GAP)
+#define TICKER_H SLOT_SIZE
+
+// Enough for every pic and every border piece of a full redraw
+#define SCENE_MAX_UPDATES (MAX_NUM_PICS*(1+4*4)+1)
+
+struct SceneRect {
+  int16_t x, y, w, h;
+
+  bool empty() const { return w <= 0 || h <= 0; }
+
+  SceneRect intersect(const SceneRect& o) const {
+    int16_t x1 = std::max(x, o.x), y1 = std::max(y, o.y);
+    int16_t x2 = std::min<int16_t>(x+w, o.x+o.w), y2 = std::min<int16_t>(y+h, o.y+o.h);
+    return {x1, y1, (int16_t)(x2-x1), (int16_t)(y2-y1)};
+  }
+  bool intersects(const SceneRect& o) const { return !intersect(o).empty(); }
+  bool contains(const SceneRect& o) const {
+    return o.x >= x && o.y >= y && o.x+o.w <= x+w && o.y+o.h <= y+h;
+  }
+};
+
+struct SlotScene {
+  const char* avatar;  // id of the channel whose pic is shown, nullptr when blank
+  uint8_t overflow;    // >0 shows the "+N" tile instead of the pic
+  uint16_t border;
+};
+
+struct Scene {
+  std::array<SlotScene, MAX_NUM_PICS> slots;
+  int8_t tickerRow;      // slot row covered by the ticker, -1 when hidden
+  uint16_t tickerScroll; // column of the scaled up title at TICKER_X
+};
+
+enum SceneItem : uint8_t {
+  SCENE_SLOT_PIC,
+  SCENE_BORDER,
+  SCENE_TICKER
+};
+
+struct SceneUpdate {
+  SceneItem item;
+  uint8_t slot;
+  SceneRect rect;
+};
+
+// Scene with all slots blank and black bordered and no ticker
+Scene blankScene(){
+  Scene s;
+  for (SlotScene& slot : s.slots) {
+    slot = {nullptr, 0, ST77XX_BLACK};
+  }
+  s.tickerRow = -1;
+  s.tickerScroll = 0;
+  return s;
+}
+
+SceneRect slotRect(uint8_t slot){
+  return {
+    (int16_t)(SLOT_X0 + (SLOT_SIZE+SLOT_GAP)*(slot%SLOTS_PER_ROW)),
+    (int16_t)(SLOT_GAP + (SLOT_SIZE+SLOT_GAP)*(slot/SLOTS_PER_ROW)),
+    SLOT_SIZE, SLOT_SIZE
+  };
+}
+
+// The four bars of the border around a slot, sides only between top and
+// bottom so no pixel is covered twice
+void slotBorderRects(uint8_t slot, SceneRect out[4]){
+  SceneRect r = slotRect(slot);
+  const int16_t t = SLOT_BORDER;
+  out[0] = {(int16_t)(r.x-t), (int16_t)(r.y-t), (int16_t)(r.w+t+t), t};
+  out[1] = {(int16_t)(r.x-t), (int16_t)(r.y+r.h), (int16_t)(r.w+t+t), t};
+  out[2] = {(int16_t)(r.x-t), r.y, t, r.h};
+  out[3] = {(int16_t)(r.x+r.w), r.y, t, r.h};
+}
+
+// Empty when row is negative
+SceneRect tickerRect(int8_t row){
+  if (row < 0) return {0, 0, 0, 0};
+  return {TICKER_X, slotRect(row*SLOTS_PER_ROW).y, TICKER_W, TICKER_H};
+}
+
+// Pieces of a that b does not cover, at most four
+uint8_t subtractRect(const SceneRect& a, const SceneRect& b, SceneRect out[4]){
+  if (a.empty()) return 0;
+  SceneRect i = a.intersect(b);
+  if (i.empty()) {
+    out[0] = a;
+    return 1;
+  }
+  uint8_t n = 0;
+  if (i.y > a.y) out[n++] = {a.x, a.y, a.w, (int16_t)(i.y-a.y)};
+  if (i.y+i.h < a.y+a.h) out[n++] = {a.x, (int16_t)(i.y+i.h), a.w, (int16_t)(a.y+a.h-i.y-i.h)};
+  if (i.x > a.x) out[n++] = {a.x, i.y, (int16_t)(i.x-a.x), i.h};
+  if (i.x+i.w < a.x+a.w) out[n++] = {(int16_t)(i.x+i.w), i.y, (int16_t)(a.x+a.w-i.x-i.w), i.h};
+  return n;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Work out what has to be sent to turn the panel from showing one
+            scene into showing another. Slot content goes first, the ticker
+            last. Nothing is sent for the parts the ticker covers; when the
+            ticker moves away, what it covered is sent again.
+    @param    shown   Scene the panel currently shows
+    @param    next    Scene to show
+    @param    updates Filled with at most SCENE_MAX_UPDATES entries
+    @return   Number of updates
+*/
+/**************************************************************************/
+uint8_t diffScene(const Scene& shown, const Scene& next, SceneUpdate* updates){
+  const SceneRect before = tickerRect(shown.tickerRow);
+  const SceneRect after = tickerRect(next.tickerRow);
+  uint8_t n = 0;
+
+  for (uint8_t slot = 0; slot < MAX_NUM_PICS; slot++) {
+    const SlotScene& was = shown.slots[slot];
+    const SlotScene& is = next.slots[slot];
+
+    // the ticker band always covers whole pics
+    SceneRect pic = slotRect(slot);
+    if (!after.contains(pic) &&
+        (was.avatar != is.avatar || was.overflow != is.overflow || before.contains(pic))) {
+      updates[n++] = {SCENE_SLOT_PIC, slot, pic};
+    }
+
+    SceneRect bars[4];
+    slotBorderRects(slot, bars);
+    for (const SceneRect& bar : bars) {
+      // a changed color needs the whole bar, otherwise only what the ticker left
+      SceneRect dirty = (was.border != is.border) ? bar : bar.intersect(before);
+      SceneRect pieces[4];
+      uint8_t num = subtractRect(dirty, after, pieces);
+      for (uint8_t i = 0; i < num; i++) {
+        updates[n++] = {SCENE_BORDER, slot, pieces[i]};
+      }
+    }
+  }
+
+  if (!after.empty() && (shown.tickerRow != next.tickerRow || shown.tickerScroll != next.tickerScroll)) {
+    updates[n++] = {SCENE_TICKER, 0, after};
+  }
+  return n;
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+// Fixed size queue between one producer and one consumer task, without
+// locks. Each side only writes its own index; the release store of an index
+// publishes the slot to the other side, so neither ever waits for the other.
+// push() fails when the queue is full and pop() when it is empty.
+
+#include <Arduino.h>
+#include <atomic>
+#include <utility>
+
+template<typename T, uint8_t N>
+class SpscQueue {
+  static_assert((N & (N - 1)) == 0, "the indices wrap around, N has to be a power of two");
+
+  public:
+    // Producer side
+    bool push(T&& item){
+      uint32_t t = tail.load(std::memory_order_relaxed);
+      if (t - head.load(std::memory_order_acquire) == N) return false;
+      slots[t % N] = std::move(item);
+      tail.store(t + 1, std::memory_order_release);
+      return true;
+    }
+
+    // Consumer side
+    bool pop(T& item){
+      uint32_t h = head.load(std::memory_order_relaxed);
+      if (h == tail.load(std::memory_order_acquire)) return false;
+      item = std::move(slots[h % N]);
+      head.store(h + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool empty() const {
+      return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+  private:
+    T slots[N];
+    std::atomic<uint32_t> head{0}; // next slot to pop, written by the consumer
+    std::atomic<uint32_t> tail{0}; // next slot to push, written by the producer
+};
+
+#endif
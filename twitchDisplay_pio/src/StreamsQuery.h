@@ -0,0 +1,113 @@
+#ifndef STREAMS_QUERY_H
+#define STREAMS_QUERY_H
+
+// Asks helix/streams about any number of users. Helix takes at most
+// HELIX_MAX_IDS user_id= per request and pages the streams it finds, so the
+// ids go out in batches and every batch follows pagination.cursor until
+// helix has no next page. All requests go over the connection HelixClient
+// keeps open.
+//
+//   std::vector<const char*> ids = ...;
+//   bool ok = fetchStreams(ids, [](const streamFields& stream){ ... });
+
+#include <Arduino.h>
+#include <vector>
+
+#include "Debug.h"
+#include "HelixClient.h"
+#include "HelixStreams.h"
+
+// Most user_id= and streams per page helix takes
+#define HELIX_MAX_IDS 100
+// Helix cursors are base64 of about a hundred bytes
+#define HELIX_CURSOR_MAX 256
+
+// Appends value to a query, with everything but unreserved characters
+// percent-encoded (cursors have '=' and may have '+' and '/')
+inline void appendQueryValue(String& query, const char* value){
+  static const char hex[] = "0123456789ABCDEF";
+  for (; *value; value++) {
+    char c = *value;
+    if (isalnum((unsigned char)c) || c == '-' || c == '_' || c == '.' || c == '~') {
+      query += c;
+    } else {
+      query += '%';
+      query += hex[(uint8_t)c >> 4];
+      query += hex[c & 0xF];
+    }
+  }
+}
+
+// Path of the request for ids[first, last), the page after cursor
+inline String streamsPath(const std::vector<const char*>& ids, size_t first, size_t last, const char* cursor){
+  String path = "streams?first=";
+  path += String(HELIX_MAX_IDS);
+  for (size_t i = first; i < last; i++) {
+    path += "&user_id=";
+    path += ids[i];
+  }
+  if (*cursor) {
+    path += "&after=";
+    appendQueryValue(path, cursor);
+  }
+  return path;
+}
+
+// How a fetchStreams() went, for the poll schedule
+struct streamsFetch {
+  int code = 0;          // of the last request
+  uint32_t requests = 0;
+  HelixClient::RateLimit rate;
+  uint32_t now = 0;      // helix time of the last answer
+};
+
+// Calls onStream(const streamFields&) for every live stream of the users in
+// ids. False as soon as a request or an answer fails; the streams handed
+// over before that are not the whole set then and should be dropped.
+// Helix may hand a stream over twice if the pages shifted in between.
+template<typename Callback>
+bool fetchStreams(const std::vector<const char*>& ids, Callback onStream, streamsFetch* fetch = nullptr){
+  char cursor[HELIX_CURSOR_MAX];
+  for (size_t first = 0; first < ids.size(); first += HELIX_MAX_IDS) {
+    size_t last = std::min(ids.size(), first + HELIX_MAX_IDS);
+    // a batch has at most as many streams as ids, more pages mean a cursor
+    // that goes round in circles
+    size_t pages = 0;
+    cursor[0] = 0;
+    do {
+      if (pages++ == last - first) {
+        DEBUG_W.printf("[%s] helix/streams keeps paging, giving up\n", DEBUG_TAG);
+        return false;
+      }
+      size_t streams = 0;
+      int httpCode = helix.get(streamsPath(ids, first, last, cursor));
+      if (fetch) {
+        // helix is ours until end()
+        fetch->code = httpCode;
+        fetch->requests++;
+        fetch->rate = helix.rateLimit();
+        fetch->now = helix.now();
+      }
+      if (httpCode != HTTP_CODE_OK) {
+        DEBUG_W.printf("[HTTP] GET failed, error: %s\n",
+          (httpCode<=0) ? HTTPClient::errorToString(httpCode).c_str() : String(httpCode).c_str());
+        helix.end();
+        return false;
+      }
+      bool ok = readStreams(helix.body(), [&](const streamFields& stream){
+        streams++;
+        onStream(stream);
+      }, cursor, sizeof(cursor));
+      helix.end();
+      if (!ok) {
+        DEBUG_W.printf("[JSON] helix/streams answer malformed or cut off\n");
+        return false;
+      }
+      // an empty page ends the batch whatever the cursor says
+      if (!streams) break;
+    } while (cursor[0]);
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,382 @@
+#ifndef TFT_DMA_QUEUE_H
+#define TFT_DMA_QUEUE_H
+
+// Asynchronous transfer queue for the ST7789.
+//
+// Takes over the SPI bus after Adafruit_ST7789 has initialized the panel.
+// Commands, address windows and pixels are queued as DMA transactions and
+// the calls return straight away. Pixels are converted to wire order into
+// one of two line buffers. A command queues the pixels collected so far but
+// keeps filling the same buffer behind them, so the caller only has to wait
+// when both line buffers are full and still in flight.
+//
+// On the host ([env:native]) the bus is modelled with a virtual clock that
+// advances at the set SPI speed and the bytes are handed to the simulated
+// Adafruit_ST7789, so overlap between rendering and transfers can be measured.
+
+#include <Arduino.h>
+#include <Adafruit_ST7789.h>
+
+#ifdef ESP_PLATFORM
+#include <SPI.h>
+#include <driver/spi_master.h>
+#include <driver/gpio.h>
+#include <esp_heap_caps.h>
+#endif
+
+class TftDmaQueue {
+  public:
+    static const uint32_t LINE_PIXELS = 1024; // per line buffer, 2 KB
+    static const uint8_t QUEUE_DEPTH = 64;    // transactions in flight
+
+    struct Stats {
+      uint32_t transactions;
+      uint32_t stalls;        // times the caller had to wait for the bus
+      uint64_t stallMicros;
+      uint64_t bytes;
+      uint64_t overdrawPixels; // written more than once within a frame
+    };
+
+    TftDmaQueue(Adafruit_ST7789& tft, uint8_t xstart, uint8_t ystart)
+      : tft(tft), xstart(xstart), ystart(ystart) {}
+
+    // Call after tft.init() and tft.setRotation()
+    bool begin(int8_t cs, int8_t dc, uint32_t freq){
+      width = tft.width();
+      height = tft.height();
+      spiFreq = freq;
+      lastCaset = lastRaset = UINT32_MAX;
+#ifdef ESP_PLATFORM
+      dcPin = dc;
+      // Adafruit_ST7789 is done with the bus, hand it over to the spi_master driver
+      SPI.end();
+      spi_bus_config_t buscfg = {};
+      buscfg.mosi_io_num = MOSI;
+      buscfg.miso_io_num = -1;
+      buscfg.sclk_io_num = SCK;
+      buscfg.quadwp_io_num = -1;
+      buscfg.quadhd_io_num = -1;
+      buscfg.max_transfer_sz = LINE_PIXELS*2;
+      if (spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK) return false;
+
+      spi_device_interface_config_t devcfg = {};
+      devcfg.clock_speed_hz = freq;
+      devcfg.mode = 0;
+      devcfg.spics_io_num = -1; // the panel is the only device, keep it selected
+      devcfg.queue_size = QUEUE_DEPTH;
+      devcfg.pre_cb = setDC;
+      if (spi_bus_add_device(SPI2_HOST, &devcfg, &device) != ESP_OK) return false;
+      digitalWrite(cs, LOW);
+
+      for (uint8_t i = 0; i < 2; i++) {
+        lines[i] = (uint16_t*)heap_caps_malloc(LINE_PIXELS*2, MALLOC_CAP_DMA);
+        if (!lines[i]) return false;
+      }
+#else
+      (void)cs;
+      (void)dc;
+      for (uint8_t i = 0; i < 2; i++) {
+        lines[i] = new uint16_t[LINE_PIXELS];
+      }
+#endif
+      return true;
+    }
+
+    void command(uint8_t cmd){
+      flush();
+      queue(&cmd, 1, false);
+    }
+
+    // Command parameters, at most 4 bytes
+    void data(const uint8_t* bytes, uint8_t len){
+      flush();
+      queue(bytes, len, true);
+    }
+
+    void data32(uint32_t l){
+      uint8_t bytes[4] = {(uint8_t)(l >> 24), (uint8_t)(l >> 16), (uint8_t)(l >> 8), (uint8_t)l};
+      data(bytes, 4);
+    }
+
+    // Starts a new frame for the overdraw accounting
+    void startFrame(){
+      frameWindows = 0;
+    }
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h){
+      trackWindow(x, y, w, h);
+      x += xstart;
+      y += ystart;
+      addrWindow(((uint32_t)x << 16) | (x+w-1), ((uint32_t)y << 16) | (y+h-1));
+    }
+
+    // Same window while MADCTL_MV is cleared: the column address then runs
+    // along y and pixels are expected column by column
+    void setAddrWindowColumns(uint16_t x, uint16_t y, uint16_t w, uint16_t h){
+      trackWindow(x, y, w, h);
+      x += xstart;
+      y += ystart;
+      addrWindow(((uint32_t)y << 16) | (y+h-1), ((uint32_t)x << 16) | (x+w-1));
+    }
+
+    // Native endian RGB565 to wire order
+    static void toWire(uint16_t* dst, const uint16_t* colors, uint32_t len){
+      for (uint32_t i = 0; i < len; i++) {
+        dst[i] = __builtin_bswap16(colors[i]);
+      }
+    }
+
+    // Native endian RGB565, converted to wire order on the way in
+    void writePixels(const uint16_t* colors, uint32_t len){
+      while (len) {
+        uint16_t* dst = reserve();
+        uint32_t n = std::min<uint32_t>(len, LINE_PIXELS - fill);
+        toWire(dst, colors, n);
+        commit(n);
+        colors += n;
+        len -= n;
+      }
+    }
+
+    // Pixels already in wire order (RGB565 high byte first), copied as they are
+    void writeRawPixels(const uint8_t* wire, uint32_t len){
+      while (len) {
+        uint16_t* dst = reserve();
+        uint32_t n = std::min<uint32_t>(len, LINE_PIXELS - fill);
+        memcpy(dst, wire, n*2);
+        commit(n);
+        wire += n*2;
+        len -= n;
+      }
+    }
+
+    // Pixels that source.decode(dst, n) writes in wire order straight into
+    // the line buffers, e.g. a PicDecoder
+    template<typename Source>
+    void writeFrom(Source& source, uint32_t len){
+      while (len) {
+        uint16_t* dst = reserve();
+        uint32_t n = std::min<uint32_t>(len, LINE_PIXELS - fill);
+        source.decode(dst, n);
+        commit(n);
+        len -= n;
+      }
+    }
+
+    void writeColor(uint16_t color, uint32_t len){
+      uint16_t swapped = __builtin_bswap16(color);
+      while (len) {
+        uint16_t* dst = reserve();
+        uint32_t n = std::min<uint32_t>(len, LINE_PIXELS - fill);
+        std::fill(dst, dst + n, swapped);
+        commit(n);
+        len -= n;
+      }
+    }
+
+    // Expands n bits (first pixel in bit 0) of a single colour bitmap
+    void writeBits(uint64_t bits, uint8_t n, uint16_t color, uint16_t bg){
+      uint16_t on = __builtin_bswap16(color), off = __builtin_bswap16(bg);
+      while (n) {
+        uint16_t* dst = reserve();
+        uint32_t len = std::min<uint32_t>(n, LINE_PIXELS - fill);
+        for (uint32_t i = 0; i < len; i++, bits >>= 1) {
+          dst[i] = (bits & 1) ? on : off;
+        }
+        commit(len);
+        n -= len;
+      }
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+      // same clipping as Adafruit_SPITFT::writeFillRect(), including negative sizes
+      if (w < 0) { x += w + 1; w = -w; }
+      if (h < 0) { y += h + 1; h = -h; }
+      int16_t x2 = std::min<int16_t>(x + w - 1, width - 1);
+      int16_t y2 = std::min<int16_t>(y + h - 1, height - 1);
+      x = std::max<int16_t>(x, 0);
+      y = std::max<int16_t>(y, 0);
+      if ((x > x2) || (y > y2)) return;
+      setAddrWindow(x, y, x2 - x + 1, y2 - y + 1);
+      writeColor(color, (uint32_t)(x2 - x + 1) * (y2 - y + 1));
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h){
+      setAddrWindow(x, y, w, h);
+      writePixels(bitmap, (uint32_t)w * h);
+    }
+
+    // Like drawRGBBitmap() for bitmaps in wire order, e.g. from pics.h built with --raw
+    void drawRawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h){
+      setAddrWindow(x, y, w, h);
+      writeRawPixels(bitmap, (uint32_t)w * h);
+    }
+
+    // Queue the pixels collected so far without waiting for them
+    void flush(){
+      if (fill == queued) return;
+      queue(lines[cur] + queued, (fill - queued)*2, true);
+      lineSeq[cur] = submitted;
+      queued = fill;
+      if (fill == LINE_PIXELS) {
+        cur ^= 1;
+        fill = queued = 0;
+      }
+    }
+
+    // Block until everything queued has been sent
+    void wait(){
+      flush();
+      while (completed < submitted) reclaim();
+    }
+
+    bool busy() const { return fill != queued || completed < submitted; }
+
+    const Stats& stats() const { return st; }
+    void resetStats(){ st = Stats(); }
+
+  private:
+    // The controller keeps CASET/RASET between RAMWRs, so a range that is
+    // already set is not sent again (the ticker columns all share CASET)
+    void addrWindow(uint32_t caset, uint32_t raset){
+      if (caset != lastCaset) {
+        command(ST77XX_CASET);
+        data32(caset);
+        lastCaset = caset;
+      }
+      if (raset != lastRaset) {
+        command(ST77XX_RASET);
+        data32(raset);
+        lastRaset = raset;
+      }
+      command(ST77XX_RAMWR);
+    }
+
+    struct Rect {
+      int16_t x, y, w, h;
+    };
+    static const uint8_t MAX_FRAME_WINDOWS = 96;
+
+    // Counts how much of a window was already written this frame. Only the
+    // first MAX_FRAME_WINDOWS windows of a frame are remembered.
+    void trackWindow(int16_t x, int16_t y, int16_t w, int16_t h){
+      for (uint8_t i = 0; i < frameWindows; i++) {
+        const Rect& r = frameRects[i];
+        int16_t ow = std::min<int16_t>(x+w, r.x+r.w) - std::max(x, r.x);
+        int16_t oh = std::min<int16_t>(y+h, r.y+r.h) - std::max(y, r.y);
+        if (ow > 0 && oh > 0) st.overdrawPixels += (uint32_t)ow * oh;
+      }
+      if (frameWindows < MAX_FRAME_WINDOWS) {
+        frameRects[frameWindows++] = {x, y, w, h};
+      }
+    }
+
+    // Returns the free part of the current line buffer, waiting only if
+    // it is still being sent from an earlier round
+    uint16_t* reserve(){
+      if (!fill && completed < lineSeq[cur]) {
+        stall(lineSeq[cur]);
+      }
+      return lines[cur] + fill;
+    }
+
+    void stall(uint32_t until){
+      uint64_t start = now();
+      while (completed < until) reclaim();
+      st.stalls++;
+      st.stallMicros += now() - start;
+    }
+
+    void commit(uint32_t n){
+      fill += n;
+      if (fill == LINE_PIXELS) flush();
+    }
+
+    void queue(const void* bytes, uint32_t len, bool dc){
+      if (submitted - completed == QUEUE_DEPTH) stall(completed + 1);
+      st.transactions++;
+      st.bytes += len;
+#ifdef ESP_PLATFORM
+      spi_transaction_t& t = trans[submitted % QUEUE_DEPTH];
+      t = spi_transaction_t();
+      t.length = len*8;
+      t.user = (void*)(intptr_t)dc;
+      if (len <= 4) {
+        t.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t.tx_data, bytes, len);
+      } else {
+        t.tx_buffer = bytes;
+      }
+      spi_device_queue_trans(device, &t, portMAX_DELAY);
+#else
+      // The simulated panel sees the bytes right away, the virtual bus
+      // clock decides when the transaction would have finished.
+      const uint8_t* b = (const uint8_t*)bytes;
+      if (dc) {
+        for (uint32_t i = 0; i < len; i++) tft.spiWrite(b[i]);
+      } else {
+        tft.writeCommand(b[0]);
+      }
+      uint64_t start = std::max(now(), busFreeAt);
+      busFreeAt = start + SIM_TRANS_OVERHEAD_US + (uint64_t)len * 8 * 1000000 / spiFreq;
+      doneAt[submitted % QUEUE_DEPTH] = busFreeAt;
+#endif
+      submitted++;
+    }
+
+    // Wait for the oldest transaction in flight
+    void reclaim(){
+#ifdef ESP_PLATFORM
+      spi_transaction_t* t;
+      spi_device_get_trans_result(device, &t, portMAX_DELAY);
+#else
+      // skip ahead instead of sleeping, sleeps are far too coarse for this
+      uint64_t done = doneAt[completed % QUEUE_DEPTH];
+      uint64_t t = now();
+      if (done > t) skipped += done - t;
+#endif
+      completed++;
+    }
+
+#ifdef ESP_PLATFORM
+    uint64_t now() const { return micros(); }
+
+    static void IRAM_ATTR setDC(spi_transaction_t* t){
+      gpio_set_level((gpio_num_t)dcPin, (int)(intptr_t)t->user);
+    }
+    static int8_t dcPin;
+    spi_device_handle_t device = nullptr;
+    spi_transaction_t trans[QUEUE_DEPTH];
+#else
+    // Rough cost of queueing one transaction and its completion interrupt
+    static const uint32_t SIM_TRANS_OVERHEAD_US = 2;
+    uint64_t doneAt[QUEUE_DEPTH] = {};
+    uint64_t busFreeAt = 0;
+    uint64_t skipped = 0; // virtual time spent waiting for the bus
+
+    uint64_t now() const { return micros() + skipped; }
+#endif
+
+    Adafruit_ST7789& tft;
+    uint8_t xstart, ystart;
+    uint32_t lastCaset = UINT32_MAX, lastRaset = UINT32_MAX; // unknown
+    Rect frameRects[MAX_FRAME_WINDOWS];
+    uint8_t frameWindows = 0;
+    int16_t width = 0, height = 0;
+    uint32_t spiFreq = 0;
+
+    uint16_t* lines[2] = {};
+    uint32_t lineSeq[2] = {};
+    uint8_t cur = 0;
+    uint32_t fill = 0;   // pixels in the current line buffer
+    uint32_t queued = 0; // of which already handed to the bus
+    uint32_t submitted = 0;
+    uint32_t completed = 0;
+    Stats st = {};
+};
+
+#ifdef ESP_PLATFORM
+int8_t TftDmaQueue::dcPin = -1;
+#endif
+
+#endif
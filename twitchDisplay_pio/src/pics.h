@@ -1,2616 +0,0 @@
-// converted using https://javl.github.io/image2cpp/
-
-// 'pietsmiet', 64x64px
-const uint16_t epd_bitmap_pietsmiet [] PROGMEM = {
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 
-  0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 
-  0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 
-  0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 
-  0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 0xe9a0, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc60, 0xfc40, 0xfc40, 0xfc60, 0xfc60, 0xe400, 
-  0xc340, 0xbb60, 0xe400, 0xfc20, 0xfc60, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc80, 0xec00, 0xc340, 0xbb60, 0xe3e0, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xcba0, 0x1861, 0x0020, 
-  0x0040, 0x0841, 0x0821, 0x1880, 0xcb60, 0xfc60, 0xfc60, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 
-  0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc60, 0xe3e0, 0x20a1, 0x0040, 0x0841, 0x0042, 0x0821, 
-  0x1081, 0xaae0, 0xfc60, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0x71e1, 0x0840, 0x1021, 0x0861, 
-  0x0840, 0x0020, 0x0041, 0x0061, 0x0841, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x0861, 0x0841, 0x0841, 0x0841, 0x0041, 
-  0x0841, 0x0820, 0x5160, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0x71c0, 0x0841, 0x0841, 0x0021, 0x43c2, 
-  0x6643, 0x6643, 0x43e3, 0x0022, 0x0040, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0840, 0x0841, 0x0020, 0x3b61, 0x6604, 0x6642, 0x4c63, 
-  0x0021, 0x0860, 0x0820, 0x4920, 0xfc40, 0xfc60, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xb300, 0x0021, 0x0860, 0x0880, 0x6ea4, 0x6703, 
-  0x6ea3, 0x6ea3, 0x66c3, 0x6ec3, 0x0861, 0x19a1, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 
-  0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3382, 0x3362, 0x33a2, 0x3362, 0x2aa1, 0x0021, 0x6e83, 0x6ee4, 0x66c3, 0x66a3, 0x66e3, 
-  0x76e3, 0x1101, 0x0841, 0x0040, 0x9281, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xf440, 0x1042, 0x0860, 0x0020, 0x6ec3, 0x6683, 0x4dc0, 
-  0x4dc0, 0x55a2, 0x4dc1, 0x4dc1, 0x66a3, 0x1160, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 
-  0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6f03, 0x6702, 0x6f03, 0x6f03, 0x2a81, 0x6644, 0x55e1, 0x55c1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x6662, 0x6ee3, 0x0880, 0x0841, 0x0021, 0xf460, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc60, 0xfc20, 0xfc40, 0x8240, 0x0840, 0x0021, 0x4d21, 0x6683, 0x4dc1, 0x4da1, 
-  0x4da1, 0x55c1, 0x4dc1, 0x4dc1, 0x4d83, 0x4d61, 0x55c1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4da0, 
-  0x4dc1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x45c0, 0x4d82, 0x4dc0, 0x33e1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc0, 0x55a2, 
-  0x4dc2, 0x6621, 0x6622, 0x0041, 0x1021, 0x30e0, 0xfc40, 0xfc80, 0xfc20, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc20, 0xfc60, 0xfc60, 0x0001, 0x0061, 0x18e0, 0x6ee2, 0x4da1, 0x4da1, 0x4da1, 
-  0x55c0, 0x4da1, 0x4dc0, 0x4da1, 0x4dc1, 0x4dc0, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4de1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4de2, 0x4da0, 0x45c1, 0x4da0, 0x55e2, 0x4da1, 0x4dc1, 0x4dc1, 0x55a2, 0x4da2, 
-  0x4dc1, 0x4de1, 0x66a3, 0x2202, 0x0041, 0x0841, 0xec20, 0xfc60, 0xfc40, 0xfc41, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 0xfc40, 
-  0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xfee0, 0xa4a1, 0x0840, 0x0821, 0x5d84, 0x55c1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x3c61, 0x4461, 0x4dc2, 0x4dc1, 0x4dc1, 0x4dc2, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc0, 0x4d61, 0x4461, 
-  0x4d61, 0x55c1, 0x55c2, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da2, 0x55c1, 0x4da1, 0x4dc1, 0x4da1, 0x4da1, 0x4d62, 0x44e1, 0x4da1, 
-  0x4da1, 0x4da1, 0x4d81, 0x6662, 0x0800, 0x0841, 0x8bc1, 0xfee0, 0xff00, 0xfee0, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 0xff00, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0x2941, 0x0841, 0x0801, 0x66c3, 0x4dc1, 0x4dc1, 0x4dc2, 0x4da1, 
-  0x08a1, 0x10a1, 0x45a1, 0x4dc1, 0x4dc1, 0x4dc0, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4d80, 0x0860, 0x0040, 
-  0x0801, 0x4d61, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4de1, 0x4dc1, 0x55e2, 0x0801, 0x0821, 0x5582, 
-  0x4da2, 0x4dc1, 0x4dc2, 0x5e42, 0x10e1, 0x0041, 0x0001, 0xff80, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xf740, 0x0821, 0x0820, 0x3303, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x08a0, 0x10a0, 0x4dc1, 0x4dc2, 0x4dc0, 0x55a1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4421, 0x0040, 0x0841, 
-  0x0041, 0x2ac0, 0x4de1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x55a1, 0x4dc0, 0x1102, 0x0881, 0x4dc1, 
-  0x55a1, 0x4da0, 0x4da2, 0x4dc1, 0x3b81, 0x0821, 0x0020, 0xf720, 0xff40, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xc5c1, 0x0041, 0x0020, 0x55a2, 0x4da1, 0x4da2, 0x4d41, 0x4d40, 0x4561, 
-  0x3421, 0x3420, 0x4d42, 0x4580, 0x4542, 0x4de1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4561, 0x0021, 0x0062, 
-  0x1002, 0x44e2, 0x4dc0, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4d21, 0x22a1, 0x55a2, 0x4de1, 0x55c1, 0x45c1, 
-  0x3ba1, 0x3c41, 0x4dc1, 0x4da2, 0x6682, 0x0021, 0x0840, 0x9c61, 0xff40, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff40, 0x8400, 0x0821, 0x0840, 0x55e1, 0x4dc1, 0x4dc1, 0x0000, 0x0861, 0x10c1, 
-  0x4dc1, 0x4dc1, 0x1100, 0x0861, 0x0021, 0x55e2, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4d02, 0x1961, 
-  0x4ca1, 0x55c1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x08c1, 0x0840, 0x3c20, 0x4da1, 0x4dc0, 0x4d22, 
-  0x0061, 0x0821, 0x55a2, 0x4dc1, 0x5e02, 0x0001, 0x0861, 0x3181, 0xff80, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff80, 0x2100, 0x0860, 0x08a1, 0x4dc1, 0x4da2, 0x4dc1, 0x3bc1, 0x3ba1, 0x3c01, 
-  0x4da1, 0x55a1, 0x3c02, 0x33c0, 0x33a1, 0x4dc0, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x3ba1, 0x10a0, 0x5562, 0x4dc2, 0x55c1, 0x4da1, 
-  0x19a0, 0x2260, 0x55a2, 0x4dc1, 0x4da1, 0x10e0, 0x0842, 0x18c1, 0xff81, 0xff40, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0x0001, 0x0021, 0x1960, 0x55c2, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4de1, 
-  0x08a1, 0x08a0, 0x4dc0, 0x55a2, 0x4dc1, 0x4da1, 0x4dc1, 0x4dc2, 0x4dc1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4dc1, 0x4da1, 0x4dc1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x55c2, 0x4de1, 0x3341, 0x2260, 0x4da2, 
-  0x4dc0, 0x4dc0, 0x4da1, 0x4dc1, 0x4dc1, 0x3b61, 0x0841, 0x0841, 0xff40, 0xff40, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff80, 0x0020, 0x0840, 0x1961, 0x55c1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc2, 0x4dc1, 
-  0x08c1, 0x0881, 0x4dc1, 0x4da0, 0x4dc1, 0x4dc2, 0x6683, 0x6ec3, 0x6ee3, 0x6ee3, 0x6683, 0x55e1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x6683, 0x6ee3, 0x6ee3, 0x6ee4, 0x6683, 0x4de1, 0x4dc1, 0x4da1, 0x4dc1, 0x0001, 0x0822, 0x5561, 
-  0x4dc0, 0x4da2, 0x4dc1, 0x4dc2, 0x45c0, 0x3c22, 0x0861, 0x0041, 0xef00, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff80, 0x0801, 0x0040, 0x3b62, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x1a01, 0x19e1, 0x55c2, 0x4dc1, 0x4da1, 0x6ee2, 0x66a3, 0x4ce2, 0x4402, 0x4c63, 0x5e64, 0x76e3, 0x5601, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4da1, 0x4de1, 0x55e2, 0x6f04, 0x6e64, 0x4ca2, 0x4401, 0x44a2, 0x6683, 0x6703, 0x55e1, 0x4dc1, 0x4da1, 0x3ba2, 0x2280, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x3c81, 0x0840, 0x0021, 0xe6c0, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0x0021, 0x0041, 0x3c21, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4da1, 0x4dc2, 0x45a1, 0x4dc2, 0x6ee2, 0x33a2, 0x0801, 0x0000, 0x2123, 0x0000, 0x0841, 0x19c1, 0x6f24, 0x4dc2, 0x4da1, 0x4dc1, 
-  0x4da1, 0x4da1, 0x6f04, 0x21e1, 0x0821, 0x0021, 0x2943, 0x0000, 0x0021, 0x2a22, 0x6f24, 0x55a0, 0x4dc1, 0x4dc0, 0x4dc1, 0x4da1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x44e1, 0x0841, 0x0841, 0xde80, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 
-  0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff40, 0x0021, 0x0841, 0x3c61, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x45c1, 0x4dc2, 0x45a1, 0x5e02, 0x3321, 0x0820, 0x0020, 0x840f, 0x7bce, 0x83f0, 0x18c2, 0x1021, 0x10e1, 0x6ea4, 0x4dc1, 0x4da1, 
-  0x4da1, 0x5e62, 0x1980, 0x0061, 0x0861, 0x8410, 0x7c10, 0x7bcf, 0x0861, 0x0841, 0x2261, 0x66a3, 0x55c1, 0x4dc2, 0x55c1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4da1, 0x4d21, 0x0020, 0x0020, 0xd660, 0xff60, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 
-  0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03a4, 0x0861, 0x0841, 0x3441, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x5e02, 0x0022, 0x0020, 0x39c7, 0x7bef, 0x7bcf, 0x7bef, 0x632c, 0x0841, 0x0841, 0x3c42, 0x4dc1, 0x55c1, 
-  0x4dc1, 0x5582, 0x0841, 0x0841, 0x528a, 0x7bcf, 0x7bcf, 0x7bcf, 0x4a49, 0x0841, 0x0041, 0x4da2, 0x55c1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4de1, 0x4521, 0x0840, 0x0841, 0x0304, 0x03a5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 
-  0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e5, 0x0821, 0x0041, 0x33e2, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x33c2, 0x0081, 0x0841, 0x18e3, 0x7bef, 0x7bcf, 0x7bce, 0x4248, 0x0841, 0x0841, 0x1122, 0x55c1, 0x4da1, 
-  0x4dc2, 0x2a42, 0x0041, 0x0841, 0x31a6, 0x7bcf, 0x7bef, 0x7bcf, 0x2124, 0x0861, 0x0840, 0x1161, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x44c1, 0x0820, 0x0841, 0x0363, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 
-  0x0404, 0x0404, 0x0404, 0x03e4, 0x03e4, 0x03e4, 0x0405, 0x0841, 0x0860, 0x2301, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x11a1, 0x0841, 0x0841, 0x0840, 0x2965, 0x73ae, 0x52aa, 0x0040, 0x0841, 0x0020, 0x0820, 0x4de1, 0x4dc1, 
-  0x4da1, 0x0001, 0x0840, 0x0841, 0x0841, 0x4228, 0x7bce, 0x4a49, 0x0840, 0x0841, 0x0841, 0x10e1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x3c61, 0x0841, 0x0840, 0x0364, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x03e4, 0x0801, 0x0041, 0x19c2, 0x4dc1, 0x45a1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x19c1, 0x0040, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x4de2, 0x4da1, 
-  0x45c1, 0x0061, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0061, 0x08e1, 0x4dc2, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x55c1, 0x55c2, 0x33a1, 0x0040, 0x0821, 0x03c4, 0x03e4, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0821, 0x0841, 0x0901, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x2b20, 0x0821, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x1180, 0x1160, 
-  0x1182, 0x10c1, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0821, 0x11c1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4da0, 0x4dc1, 0x22c1, 0x0861, 0x0821, 0x03e4, 0x03e4, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0405, 0x0000, 0x0841, 0x08a1, 0x4dc1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4502, 0x0081, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 
-  0x0841, 0x0040, 0x0842, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0021, 0x4462, 0x4dc2, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x55c1, 0x1161, 0x0841, 0x0841, 0x03e4, 0x03e4, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x03e4, 0x0142, 0x0841, 0x0821, 0x4d82, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x33a1, 0x0020, 0x0840, 0x0840, 0x0841, 0x0840, 0x0840, 0x0041, 0x0820, 0x0841, 0x0801, 0x0821, 
-  0x0001, 0x0820, 0x0840, 0x0841, 0x0841, 0x0040, 0x0860, 0x0841, 0x0841, 0x0820, 0x3343, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4da2, 0x0020, 0x0841, 0x08a1, 0x03e5, 0x03e4, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x03e4, 0x0283, 0x0861, 0x0041, 0x3c62, 0x4de1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4500, 0x43e2, 0x1121, 0x0022, 0x0841, 0x0841, 0x0841, 0x0861, 0x0821, 0x0ac5, 0x0404, 0x03e4, 
-  0x0404, 0x0365, 0x0841, 0x0840, 0x0841, 0x0841, 0x0861, 0x0841, 0x08c1, 0x33e0, 0x4501, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4500, 0x0801, 0x0820, 0x0921, 0x03e5, 0x03e4, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0384, 0x0841, 0x0841, 0x2aa2, 0x4dc0, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x4da0, 0x4561, 0x3441, 0x3301, 0x0861, 0x0801, 0x0841, 0x0080, 0x0384, 0x0405, 0x03e5, 0x0404, 
-  0x03e5, 0x0404, 0x03c5, 0x08e2, 0x0820, 0x0041, 0x0841, 0x1a00, 0x3401, 0x4d61, 0x4dc1, 0x55e2, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x3381, 0x0821, 0x0041, 0x0323, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x03e4, 0x0820, 0x0841, 0x08a1, 0x4d61, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4de1, 0x4da1, 0x3c20, 0x1120, 0x0021, 0x0840, 0x03e4, 0x03e4, 0x0405, 0x03e3, 0x03e4, 0x0405, 
-  0x03e4, 0x0404, 0x03e4, 0x03e4, 0x0405, 0x0020, 0x0041, 0x08a1, 0x3c01, 0x4da1, 0x4dc0, 0x4da1, 0x4da1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4da1, 0x0900, 0x0041, 0x0821, 0x0404, 0x03e4, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 
-  0x03cc, 0x03cc, 0x03cc, 0x03cc, 0x03cc, 0x03cc, 0x03cd, 0x03cc, 0x00e3, 0x0861, 0x0040, 0x3c01, 0x4dc1, 0x4dc1, 0x4da1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc0, 0x4da1, 0x4d62, 0x3c21, 0x0821, 0x0040, 0x08c3, 0x03cc, 0x03ec, 0x03cc, 0x03cc, 0x03cc, 0x03cc, 
-  0x03cc, 0x03cc, 0x03cc, 0x03cb, 0x03ab, 0x0208, 0x0841, 0x0822, 0x3be1, 0x4502, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4dc2, 0x4dc1, 0x4da1, 0x3c21, 0x0821, 0x0841, 0x00c4, 0x03cc, 0x03cc, 0x03cb, 0x03cc, 0x03cc, 0x03cc, 0x03cc, 0x03cc, 0x03cc, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027e, 0x023d, 0x1040, 0x0841, 0x10e2, 0x4522, 0x4da1, 0x4dc1, 0x4dc1, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4dc2, 0x55c1, 0x3c41, 0x2242, 0x0040, 0x0841, 0x023a, 0x027f, 0x027f, 0x025f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027e, 0x027f, 0x025c, 0x0061, 0x0840, 0x19a2, 0x3c01, 0x55c1, 0x4da2, 0x4da0, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4da0, 0x4dc1, 0x4d42, 0x2283, 0x0821, 0x0040, 0x01d8, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025e, 0x0064, 0x0040, 0x0841, 0x33e2, 0x4d62, 0x4da0, 0x4dc2, 
-  0x4dc1, 0x4dc1, 0x4dc1, 0x4da0, 0x44e2, 0x3c01, 0x0841, 0x1041, 0x0800, 0x027f, 0x025f, 0x027f, 0x025f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x025f, 0x025e, 0x027f, 0x0885, 0x0842, 0x0841, 0x3c02, 0x3ca2, 0x4dc0, 0x55c2, 0x4dc1, 0x4dc1, 0x4dc1, 
-  0x4da2, 0x4da1, 0x3c02, 0x0801, 0x0040, 0x0842, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x021a, 0x1040, 0x0061, 0x0021, 0x4402, 0x4562, 0x4da1, 
-  0x4da2, 0x4da1, 0x4dc1, 0x4502, 0x3421, 0x1122, 0x0040, 0x0822, 0x01f7, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x023c, 0x0041, 0x0041, 0x08a2, 0x3c01, 0x44e3, 0x4da1, 0x4de1, 0x4da0, 0x4dc1, 
-  0x4d61, 0x3421, 0x10a1, 0x0841, 0x0841, 0x01b8, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x00cb, 0x0860, 0x0041, 0x08e2, 0x3c21, 0x3c42, 
-  0x44a2, 0x3ca3, 0x3c21, 0x3c20, 0x1182, 0x0841, 0x0841, 0x0085, 0x025f, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x029f, 0x090c, 0x0821, 0x0042, 0x08c1, 0x3c41, 0x3c21, 0x4483, 0x44a3, 0x3c21, 
-  0x4421, 0x1102, 0x0841, 0x0840, 0x08a8, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x0064, 0x0841, 0x0840, 0x0801, 0x2ae3, 
-  0x33c2, 0x3be1, 0x3303, 0x0021, 0x0841, 0x0840, 0x0041, 0x025f, 0x027f, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025f, 0x027e, 0x0842, 0x0820, 0x0021, 0x0021, 0x2ac2, 0x33e1, 0x3be1, 0x3321, 
-  0x0861, 0x0841, 0x0840, 0x0061, 0x025e, 0x027e, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025e, 0x0064, 0x0841, 0x0841, 0x0821, 
-  0x0841, 0x0821, 0x0841, 0x0840, 0x0841, 0x0823, 0x025d, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025e, 0x0041, 0x0841, 0x0040, 0x0841, 0x0021, 0x0040, 0x0842, 
-  0x0060, 0x0842, 0x0020, 0x027e, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025f, 0x029f, 0x027f, 0x0931, 0x0822, 0x0841, 
-  0x0841, 0x0040, 0x0821, 0x0840, 0x08ca, 0x029f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027e, 0x027f, 0x027f, 0x00ec, 0x0020, 0x0841, 0x0841, 0x0840, 0x0840, 
-  0x0041, 0x00eb, 0x0a5f, 0x025f, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025f, 0x027f, 0x027f, 0x027f, 0x0219, 
-  0x01d6, 0x0996, 0x01f9, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x025f, 0x025f, 0x027f, 0x027f, 0x029f, 0x025f, 0x01f9, 0x01b6, 0x01d5, 0x01d9, 
-  0x027e, 0x027f, 0x025f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 
-  0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 
-  0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 
-  0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 0x027f, 
-  0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 
-  0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 
-  0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 
-  0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 0x68d3, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 
-  0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030, 0x7030
-};
-
-// 'gronkh', 64x64px
-const uint16_t epd_bitmap_gronkh [] PROGMEM = {
-  0x1087, 0x1087, 0x1041, 0x1040, 0xccec, 0xc4ac, 0x7aa6, 0x7265, 0x3102, 0x1040, 0x3964, 0xc4ef, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee97, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xbcad, 0x1020, 0x1040, 0xbc8c, 0x7aa6, 0x82e6, 0x7aa6, 0x7aa6, 0x7a86, 0x7aa6, 0x51c4, 0x51c4, 0x51c3, 0x51c4, 0x51c4, 
-  0x1087, 0x1086, 0x1060, 0x6a87, 0xcccc, 0x7aa6, 0x7aa6, 0x1060, 0x3122, 0x3964, 0xbcef, 0xddf3, 0xee96, 0xee96, 0xde56, 0x0820, 
-  0x1060, 0x1041, 0x1041, 0x1060, 0x1060, 0x0820, 0xee76, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xc573, 0x51e6, 0x1860, 0x1040, 0x4a06, 0xd615, 0xeeb7, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xddf3, 0xbcce, 0x1040, 0xcced, 0x7aa6, 0x7aa6, 0x9b89, 0x7aa6, 0xcd0e, 0x7aa6, 0x51c4, 0x51c4, 0x59e4, 0x51c4, 0x51c4, 
-  0x1087, 0x1060, 0x1060, 0xcccc, 0x7265, 0x7aa6, 0x28e1, 0x51c4, 0x3983, 0x41a4, 0xbcce, 0xee96, 0xa490, 0x1040, 0x1020, 0x7aa6, 
-  0x7ac6, 0x7286, 0x6a45, 0x6a25, 0x6225, 0x6a87, 0x1880, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x1040, 0x1040, 
-  0x5a26, 0x7aa6, 0x7aa6, 0x7aa6, 0x7aa6, 0x7aa6, 0x3102, 0x1041, 0x1040, 0xf6d7, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xbcce, 0x1040, 0x1020, 0x7aa5, 0x7aa6, 0xcced, 0x7286, 0x7265, 0x7a86, 0x7286, 0x51c4, 0x51c4, 0x51c4, 0x51c4, 
-  0x1086, 0x1060, 0x49c4, 0xbc4b, 0x7aa6, 0x5a04, 0x49a4, 0x51c4, 0x3964, 0xbcce, 0xee96, 0x1040, 0x1840, 0x6a45, 0x51c3, 0x49c4, 
-  0x1881, 0x1040, 0x1040, 0x1040, 0x1060, 0x49c4, 0x1041, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x1060, 0x51c4, 
-  0x51c4, 0x49a4, 0x28c1, 0x28c1, 0x1880, 0x3963, 0x51c4, 0x51c4, 0x51c4, 0x1040, 0x1040, 0xe676, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xbcce, 0xacaf, 0x1040, 0xccec, 0x7aa6, 0x7a85, 0x51c3, 0x7aa6, 0x82c6, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x51c4, 
-  0x0841, 0x1041, 0xccec, 0x7a85, 0x7aa6, 0x51c4, 0x51c3, 0x3964, 0x49a4, 0xb48e, 0x1040, 0x6205, 0x28e2, 0x1040, 0x1060, 0x1060, 
-  0x20a1, 0x7b2a, 0xa44d, 0x832a, 0x1040, 0x1040, 0x1060, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x62a8, 0x1061, 0x1040, 
-  0x1020, 0x20c1, 0x51e6, 0x51e6, 0x51e6, 0x1020, 0x1040, 0x1060, 0x1040, 0x51c4, 0x51c4, 0x1040, 0x0820, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xbcce, 0xbcce, 0x1060, 0x938a, 0x6a25, 0x7aa6, 0x7aa7, 0x7a86, 0x8b07, 0x7aa6, 0x51c3, 0x51c4, 0x51c4, 0x51c4, 
-  0x1041, 0x1040, 0xcccd, 0x7aa6, 0x51a3, 0x51c4, 0x51c4, 0x3964, 0x49e5, 0x1040, 0x1040, 0x1040, 0x0840, 0xbccf, 0xbcce, 0xbcce, 
-  0xbcce, 0xc530, 0xe614, 0xe614, 0xc550, 0xbcee, 0xbcef, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xbd11, 0xbcce, 0xbcce, 
-  0xbccd, 0xbcce, 0xc50f, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcef, 0x1040, 0x1040, 0x49c5, 0x51c4, 0x1040, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xcd71, 0xbccd, 0x1040, 0x1040, 0x7a86, 0x7aa6, 0x7aa6, 0x51a3, 0x7aa6, 0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 
-  0x1060, 0xcced, 0x7a85, 0x7aa6, 0x51c4, 0x51c4, 0x49c4, 0x28e2, 0x1040, 0x1060, 0x1060, 0xc4ee, 0xbcce, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xddd3, 0xbcce, 0xbcce, 0x2081, 0x0840, 0x51c4, 0x1061, 0xee96, 
-  0xee96, 0xee96, 0xee76, 0xbcce, 0xbd10, 0x1041, 0x82c6, 0x6225, 0x7aa6, 0x51c3, 0x7aa6, 0x7aa6, 0x7aa6, 0x51c3, 0x51c4, 0x51c4, 
-  0x0840, 0xcced, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x4184, 0x1040, 0x1040, 0xbcce, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xbcef, 0xbcce, 0x1040, 0x4184, 0x1040, 
-  0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0x1060, 0x7aa7, 0x51c4, 0x7aa6, 0x51c4, 0x6a65, 0x7aa6, 0x7aa6, 0x51a3, 0x51c3, 0x51c4, 
-  0x7ac7, 0x7265, 0x7aa6, 0x51c4, 0x51c4, 0x6225, 0x1040, 0x1061, 0xbcce, 0xd5d2, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xddf3, 0x4143, 0x1060, 
-  0xeeb6, 0xee96, 0xee96, 0xbcce, 0xbcce, 0x0840, 0x1040, 0x51c4, 0x7aa6, 0x72a6, 0x51a3, 0x7aa6, 0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 
-  0xcccc, 0x7aa6, 0x51a4, 0x51c4, 0x51c4, 0x7aa6, 0x1060, 0x3964, 0xbccd, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x93ec, 
-  0x1040, 0xee96, 0xee96, 0xbcce, 0xbcce, 0x5226, 0x1060, 0x59e4, 0x6a45, 0x7aa6, 0x51c4, 0x7aa6, 0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 
-  0xa3a9, 0x7aa6, 0x51c4, 0x51c4, 0x7286, 0x7aa6, 0x49c4, 0x3964, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0x5226, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcee, 0x1041, 0x7aa6, 0x51c4, 0x7aa6, 0x51c4, 0x6225, 0x7aa6, 0x7aa6, 0x51a3, 0x51c4, 
-  0x7aa6, 0x6a45, 0x51c4, 0x51c3, 0x7aa6, 0x7aa6, 0x51c4, 0x3964, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee55, 0xbcce, 0xbccd, 0xbccd, 
-  0xbcce, 0xbcce, 0xbccd, 0xbcce, 0xe634, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x1060, 0x51e4, 0x51c4, 0x7aa6, 0x51a3, 0x51c4, 0x7aa5, 0x7aa6, 0x7286, 0x51c4, 
-  0x7aa6, 0x51c4, 0x51c4, 0x7286, 0x7aa6, 0x51c4, 0x51c4, 0x3964, 0xbcce, 0xee96, 0xcd71, 0xbcae, 0x7b4d, 0x7b4d, 0x7b6d, 0x7b6d, 
-  0x7b6d, 0x7b6d, 0x7b6d, 0x834c, 0xbcce, 0xbccd, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xbd0f, 0xc4ef, 0xbcae, 0xd5d2, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xc530, 0xbcce, 0xbcce, 0x1060, 0x1040, 0x51c4, 0x6a45, 0x59e4, 0x51c4, 0x9b68, 0x7aa6, 0x7aa6, 0x51c4, 
-  0x7aa6, 0x51c4, 0x51c4, 0x7aa6, 0x7aa6, 0x51c4, 0x49a5, 0x3984, 0xbcce, 0xbcce, 0x734c, 0x7b6d, 0x730c, 0xffdf, 0xffff, 0xffff, 
-  0xffff, 0xdeba, 0xd638, 0x7b4d, 0x7b6d, 0xbcce, 0xbccd, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xddd3, 0xbcce, 0x838c, 0x7b4d, 0x7b6d, 0x7b6d, 0x7b4d, 0x7b4d, 0x93cc, 0xbcce, 0xee75, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee75, 0xbcce, 0xbcce, 0x1020, 0x1040, 0x1040, 0x51a4, 0x7265, 0x51c4, 0x72a6, 0x7a86, 0x7aa6, 0x51c4, 
-  0x6a45, 0x51c4, 0x7266, 0x7aa6, 0x51a3, 0x51c4, 0x4184, 0x3964, 0xbcce, 0x7b4d, 0x7b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffdf, 0xdeba, 0xdeba, 0xa4d3, 0x7b6d, 0xa42e, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xeeb6, 
-  0xbcce, 0x7b4d, 0x7b6d, 0xa4d3, 0xffff, 0xffff, 0xffff, 0xffdf, 0x83cf, 0x7b4d, 0x7b6d, 0x7b4c, 0xbcce, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0x49c5, 0x1040, 0x4163, 0x51c4, 0x7aa6, 0x51c4, 0x59c3, 0x7a85, 0x7aa6, 0x51c4, 
-  0x51c4, 0x51c3, 0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 0x3964, 0x3122, 0x7b6d, 0x736e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xc5f7, 0x7b6d, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xb4ae, 
-  0x7b4d, 0xc5b7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xbdb6, 0x7b6d, 0x7b6d, 0xb4cf, 0xde13, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xac6d, 0x1060, 0xbc8c, 0x51c4, 0x72a6, 0x51c4, 0x51c4, 0xcced, 0x7aa6, 0x7265, 
-  0x51c4, 0x51a3, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x3964, 0x7b4d, 0x7b8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xef3c, 0xdeba, 0xdeba, 0xdeba, 0x734d, 0x7b6d, 0xd592, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xac8e, 0x7b4d, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xde9a, 0xdeba, 0x734d, 0x7b6d, 0xa44d, 0xee75, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcee, 0x1060, 0xcd0e, 0x2081, 0x59e4, 0x51c4, 0x51c4, 0x7a65, 0x7aa6, 0x7aa6, 
-  0x51c4, 0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b6d, 0x7b6d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 0x7b4d, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 0xbccf, 0x7b6d, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0x734d, 0x7b4d, 0xbcce, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x1060, 0x1840, 0x1040, 0x51a3, 0x59c4, 0x51c4, 0x7aa6, 0x7aa6, 0x7aa6, 
-  0x51c4, 0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b6d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 0x734d, 0xbcae, 0xee96, 0xee96, 0xee96, 0xc530, 0x734d, 0xad34, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0x734d, 0x7b6d, 
-  0xbccd, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbccd, 0x1060, 0x0840, 0x28a1, 0x51c4, 0x7286, 0x51c4, 0x28c1, 0xb44a, 0x7aa6, 
-  0x5a04, 0x7aa6, 0x51a3, 0x51c4, 0x51c4, 0x730b, 0x734d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 0x7b8e, 0x93ed, 0xee96, 0xee96, 0xee96, 0x836c, 0x7b6d, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xdeba, 0xdeba, 0xdeba, 0x7b6d, 
-  0x7b6c, 0xe655, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x1040, 0x1061, 0x7ac7, 0x51c4, 0x51c4, 0x51c4, 0x1040, 0xccec, 0x7aa6, 
-  0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b6d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 0x8c10, 0x8bad, 0xee96, 0xee96, 0xbcce, 0x7b4d, 0xffdf, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xbd96, 
-  0x7b6d, 0xbcce, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x1040, 0x1040, 0xa3a8, 0x2902, 0x51c4, 0x51c4, 0x1060, 0xccec, 0x7aa6, 
-  0x7aa6, 0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xdebb, 0xdeba, 0xdeba, 0xdeba, 0xad14, 0x8bcd, 0xee96, 0xee96, 0x8b8c, 0x7b4d, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 
-  0x7b6d, 0xa44e, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x6a88, 0x1060, 0xcced, 0x0841, 0x51c4, 0x51c4, 0x49a4, 0x8b07, 0x7aa6, 
-  0x7aa6, 0x7286, 0x51c4, 0x51c4, 0x730b, 0x732c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0x5435, 0x5435, 0x5435, 0xdeba, 0xdeba, 0x8bef, 0x6267, 0xee96, 0xde14, 0x7b4d, 0xf79e, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 
-  0x7b4d, 0x7b4c, 0xc50f, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x9c2d, 0x1060, 0xccec, 0x1040, 0x51c3, 0x51c4, 0x51c4, 0x6226, 0x82e6, 
-  0x7aa6, 0x51a3, 0x51c4, 0x51c4, 0x7b6d, 0xb575, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0x95b9, 0x5455, 0xdf1b, 0x0000, 0x5c34, 0xcdd6, 0x3964, 0xee96, 0xee96, 0xbcce, 0x7b4d, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xdeba, 0xdeba, 0xdeba, 
-  0xe6ba, 0x7b6d, 0xbcce, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0x1041, 0xcccc, 0x1040, 0x51c3, 0x51c4, 0x51c4, 0x1040, 0xc48b, 
-  0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b6d, 0xef3c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xcf1e, 0x5435, 0x0000, 0x0000, 0x5b91, 0x3964, 0xe696, 0xee96, 0xee96, 0xbccf, 0x7b6d, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6c95, 0x5c35, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xdeba, 0xdeba, 0xdeba, 
-  0xdeba, 0x7b4d, 0xbcce, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0x1060, 0xcced, 0x4163, 0x51c3, 0x51c4, 0x51c4, 0x0840, 0xccec, 
-  0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b4d, 0xbdd7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0x5414, 0x5435, 0x5bf2, 0x3984, 0xeeb7, 0xee96, 0xee96, 0xee96, 0xa44f, 0x734d, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x5435, 0x4b50, 0x0042, 0x5435, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xdeba, 0xdeba, 0xdeba, 
-  0xdeba, 0x7b6d, 0xbccd, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0x1060, 0xcced, 0x5a25, 0x49c4, 0x51c4, 0x51c4, 0x1040, 0xccec, 
-  0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b4d, 0x9c92, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xd6ba, 0xdeba, 0x3964, 0x49c4, 0xee97, 0xee96, 0xee96, 0xbcce, 0x8b8d, 0x7b6d, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x5435, 0x0000, 0x0000, 0x6455, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 
-  0xdeba, 0x7b4d, 0xbcad, 0xee96, 0xbcce, 0xbcce, 0xbccd, 0x1060, 0x1060, 0xc4ed, 0x6245, 0x1040, 0x51c4, 0x51c4, 0x1060, 0xac2a, 
-  0x7aa6, 0x51c4, 0x51c4, 0x51c4, 0x7b4d, 0x7b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xdeba, 0x3964, 0x3964, 0xee96, 0xee97, 0xee96, 0xbcce, 0xbccd, 0x9c2e, 0x7b6d, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x5435, 0x220a, 0x0022, 0x5435, 0xffdf, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 
-  0xdedb, 0x7b4d, 0xbcce, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x20e1, 0x1060, 0xc4cd, 0x6225, 0x1040, 0x51c4, 0x51c4, 0x4163, 0x7aa6, 
-  0x6a65, 0x51c4, 0x51c4, 0x49a4, 0x3964, 0x7b6d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xdeda, 0x62ea, 0x3964, 0xee96, 0xee96, 0xee96, 0xc550, 0xbcce, 0xbcce, 0xbccf, 0x7b6d, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa5d9, 0x8516, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 
-  0x734d, 0x838c, 0xcd50, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x1060, 0x1060, 0xc4ee, 0x6225, 0x1040, 0x1040, 0x51c4, 0x51c4, 0x3902, 
-  0x6204, 0x51c4, 0x51c4, 0x3964, 0xb48e, 0x7b4d, 0x734d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xdeba, 0x3964, 0x3943, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xd571, 0x7b6d, 0xf77d, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 
-  0x7b4d, 0xbcce, 0xeeb6, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0x1060, 0x1060, 0xc4ed, 0x5a04, 0x1060, 0x1040, 0x3964, 0x3984, 0x1060, 
-  0x59c4, 0x51c4, 0x51c4, 0x3964, 0xbccd, 0xbcce, 0x7b6d, 0x6b2c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xdeba, 0xb533, 0x3964, 0xeeb7, 0xee96, 0xee96, 0xd5b2, 0xbcce, 0xbcce, 0xbcce, 0xee96, 0x7b4c, 0x7b6d, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xdeba, 0x734d, 
-  0x7b4c, 0xbcce, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xb48e, 0x41a4, 0x1041, 0xcced, 0x59e4, 0x1040, 0x3964, 0x3964, 0x3964, 0x1040, 
-  0x51c4, 0x51c4, 0x3964, 0xe656, 0xee96, 0xbcce, 0xbcce, 0x7b6d, 0x734d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 
-  0xdeba, 0x3964, 0x41a4, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xee96, 0xbcae, 0x7b6d, 0xffdf, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xde9a, 0x7b6d, 
-  0xbcce, 0xbcef, 0xee96, 0xee96, 0xbcce, 0xac6d, 0x1061, 0x1860, 0x1060, 0xcced, 0x51c4, 0x1040, 0x3964, 0xee96, 0xbcce, 0x1040, 
-  0x51c4, 0x1040, 0x3964, 0xee96, 0xee96, 0xee55, 0xbcce, 0xbcce, 0x7b6d, 0x7b6d, 0x83ef, 0xffdf, 0xffff, 0xffdf, 0xd699, 0x734d, 
-  0x3964, 0x3964, 0xee96, 0xee96, 0xee96, 0xde13, 0xbcce, 0xbccd, 0xbcce, 0xbcce, 0xee96, 0xee96, 0x7b4c, 0x7b6d, 0xffdf, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0xdeba, 0xde9a, 0x7b6d, 0xa44e, 
-  0xbccd, 0xee96, 0xee96, 0xc550, 0xbcce, 0x49e4, 0x1040, 0x5a05, 0x1060, 0xccec, 0x51a4, 0x1060, 0xee96, 0xc4ef, 0xbcce, 0x1040, 
-  0x28c1, 0x1060, 0x18a1, 0xee96, 0xee96, 0xee96, 0xd5d2, 0xbcce, 0xbcce, 0xac8e, 0x7b4d, 0x7b6d, 0x7b6d, 0x7b4d, 0x7b4c, 0x3964, 
-  0x3984, 0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xee96, 0xee96, 0xbcce, 0x7b4d, 0x7b6d, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0x8c30, 0x7b6d, 0x734d, 0xbccd, 
-  0xcd71, 0xee96, 0xee96, 0xbcce, 0xac6c, 0x1040, 0x8328, 0x5a05, 0x1060, 0xd4ed, 0x51a4, 0x1040, 0x3964, 0x3964, 0x3963, 0x1060, 
-  0x1040, 0x8328, 0x1040, 0xe656, 0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0x3984, 0x3964, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xee96, 0xee96, 0xee96, 0xbcce, 0x7b6d, 0x7b6d, 
-  0x6b2c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdeba, 0xdeba, 0x7b6d, 0x7b6d, 0x836c, 0xbcce, 0xbcad, 
-  0xee96, 0xee96, 0x0820, 0x1880, 0xbcef, 0x1061, 0x8b29, 0x5a05, 0x1060, 0xcd0d, 0x51c4, 0x1040, 0x3964, 0xbcae, 0xbcce, 0x1040, 
-  0x3123, 0x8b28, 0x1060, 0x942e, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x62a8, 0x4164, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xc550, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xd5d2, 0xee96, 0xee96, 0xee96, 0xbcce, 0x93ed, 
-  0x7b4d, 0x7b6d, 0x734d, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xde9a, 0x732c, 0x7b6d, 0x7b4d, 0xbccf, 0xbcce, 0xc4ce, 0x1040, 
-  0x1041, 0x1040, 0x1040, 0x7ae8, 0x1040, 0x1060, 0x8b29, 0x5a05, 0x1060, 0xabe9, 0x51c4, 0x1040, 0xbcce, 0xee96, 0xbcce, 0x1060, 
-  0x1040, 0x8b09, 0x1040, 0x0800, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x5226, 0x3964, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 0xbcae, 
-  0xbcce, 0xac6e, 0x7b4d, 0x7b6d, 0x7b6d, 0x7b6d, 0x7b6d, 0x7b6d, 0x7b4d, 0x7b4d, 0xbcef, 0xbcce, 0xbcce, 0x1041, 0x1040, 0x0860, 
-  0x6245, 0x59e4, 0x5a05, 0x5a04, 0x5a05, 0x4163, 0x59e4, 0x3123, 0x1040, 0x8b07, 0x51c4, 0x1040, 0xbcce, 0xee96, 0xbccd, 0x1040, 
-  0x3123, 0x6a66, 0x8b08, 0x1060, 0xbcef, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xeeb7, 0x3964, 0xee96, 
-  0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xc52f, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xee96, 0xee96, 0xee96, 0xee96, 
-  0xee96, 0xbcae, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xbcce, 0xacaf, 0xc50f, 0xbccd, 0x1041, 0x1060, 0x1040, 0x1040, 0x8b08, 0x8b28, 
-  0x49c4, 0x1040, 0x1060, 0x1040, 0x5a05, 0x5a04, 0x5a05, 0x1040, 0x0840, 0x7aa5, 0x51c4, 0x1040, 0xbcef, 0xde13, 0xbcce, 0x1060, 
-  0x5a05, 0x5a04, 0x6a45, 0x1040, 0x8bab, 0x5247, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee97, 0x3984, 0x3964, 
-  0x6287, 0xee96, 0xee96, 0xeeb7, 0x5206, 0x3964, 0x3964, 0x3984, 0x7309, 0xbcee, 0xbcce, 0xbcce, 0xbcce, 0xbcee, 0xee96, 0xee96, 
-  0xeeb6, 0xa4af, 0xee96, 0xe675, 0x0840, 0x1040, 0x1040, 0x1060, 0x1040, 0x1040, 0x1041, 0x8b08, 0x8b29, 0x6266, 0x5a04, 0x8308, 
-  0x5a05, 0x5a25, 0x1040, 0x5a05, 0x5a05, 0x5a05, 0x5a04, 0x1040, 0x1040, 0x7a85, 0x51c3, 0x1060, 0x3964, 0xbccd, 0xbcce, 0x1060, 
-  0x20c1, 0x5a05, 0x5a05, 0x8329, 0x1060, 0x1040, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0xee97, 0x3984, 
-  0x3964, 0x3964, 0x3964, 0x3964, 0x3964, 0x3964, 0x4164, 0x28c1, 0x1040, 0x1040, 0x0840, 0xbcce, 0x1040, 0x6267, 0x1040, 0x1060, 
-  0x0840, 0x1040, 0x1060, 0x1060, 0x1060, 0x7ae8, 0x5a26, 0x4143, 0x8308, 0x8328, 0x8308, 0x8b28, 0x5a05, 0x5a04, 0x7ac7, 0x5a04, 
-  0x5a05, 0x1040, 0x1041, 0x5a05, 0x5a05, 0x5a05, 0x5a04, 0x1060, 0x1020, 0x7aa6, 0x51c4, 0x1040, 0x3964, 0xbcce, 0xddf2, 0x1060, 
-  0x1040, 0x51c4, 0x5a05, 0x72c7, 0x1040, 0x1020, 0xbcef, 0x3963, 0xee96, 0xee96, 0xee96, 0xee96, 0xee96, 0x0840, 0x1040, 0x6267, 
-  0x8b08, 0x8329, 0x72c8, 0x8329, 0x8308, 0x8b08, 0x8b08, 0x8b08, 0x8b08, 0x8b28, 0x6267, 0x1040, 0x1060, 0x1040, 0x1040, 0x28c1, 
-  0x30e2, 0x28a1, 0x8b28, 0x8308, 0x832a, 0x8b08, 0x8b08, 0x5a05, 0x8b08, 0x8308, 0x5a05, 0x5a05, 0x72a7, 0x5a05, 0x5a05, 0x1040, 
-  0x1060, 0x1060, 0x1040, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x1060, 0x30e0, 0x7286, 0x51c4, 0x20a1, 0x3984, 0xd5d4, 0xbcce, 0x1041, 
-  0x4143, 0x4143, 0x5a05, 0x5a05, 0x8b08, 0x8349, 0x1040, 0x1060, 0xe614, 0xee96, 0xee96, 0x1041, 0x1040, 0x7ae9, 0x8b08, 0x8b28, 
-  0x8b08, 0x8308, 0x8b08, 0x8b08, 0x82e8, 0x8b08, 0x8b28, 0x8b08, 0x82e8, 0x7266, 0x8b28, 0x8b08, 0x8b49, 0x8b08, 0x8328, 0x8b08, 
-  0x6a66, 0x7ac7, 0x8b29, 0x5a05, 0x5a04, 0x8b28, 0x5a05, 0x5a04, 0x5a05, 0x5a05, 0x2081, 0x1040, 0x1061, 0x1060, 0x1060, 0x1061, 
-  0x4a28, 0x1060, 0x1860, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x1060, 0xc4cd, 0x6a45, 0x3122, 0x838c, 0xee96, 0xb4ae, 0xb4ae, 0x1060, 
-  0x1040, 0x4143, 0x5a05, 0x5a04, 0x8308, 0x8b08, 0x1060, 0x1040, 0xbccd, 0xbcce, 0x1061, 0x1060, 0x51e5, 0x72a7, 0x5a25, 0x5a04, 
-  0x8328, 0x5a05, 0x8308, 0x5a05, 0x5a05, 0x8328, 0x6204, 0x7ac7, 0x5a05, 0x5a04, 0x5a05, 0x5a04, 0x5a05, 0x5a05, 0x5a05, 0x59e5, 
-  0x5a05, 0x5a05, 0x5a25, 0x4163, 0x1040, 0x1041, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x0820, 0x736d, 0x9c92, 0x4a49, 0x3145, 
-  0x0800, 0x1060, 0x5a25, 0x5a05, 0x5a05, 0x5a05, 0x4143, 0x1060, 0xcced, 0x59c4, 0x1860, 0xeeb8, 0xc530, 0xbcce, 0x3964, 0x1060, 
-  0x1040, 0x4143, 0x5a05, 0x5a05, 0x5a05, 0x8b08, 0x8b08, 0x2080, 0x2902, 0x6267, 0x1040, 0x3123, 0x8b08, 0x5a04, 0x1040, 0x1040, 
-  0x1040, 0x1040, 0x1040, 0x20a1, 0x3102, 0x3102, 0x20a1, 0x1060, 0x1040, 0x1060, 0x1040, 0x1061, 0x1040, 0x1060, 0x1060, 0x1040, 
-  0x1060, 0x1060, 0x1060, 0x1040, 0x0820, 0x1060, 0x734c, 0xffbe, 0xf79d, 0xf79e, 0x9c92, 0x9c92, 0x5a8a, 0x9431, 0x9c92, 0x9c92, 
-  0x5248, 0x1060, 0x5a05, 0x5a05, 0x51c4, 0x5a05, 0x3943, 0x1060, 0xbc8c, 0x51c4, 0x1040, 0xbcce, 0xb48d, 0x3964, 0x3964, 0x1060, 
-  0x3902, 0x4163, 0x4163, 0x5a05, 0x5a05, 0x6204, 0x7286, 0x5a05, 0x1060, 0x1060, 0x6a66, 0x5a04, 0x6205, 0x5a05, 0x4163, 0x4143, 
-  0x5228, 0xffbe, 0xad34, 0x9471, 0x9491, 0x5aaa, 0x5aca, 0x5aca, 0x7b8d, 0x5aca, 0x9471, 0xdeba, 0xdedb, 0xffbe, 0xffbe, 0xf7be, 
-  0xf79e, 0xf79e, 0x9471, 0xf79e, 0xf79e, 0xf79e, 0x9c92, 0xf79e, 0xf79e, 0x9471, 0x9c92, 0x9c92, 0xbd96, 0x9c92, 0x9c92, 0x9c92, 
-  0x1040, 0x1040, 0x5a05, 0x5a05, 0x4142, 0x51a4, 0x20a1, 0x1040, 0x7a85, 0x51a4, 0x1041, 0x3964, 0x3964, 0x3984, 0x20c2, 0x1040, 
-  0x3902, 0x4163, 0x4143, 0x4143, 0x5a05, 0x5a05, 0x59e4, 0x5a04, 0x4184, 0x1040, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x4143, 0x49c6, 
-  0x41e7, 0x4a08, 0xf7be, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0x9c92, 0xf79e, 0xf79e, 0xf79e, 0x9c92, 0xa4d3, 0xd659, 0xf79e, 0xef3c, 0x9c92, 0xce18, 0x9c92, 0x9c92, 0x9c92, 
-  0x1040, 0x5a26, 0x4163, 0x4143, 0x4143, 0x4143, 0x1040, 0x1060, 0x7aa6, 0x51a4, 0x1040, 0x3984, 0x3943, 0x3102, 0x1040, 0x5a06, 
-  0x51e4, 0x3102, 0x1040, 0x4143, 0x5a05, 0x5a05, 0x5a04, 0x72a7, 0x6225, 0x1880, 0x5a05, 0x5a05, 0x5a05, 0x4142, 0x5249, 0x4a28, 
-  0xdefb, 0xf7be, 0x9c92, 0xbdb6, 0xf79e, 0xe6fb, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf7be, 0x9c92, 0xce38, 0x9c72, 0xd69a, 0x9472, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xad14, 0x9c92, 0x9c92, 0x9c92, 0x1061, 
-  0x1041, 0x51c4, 0x4143, 0x4163, 0x4143, 0x4143, 0x1040, 0x1060, 0x7aa6, 0x51e5, 0x1040, 0x3102, 0x3102, 0x3102, 0x1041, 0xc4cd, 
-  0x72a7, 0x1040, 0x1040, 0x4143, 0x5a05, 0x5a05, 0x5a05, 0x7ae8, 0x5a05, 0x5a05, 0x5a05, 0x5a26, 0x28e2, 0x5248, 0x4a49, 0xf79e, 
-  0xf79e, 0x9451, 0xf79e, 0xf79e, 0xbdd7, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0x9c92, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0x9c92, 0xf79e, 0xf79e, 0xf79e, 0xf7be, 0x9c92, 0x9c92, 0x9c92, 0x1040, 
-  0x51e5, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x1060, 0x59e4, 0x7aa6, 0x1881, 0x28e2, 0x3102, 0x3102, 0x3102, 0x1060, 0xcccc, 
-  0x7aa6, 0x1040, 0x1060, 0x4143, 0x4983, 0x4143, 0x5a04, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a04, 0x1020, 0x1040, 0xe6da, 0xf79e, 
-  0x9c72, 0xf79e, 0xf79e, 0xd679, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0xdeba, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xbdd7, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0x9c92, 0x9c92, 0x1061, 0x1060, 
-  0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x1060, 0xcd0e, 0x51e4, 0x1041, 0x3102, 0x3102, 0x3102, 0x2902, 0x1040, 0xcccc, 
-  0x7aa6, 0x1041, 0x1040, 0x4143, 0x4143, 0x4143, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x1060, 0x3164, 
-  0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0xf79e, 0xbd96, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xad34, 0xf79e, 0xf79e, 0xf79e, 0x9c92, 0x39c6, 0x1040, 0x5a25, 
-  0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4163, 0x1040, 0xbc8c, 0x51c4, 0x1040, 0x3102, 0x3102, 0x3102, 0x1041, 0x93aa, 0xbc6b, 
-  0x7aa6, 0x59e4, 0x0840, 0x28e2, 0x1860, 0x4143, 0x5a06, 0x5a04, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x1040, 
-  0x3964, 0xbd95, 0xa4f3, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0xf79e, 0x9c92, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0x9c92, 0xf79e, 0xf79e, 0xf79e, 0x840f, 0x1060, 0x28e2, 0x4143, 
-  0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x20a1, 0x1040, 0x82c6, 0x51c4, 0x1040, 0x3102, 0x3102, 0x3102, 0x1060, 0xccec, 0x7a86, 
-  0x7aa6, 0x6a45, 0x4984, 0x1060, 0x1060, 0x4143, 0x4143, 0x59e5, 0x59e5, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 
-  0x4164, 0x3143, 0x4164, 0xef3c, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0xf79e, 0x9c72, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0x9c72, 0xf79e, 0xf79e, 0x1061, 0x1060, 0x1880, 0x4163, 0x4143, 
-  0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x1060, 0x1040, 0x7aa6, 0x20a1, 0x28e2, 0x3102, 0x3102, 0x2903, 0x1040, 0xcccc, 0x7aa6, 
-  0x7aa6, 0x7286, 0x51c3, 0x1060, 0x1060, 0x2902, 0x4163, 0x4143, 0x4143, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 
-  0x5a05, 0x1040, 0xe676, 0x3964, 0x3964, 0xe6fa, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0xf79e, 0x9c72, 0xf79e, 0xf79e, 0xf79e, 0xf79d, 0x9c92, 0x49e7, 0x0840, 0x1041, 0x4184, 0x4143, 0x4143, 0x4143, 
-  0x4143, 0x4163, 0x4143, 0x4142, 0x4143, 0x1060, 0x28c1, 0x6a66, 0x1041, 0x3102, 0x3102, 0x3102, 0x1040, 0xcced, 0xb44b, 0x51c4, 
-  0x7aa6, 0x59e4, 0x51c4, 0x28a1, 0x1040, 0x1060, 0x20a1, 0x4143, 0x4143, 0x4143, 0x4142, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 
-  0x5a05, 0x1040, 0xb4cf, 0xeeb7, 0xe696, 0x3964, 0x3984, 0x49e6, 0xf7be, 0xef9e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 0xf79e, 
-  0xf79e, 0xf79e, 0xf79e, 0x9c72, 0xf79e, 0xef5c, 0x41a5, 0x3984, 0x1040, 0x1060, 0x1040, 0x5a05, 0x4143, 0x4143, 0x4143, 0x4143, 
-  0x4143, 0x4143, 0x4143, 0x4143, 0x1040, 0x1041, 0xbc6c, 0x51c3, 0x1040, 0x3102, 0x3102, 0x3123, 0x1040, 0xcccc, 0x7aa6, 0x51c3, 
-  0x7aa6, 0x51c3, 0x51c4, 0x51c4, 0x51c4, 0x1060, 0x1041, 0x4143, 0x3943, 0x4143, 0x4143, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 
-  0x5a05, 0x5a05, 0x1060, 0x1061, 0xddf3, 0xee96, 0xee96, 0x4184, 0x3964, 0x3964, 0x3964, 0x3964, 0x3964, 0x3964, 0x3964, 0x3964, 
-  0x3964, 0x3984, 0x3964, 0x3964, 0x3144, 0x1040, 0x1040, 0x1060, 0x5a25, 0x5a05, 0x59e5, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 
-  0x4143, 0x4143, 0x4143, 0x1040, 0x1060, 0x1041, 0xb42b, 0x28e2, 0x2903, 0x3102, 0x3102, 0x1040, 0x93aa, 0xcccc, 0x51c4, 0x51c4, 
-  0x7aa6, 0x51c4, 0x51c4, 0x51a3, 0x51a4, 0x1040, 0x1040, 0x18a2, 0x1040, 0x4143, 0x4143, 0x4143, 0x5a04, 0x51c4, 0x5a05, 0x5a05, 
-  0x5a05, 0x5a05, 0x5a05, 0x5a25, 0x28e2, 0x1041, 0x1060, 0x20a1, 0xee96, 0xee96, 0xeeb7, 0xcdb3, 0x836b, 0x5206, 0x5226, 0x49c4, 
-  0x49c4, 0x3964, 0x1060, 0x1040, 0x5a05, 0x5a04, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 
-  0x4143, 0x28e2, 0x18a1, 0x1060, 0x1060, 0x1061, 0x7a86, 0x1041, 0x3102, 0x3102, 0x3102, 0x1040, 0xcccc, 0x7aa6, 0x51c4, 0x1040, 
-  0x7aa6, 0x51c4, 0x51c4, 0x7aa6, 0x51c4, 0x51c4, 0x3923, 0x1041, 0x1060, 0x20c1, 0x4163, 0x4143, 0x4142, 0x4143, 0x5a05, 0x4143, 
-  0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x1840, 0x1040, 0x20a1, 0x3942, 0x1060, 0x1061, 0xbcf0, 0x1020, 0x1040, 0xc4ce, 0xbcef, 0x1040, 
-  0x1040, 0x1060, 0x4184, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x51c4, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4163, 0x4163, 
-  0x4143, 0x1060, 0x1060, 0x1060, 0x1060, 0x1020, 0x6a65, 0x1040, 0x3102, 0x3102, 0x1040, 0x7ae7, 0x9347, 0x51c3, 0x3102, 0x1040, 
-  0x6a25, 0x51c4, 0x51c4, 0x7a86, 0x51c4, 0x51c3, 0x3123, 0x3123, 0x1040, 0x1060, 0x1881, 0x1040, 0x4143, 0x4143, 0x5a05, 0x4163, 
-  0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a04, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x1040, 0x1040, 0x5a05, 0x1060, 0x1060, 0x5a05, 
-  0x49c4, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4163, 0x1040, 
-  0x1060, 0x1060, 0x1040, 0x1040, 0x1060, 0xc4ad, 0x1040, 0x3103, 0x3102, 0x3102, 0x1060, 0xccec, 0x7aa6, 0x51a4, 0x1060, 0x1040, 
-  0x51c4, 0x4184, 0x1040, 0x7aa6, 0x51c4, 0x4984, 0x3123, 0x3122, 0x1881, 0x1060, 0x1040, 0x1060, 0x4143, 0x4143, 0x4143, 0x4143, 
-  0x51a4, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a25, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 
-  0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x4143, 0x5a05, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x1040, 0x1040, 
-  0x1060, 0x1040, 0x1040, 0x3123, 0x1041, 0x7a85, 0x1060, 0x3102, 0x3102, 0x1040, 0x72a7, 0x7aa6, 0x51c4, 0x1040, 0x1040, 0x1060, 
-  0x20c1, 0x1040, 0x1040, 0x7aa6, 0x51c4, 0x3123, 0x28e2, 0x1060, 0x1040, 0x1065, 0x1060, 0x1060, 0x1040, 0x1040, 0x4143, 0x4143, 
-  0x4143, 0x49a4, 0x4143, 0x4142, 0x5a05, 0x51e5, 0x5a05, 0x5a05, 0x59e5, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 0x5a05, 
-  0x5a05, 0x5a05, 0x5a05, 0x4142, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x1060, 0x1860, 0x1040, 0x1060, 
-  0x1060, 0x3123, 0x3102, 0x1040, 0x1020, 0x1860, 0x1060, 0x3102, 0x3122, 0x1060, 0xcced, 0x59e4, 0x1040, 0x0863, 0x1060, 0x1040, 
-  0x1040, 0x1060, 0x28c1, 0x7aa6, 0x49a4, 0x1040, 0x1060, 0x1040, 0x1063, 0x1087, 0x1041, 0x1087, 0x1040, 0x1060, 0x3102, 0x4143, 
-  0x3943, 0x4143, 0x4143, 0x4143, 0x4163, 0x3942, 0x4142, 0x5a05, 0x4143, 0x5a05, 0x5a05, 0x51a4, 0x49a3, 0x4142, 0x5a05, 0x4143, 
-  0x5a05, 0x4143, 0x4143, 0x4143, 0x3943, 0x4143, 0x1040, 0x3963, 0x4143, 0x1040, 0x28c2, 0x1061, 0x1060, 0x1060, 0x3122, 0x1040, 
-  0x1040, 0x3103, 0x2903, 0x1060, 0xac2c, 0x1040, 0x3102, 0x3102, 0x1061, 0x1020, 0x7aa6, 0x49c4, 0x1040, 0x1086, 0x1040, 0x1041, 
-  0x1041, 0x1040, 0x72a5, 0x51c4, 0x1040, 0x1060, 0x1060, 0x1064, 0x0887, 0x1087, 0x0887, 0x0887, 0x1085, 0x1060, 0x0860, 0x4143, 
-  0x1060, 0x1020, 0x4143, 0x4143, 0x4143, 0x4143, 0x4143, 0x4163, 0x4163, 0x4143, 0x4143, 0x4143, 0x4143, 0x4163, 0x4142, 0x4143, 
-  0x4143, 0x1060, 0x4143, 0x3943, 0x0840, 0x1040, 0x1040, 0x1040, 0x1040, 0x1060, 0x1041, 0x0842, 0x0820, 0x2923, 0x0820, 0x1086, 
-  0x0820, 0x0820, 0x0820, 0x1060, 0x1040, 0x0840, 0x3102, 0x1040, 0x1060, 0xbccd, 0x51a3, 0x1061, 0x1086, 0x0842, 0x1041, 0x1064, 
-  0x1061, 0x72a7, 0x51c4, 0x1040, 0x0842, 0x1041, 0x1086, 0x1087, 0x1087, 0x1087, 0x1087, 0x1087, 0x0887, 0x0842, 0x0842, 0x1041, 
-  0x0860, 0x0841, 0x1040, 0x3943, 0x3122, 0x1040, 0x3963, 0x1060, 0x4143, 0x0840, 0x20c2, 0x4143, 0x4143, 0x1040, 0x20a1, 0x4143, 
-  0x1040, 0x1040, 0x1060, 0x1060, 0x1085, 0x1060, 0x1087, 0x1060, 0x0844, 0x1043, 0x1064, 0x1087, 0x0820, 0x0864, 0x1087, 0x1086, 
-  0x0820, 0x0842, 0x1064, 0x1060, 0x1060, 0x0820, 0x1881, 0x0820, 0x1060, 0x82c6, 0x51c4, 0x1040, 0x1087, 0x1060, 0x1041, 0x1087, 
-  0x2080, 0x1040, 0x1061, 0x0864, 0x1087, 0x1087, 0x1087, 0x1087, 0x1087, 0x1087, 0x1087, 0x1087, 0x1087, 0x1086, 0x1086, 0x0842, 
-  0x1060, 0x0867, 0x0886, 0x1041, 0x1041, 0x1040, 0x1040, 0x1060, 0x1060, 0x1061, 0x1041, 0x1060, 0x1060, 0x1060, 0x1060, 0x1041, 
-  0x0863, 0x1060, 0x1060, 0x1086, 0x1087, 0x0887, 0x1087, 0x1085, 0x1087, 0x1087, 0x1087, 0x1086, 0x1086, 0x1087, 0x1087, 0x0843, 
-  0x1087, 0x0887, 0x1041, 0x1060, 0x1086, 0x0863, 0x0820, 0x1086, 0x1060, 0x7aa6, 0x1060, 0x0864, 0x0887, 0x1060, 0x1085, 0x1063
-};
-
-// 'Bonjwa_Logo', 64x64px
-const uint16_t epd_bitmap_bonjwa [] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12e7, 0x1c4a, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1c4b, 0x12e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12e7, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x12e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0963, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x2ced, 0x75f3, 0xc71a, 0xf7be, 0xffff, 
-  0xffff, 0xefde, 0xc71a, 0x75f3, 0x2ced, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x0963, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x12c7, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x6dd2, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0x6dd2, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x12e7, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0943, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x454f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd75c, 0xaed8, 0x9e76, 
-  0x9e76, 0xaed8, 0xd75c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x454f, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x0963, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x5db1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbf1a, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xbf1a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5d91, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cab, 0xffff, 0xffff, 0xffff, 0xffff, 0xdf7c, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x24cc, 0x1cab, 0x148a, 0x148a, 
-  0x148a, 0x148a, 0x1cab, 0x24cc, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xdf7c, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cab, 
-  0x1cac, 0x1cac, 0x1cac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1307, 0x1cac, 0x1cac, 0x1cac, 0xe79d, 
-  0xffff, 0xffff, 0xffff, 0x9676, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x148b, 0x75f3, 0xefbe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xefbe, 0x75f3, 0x148b, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x9676, 0xffff, 0xffff, 0xffff, 
-  0xe79d, 0x1cac, 0x1cac, 0x1cac, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c2a, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 
-  0xffff, 0xdf7c, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x65b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x65b2, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0xdf9d, 0xffff, 
-  0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1c4a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cac, 0x2ced, 0xffff, 0xffff, 0xffff, 
-  0x14ab, 0x1cac, 0x1cac, 0x1cac, 0xaeb8, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf3b, 0x1cab, 0x1cab, 0x24cc, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x24cc, 0x1cab, 0x1cab, 0xd75b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaed8, 0x1cac, 0x1cac, 0x1cac, 0x14ab, 
-  0xffff, 0xffff, 0xffff, 0x2ced, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c2a, 0x1cac, 0x1cac, 0x7e14, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x454f, 0xffff, 0xffff, 0xffff, 0xffff, 0x9676, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0x9676, 0xffff, 0xffff, 0xffff, 0xffff, 0x4d70, 0x1cac, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0x7614, 0x1cac, 0x1cac, 0x1c2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1307, 0x1cac, 0x1cac, 0x7e14, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 
-  0x1cac, 0xefbe, 0xffff, 0xffff, 0xffff, 0x65d2, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0x5570, 0xcf3b, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xc71a, 0x4d70, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x6dd2, 0xffff, 0xffff, 0xffff, 0xefbe, 0x1cac, 
-  0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x75f3, 0x1cac, 0x1cac, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1cac, 0x1cac, 0x2ced, 0xffff, 0xffff, 0xefbe, 0x1cac, 0x1cac, 0x1cac, 
-  0xffff, 0xffff, 0xffff, 0xd75b, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x9676, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8635, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0xdf7c, 0xffff, 0xffff, 0xffff, 
-  0x1cac, 0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x2ced, 0x1cac, 0x1cac, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 0x24cc, 0xffff, 
-  0xffff, 0xffff, 0x24cc, 0x1cac, 0x1cac, 0x1cac, 0xd77c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe79d, 0x75f3, 0x3d0e, 0x2ccd, 
-  0x2ccd, 0x3d0e, 0x75f3, 0xe79d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd75b, 0x1cac, 0x1cac, 0x1cac, 0x24cc, 0xffff, 0xffff, 
-  0xffff, 0x24cc, 0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x24cc, 0xffff, 0xffff, 
-  0xffff, 0x1cac, 0x1cac, 0x1cac, 0x75f3, 0xffff, 0xffff, 0xffff, 0xffff, 0x8635, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0x8634, 0xffff, 0xffff, 0xffff, 0xffff, 0x65b2, 0x1cac, 0x1cac, 0x1cac, 0xffff, 
-  0xffff, 0xffff, 0x24cc, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0943, 0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 
-  0x1cac, 0x1cac, 0x1cac, 0xaed8, 0xa6b7, 0xa6b7, 0xa6b7, 0x2ced, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x34ed, 0xa6b7, 0xa6b7, 0xa6b7, 0xaed8, 0x1cac, 0x1cac, 0x1cac, 
-  0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf9d, 0x1cac, 0x1cac, 0x0963, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x14ab, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x148b, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x12c7, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 0xefbe, 0xffff, 0xffff, 0x24cc, 0x2ccd, 
-  0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x1cac, 
-  0x1cac, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 
-  0x2ccd, 0x24cc, 0xffff, 0xffff, 0xefbe, 0x1cac, 0x1cac, 0xdf7c, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x12e7, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x5db1, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x452f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x454f, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x5591, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0963, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x8e56, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x9e76, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x0984, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x1cac, 0x1cac, 0x454f, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x3d2e, 0x1cac, 0x1cac, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0xefbe, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x0000, 0x0000, 
-  0x0000, 0x12e7, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1328, 0x0000, 
-  0x0000, 0x1cac, 0x1cac, 0x6dd2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5590, 0x1cac, 0x1cac, 0x0000, 
-  0x0000, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x0000, 
-  0x0000, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x0000, 
-  0x12e7, 0x1cac, 0x1cac, 0xa697, 0xa697, 0xa697, 0xa697, 0x8635, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x7e14, 0x9676, 0x9676, 
-  0x9676, 0x9676, 0x65d2, 0x1cac, 0x1cac, 0x1cac, 0x9676, 0x9676, 0x9676, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0x9676, 0x9676, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0x9676, 0x9676, 0x1cac, 0x1cac, 0xa6b8, 0xa697, 0x4d4f, 0x1cac, 0x1cac, 0x1cac, 0xa6b7, 
-  0xa697, 0xa697, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0xa697, 0xa697, 0x1cab, 0x1cac, 0x2ccd, 0x9676, 0x9676, 0x1cac, 0x1cac, 0x1308, 
-  0x1c4a, 0x1cac, 0x2ced, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x350e, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x65d2, 0x1cac, 0x1cac, 0x24cc, 0xffff, 
-  0xffff, 0xffff, 0x148b, 0x1cac, 0x1cac, 0x9676, 0xffff, 0xefbe, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x2ced, 0x1cac, 0x1c6b, 
-  0x1cac, 0x1cac, 0x75f3, 0xffff, 0xffff, 0xf7df, 0xffff, 0xffff, 0xffff, 0x148b, 0x1cac, 0x350e, 0xffff, 0xffff, 0xffff, 0xf7df, 
-  0xf7df, 0xffff, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x65d2, 0x1cac, 0x1cac, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0x148b, 0x1cac, 0x1ccc, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0xffff, 0x65d2, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xc71a, 0xffff, 0xd75b, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x14ab, 0x1cac, 0x3d0e, 0xffff, 0xffff, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0x350e, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x65d2, 0x1cac, 0x148b, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0x148b, 0x1cac, 0x7e14, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xaed8, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xefbe, 0xffff, 0xaeb8, 0x1cab, 0x1cab, 0xffff, 0xffff, 0x0c8a, 0x1cac, 0x3d0e, 0xffff, 0xffff, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x8634, 0xffff, 0xffff, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x65d2, 0x1cac, 0xefbe, 0xffff, 0xb6d9, 
-  0xffff, 0xffff, 0x148b, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xcf5b, 0xffff, 0xdf9d, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x3d0e, 0xffff, 0xffff, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x1cab, 0xffff, 0xffff, 0x24cc, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x65d2, 0x1cac, 0xffff, 0xffff, 0x24cc, 
-  0xffff, 0xffff, 0x148b, 0x4d70, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xefbe, 0xffff, 0x9e97, 0x9676, 0xffff, 0xf7de, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3d0e, 0x1cac, 0x3d0e, 0xffff, 0xffff, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x5590, 0xffff, 0xffff, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x65d2, 0xf7de, 0xffff, 0xb6f9, 0x1cac, 
-  0xffff, 0xffff, 0x14ab, 0xffff, 0xffff, 0x24cc, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x9676, 0xffff, 0xf7de, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xefbe, 0xffff, 0xa697, 0x1cab, 0x1cab, 0xc73b, 0xffff, 0xffff, 0x1cac, 0x3d0e, 0xffff, 0xffff, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x6dd2, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xa6b8, 0xffff, 0xffff, 0x1cab, 0x1cac, 
-  0xffff, 0xffff, 0x7e34, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xcf5b, 0xffff, 0xffff, 0x7e14, 0xcf5b, 0xffff, 0xdf9d, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xbef9, 0xffff, 0xcf3b, 0x1cac, 0x1cac, 0x5570, 0xffff, 0xffff, 0x1cac, 0x3d0e, 0xffff, 0xffff, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x9676, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x24cc, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x454f, 0x1cac, 0x24cc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaed8, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x6dd2, 0xffff, 0xffff, 0xf7de, 0xf7de, 0xffff, 0xffff, 0xffff, 0x1cac, 0x350e, 0xffff, 0xffff, 0xffff, 0xf7de, 
-  0xf7de, 0xffff, 0xffff, 0xffff, 0x1cab, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x24cc, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0xf7de, 0xf7de, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xcf3b, 0xffff, 0xdf7c, 0x1cab, 0x1cab, 0xffff, 0xffff, 0x65d2, 0x1cac, 0x1cac, 
-  0x1c4b, 0x1cac, 0x2ccd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7e14, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0xaeb8, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x75f3, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf3b, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xf7df, 0x1cac, 0x1cac, 0x1cac, 
-  0xffff, 0xffff, 0xffff, 0x5570, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x14ab, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x2ced, 0x1cac, 0x1c6b, 
-  0x12e7, 0x1cac, 0x1cac, 0x7e14, 0x7e14, 0x7e14, 0x7e14, 0x7e14, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x7e14, 0x9676, 0x9676, 
-  0x9676, 0x9676, 0x65b1, 0x1cac, 0x1cac, 0x1cac, 0x9676, 0x9676, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x9676, 0x9676, 0x9676, 0x1cac, 
-  0x1cac, 0x9676, 0x9676, 0x9676, 0x9676, 0x350e, 0x1cac, 0x1cac, 0x1cac, 0x8e55, 0x8e55, 0x8e35, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 
-  0x8e35, 0x8e55, 0x8e35, 0x1cac, 0x1cac, 0x4d4f, 0x9676, 0x9676, 0x1cac, 0x1cac, 0x1cac, 0x8635, 0x8655, 0x1cac, 0x1cac, 0x1328, 
-  0x0000, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x0000, 
-  0x0000, 0x1cac, 0x1cac, 0x2ced, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 
-  0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ced, 0x1cac, 
-  0x1cac, 0x2ced, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 
-  0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x2ccd, 0x1cac, 0x1cac, 0x0000, 
-  0x0000, 0x1cac, 0x1cac, 0x65b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4d70, 0x1cac, 0x1cac, 0x0000, 
-  0x0000, 0x12e7, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1328, 0x0000, 
-  0x0000, 0x0000, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x1cac, 0x1cac, 0x452f, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0963, 0x1cac, 0x1cac, 0xffff, 0xffff, 0x9676, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x8635, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x09a4, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x5d91, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x3d2e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x8635, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5570, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x12e7, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf7d, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-  0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0xe79d, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1308, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0x148b, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x14ab, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0xffff, 0xffff, 0x148a, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0963, 0x1cac, 0x1cac, 0xdf7d, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0xaed8, 0xaed8, 0xaed8, 
-  0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x65b2, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 0xaed8, 
-  0xaed8, 0xaed8, 0xaed8, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xdf7c, 0x1cac, 0x1cac, 0x0984, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x24cc, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x8635, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-  0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 0xe79d, 0x1cac, 0x1cac, 0x1cac, 0xefbe, 
-  0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbd, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x7e14, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 0xefbe, 
-  0xefbe, 0x1cac, 0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x1cac, 0x1cac, 0x2ced, 0xffff, 0xffff, 0xe79d, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x2ced, 0x1cac, 0x1cac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1328, 0x1cac, 0x1cac, 0x75f3, 0xffff, 0xffff, 0xdf9d, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x148a, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0xe79d, 0xffff, 0xffff, 0x6dd3, 0x1cac, 0x1cac, 0x1348, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c4a, 0x1cac, 0x1cac, 0x75f3, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0x1cac, 0x3d2e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x8635, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3d2e, 0x1cac, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0x6dd2, 0x1cac, 0x1cac, 0x1c4b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 0x1cac, 0x2ced, 0xffff, 0xffff, 0xffff, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x9676, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x8635, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9676, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 
-  0xffff, 0xffff, 0xffff, 0x2ced, 0x1cac, 0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c2a, 0x1cac, 0x1cac, 0x1cac, 0xffff, 0xffff, 
-  0xffff, 0xdf7c, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x148b, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cab, 0x1cab, 0x1cab, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0xdf7d, 0xffff, 
-  0xffff, 0xffff, 0x1cac, 0x1cac, 0x1cac, 0x1c4b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1328, 0x1cac, 0x1cac, 0x1cac, 0xdf7c, 
-  0xffff, 0xffff, 0xffff, 0x9676, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x14ab, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x9e97, 0xffff, 0xffff, 0xffff, 
-  0xdf7c, 0x1cac, 0x1cac, 0x1cac, 0x1348, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1cac, 0x1cac, 0x1cac, 
-  0x148b, 0xffff, 0xffff, 0xffff, 0xffff, 0xefbd, 0x148b, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x14ab, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x148b, 0xefbd, 0xffff, 0xffff, 0xffff, 0xffff, 0x148a, 
-  0x1cac, 0x1cac, 0x1cac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x5570, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbf1a, 0x1cac, 0x1cac, 0x1cac, 0x14ab, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0x1cab, 0x1cac, 0x1cac, 0x1cac, 0xbf1a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5591, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0963, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x3d0e, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x3d2e, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x0984, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x12e7, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x4d70, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1cac, 
-  0x1cac, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5591, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1308, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0984, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x2ced, 0x65b2, 0xaeb8, 0xdf7c, 0x1cac, 
-  0x1cac, 0xe79d, 0xb6d9, 0x6dd2, 0x2ced, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x09a4, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1328, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1308, 0x1c6b, 0x1cac, 0x1cac, 0x1cac, 0x1cac, 
-  0x1cac, 0x1cac, 0x1cac, 0x1cac, 0x1c6b, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-// 'dhalucard', 64x64px
-const uint16_t epd_bitmap_dhalucard [] PROGMEM = {
-	0xfe23, 0xfe23, 0xfe23, 0xf5c4, 0xdc67, 0xdc48, 0xdc48, 0xdc28, 0xdc28, 0xd408, 0xb347, 0xb347, 0xab27, 0x4143, 0x0861, 0x0841, 
-	0x0861, 0x1082, 0x18c3, 0x2104, 0x3186, 0x4208, 0x4208, 0x39c7, 0x4208, 0x39c7, 0x1082, 0x0000, 0x3143, 0x0000, 0x9389, 0x93aa, 
-	0x9c0b, 0xa44c, 0xcd50, 0xcd70, 0xcd2f, 0xbccd, 0xbc8c, 0xb46b, 0x9369, 0x0000, 0xfecf, 0xfeef, 0xfef0, 0xfeef, 0xfecd, 0xfeab, 
-	0xfe68, 0xfe44, 0xfe43, 0xfe43, 0xfe43, 0x8b02, 0xfe43, 0xfe43, 0xfe43, 0xdc48, 0xed06, 0xfe23, 0xfe23, 0xfe23, 0xcce2, 0xcce2, 
-	0xfe23, 0xed65, 0xe4a7, 0xe487, 0xdc67, 0xdc48, 0xdc48, 0xdc28, 0xb367, 0xb347, 0xb347, 0x51a2, 0x0841, 0x0841, 0x0841, 0x1082, 
-	0x10a2, 0x2104, 0x3186, 0x31a6, 0x39c7, 0x4a69, 0x4208, 0x2965, 0x0000, 0x3143, 0x9389, 0x9389, 0x0000, 0x93aa, 0x9beb, 0xb4ae, 
-	0xd570, 0xd5b1, 0xd5b1, 0xd5b1, 0xd571, 0xcd2f, 0xbccd, 0xb48c, 0x9389, 0x4184, 0xfecf, 0xfef0, 0xfef0, 0xfecf, 0xfece, 0xfeab, 
-	0xfe88, 0xfe45, 0xfe43, 0xfe43, 0xfe43, 0xa401, 0x6260, 0xfe43, 0xe4e6, 0xdc48, 0xfe23, 0xfe23, 0xfe23, 0xdd42, 0xcce2, 0xcce2, 
-	0xe4c6, 0xe4a7, 0xe487, 0xc3e6, 0xdc68, 0xdc48, 0xbba7, 0xb367, 0xab26, 0x5983, 0x0840, 0x0841, 0x0841, 0x1061, 0x1082, 0x18c3, 
-	0x18e3, 0x3186, 0x31a6, 0x4208, 0x4228, 0x1082, 0x0840, 0x8b69, 0x9389, 0x9baa, 0x93aa, 0x0020, 0xa42b, 0xc52f, 0xcd70, 0xd5b1, 
-	0xd5b2, 0xd5b2, 0xd5b1, 0xd591, 0xd591, 0xcd70, 0xc50f, 0xbcad, 0x93aa, 0x9ba9, 0xc54c, 0xfef0, 0xfef1, 0xfecf, 0xfece, 0xfeac, 
-	0xfe89, 0xfe44, 0xfe43, 0xfe43, 0xfde4, 0xfe24, 0xcd02, 0xfe43, 0xdc48, 0xdc48, 0xfe23, 0xfe23, 0xf603, 0xcce2, 0xcce2, 0xc4c2, 
-	0xe4c7, 0xc406, 0xcc26, 0xe487, 0xdc48, 0xb386, 0x9ae5, 0x92c5, 0x0020, 0x0820, 0x0841, 0x0861, 0x1061, 0x10a2, 0x18c3, 0x2104, 
-	0x31a6, 0x4208, 0x39e7, 0x0000, 0x41a4, 0x9369, 0xa3ea, 0xb46c, 0xbc8c, 0x9beb, 0x20e2, 0xac4c, 0xcd70, 0xd591, 0xd5b1, 0xd5b2, 
-	0xd5b2, 0xd5b2, 0xd5b1, 0xd591, 0xd570, 0xcd70, 0xcd2f, 0xc50e, 0x9beb, 0x9bca, 0x0861, 0xfef0, 0xff98, 0xfef0, 0xfece, 0xfeac, 
-	0xfe88, 0xfe44, 0xfe43, 0xfe43, 0xcc65, 0xfe43, 0xfe43, 0xed06, 0xdc48, 0xdc28, 0xfe23, 0xfe03, 0xdd42, 0xcce2, 0xc4c2, 0xc4c2, 
-	0xbbe5, 0xd446, 0xe487, 0xb386, 0x9ae5, 0x92e5, 0x20a1, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x18a2, 0x18e3, 0x2965, 0x4208, 
-	0x39c7, 0x0000, 0x6a86, 0x9389, 0xb44b, 0xb46c, 0xbcad, 0xc4ee, 0xb48d, 0x72e8, 0xa46d, 0xd591, 0xd5b1, 0xd5b2, 0xd5b2, 0xd5b2, 
-	0xd5b2, 0xd5b1, 0xd591, 0xd571, 0xcd70, 0xc52f, 0xa44d, 0x836a, 0x0020, 0x0841, 0x0000, 0xfef0, 0xff98, 0xff34, 0xfecf, 0xfead, 
-	0xfe68, 0xfe43, 0xfe43, 0xfe43, 0x7281, 0xdd82, 0xfe43, 0xdc48, 0xdc48, 0xed65, 0xfe03, 0xf603, 0xc4c2, 0xc4c2, 0xc4a1, 0x0000, 
-	0xd466, 0xcc06, 0xa325, 0x9b05, 0x92c5, 0x0000, 0x0020, 0x0841, 0x0841, 0x0861, 0x1082, 0x18c3, 0x2104, 0x3186, 0x31a6, 0x0000, 
-	0x7b08, 0x9ba9, 0xb46b, 0xbc8c, 0xbcad, 0xc4ee, 0xcd2f, 0xcd70, 0xa46d, 0x8bab, 0xddb2, 0xddd2, 0xddd2, 0xddd2, 0xd5b2, 0xd5b2, 
-	0xd5b1, 0xd591, 0xd591, 0xc52f, 0xac6d, 0x9c0c, 0x0841, 0x1082, 0x0841, 0x0841, 0x0020, 0xfef0, 0xff98, 0xff77, 0xfece, 0xfecd, 
-	0xfe67, 0xfe43, 0xfe43, 0xfe43, 0xa364, 0x72a0, 0xf585, 0xdc48, 0xdc48, 0xfe23, 0xf603, 0xd522, 0xc4c2, 0xc4c1, 0x6a81, 0x1040, 
-	0xa364, 0xa345, 0x9b25, 0x4962, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x1082, 0x18e3, 0x2945, 0x2965, 0x0000, 0x7b08, 0xa40a, 
-	0xb46b, 0xb48c, 0xbcad, 0xc4ee, 0xcd2f, 0xcd70, 0xd591, 0xbcef, 0x2923, 0xddd2, 0xddd2, 0xddd2, 0xddd2, 0xd5b2, 0xd5b2, 0xd5b1, 
-	0xd5b1, 0xd591, 0xac6d, 0xac6d, 0x0000, 0x2104, 0x0841, 0x0841, 0x0020, 0x0841, 0x0841, 0xff11, 0xff99, 0xff78, 0xfecf, 0xfeac, 
-	0xfe45, 0xfe43, 0xfe43, 0xfe64, 0xdc48, 0xdd63, 0xdc68, 0xdc48, 0xdc48, 0xf603, 0xf5e2, 0xc4c2, 0xc4a1, 0xc4c1, 0x0000, 0xd407, 
-	0xa344, 0xa345, 0x0820, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x10a2, 0x2104, 0x2945, 0x0861, 0x51e5, 0xa3ea, 0xb46c, 0xbc8c, 
-	0xbcad, 0xc4ee, 0xc50e, 0xcd4f, 0xd570, 0xd591, 0xddb2, 0x0840, 0xddd2, 0xddf2, 0xddd2, 0xddd2, 0xddb2, 0xd5b2, 0xd5b2, 0xd5b1, 
-	0xac8e, 0xac6d, 0x6ac8, 0x2945, 0x1082, 0x0841, 0x0841, 0x0861, 0x0841, 0x0000, 0x42ab, 0xe64f, 0xff99, 0xff78, 0xfeef, 0xfeac, 
-	0xfe44, 0xfe43, 0xfe43, 0xa3e2, 0xe468, 0xfde4, 0xdc48, 0xdc48, 0xe4a6, 0xf5e3, 0xcce2, 0xc4a1, 0xbca1, 0x0000, 0xc3a7, 0xd407, 
-	0xa344, 0x0000, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x10a2, 0x18e3, 0x2104, 0x0840, 0x9bca, 0xb46c, 0xbc8c, 0xbccd, 0xc4ee, 
-	0xc50e, 0xcd2f, 0xcd70, 0xd570, 0xd591, 0xddb2, 0x20c2, 0xcd91, 0xddf2, 0xddd2, 0xddd2, 0xddd2, 0xd5b2, 0xd5b2, 0xc550, 0xac8e, 
-	0xac6d, 0x1061, 0x2124, 0x0841, 0x0841, 0x0841, 0x0000, 0x0841, 0xae5a, 0xa619, 0xa639, 0x8bea, 0xff77, 0xff78, 0xfeef, 0xfeab, 
-	0xfe44, 0xfe43, 0xfe43, 0x6240, 0xdc47, 0xdc48, 0xdc48, 0xdc48, 0xf5e3, 0xf5e2, 0xc4c2, 0xc4a1, 0x18a0, 0x4162, 0xd407, 0xd407, 
-	0x1881, 0xa345, 0x0841, 0x0841, 0x0841, 0x0861, 0x10a2, 0x2104, 0x0020, 0x8b48, 0xb44b, 0xb46c, 0xbcad, 0xc4ee, 0xc50e, 0xcd2f, 
-	0xcd70, 0xd570, 0xd591, 0xd5b1, 0xddb1, 0xac6e, 0xbd0f, 0xddd2, 0xddd2, 0xddd2, 0xddd2, 0xd5b2, 0xd5b2, 0xacae, 0xac8e, 0xac8e, 
-	0x1082, 0x18c3, 0x0841, 0x0841, 0x0000, 0x3123, 0x49a5, 0x6267, 0x84b3, 0xb67a, 0xae7a, 0x5245, 0xff35, 0xff78, 0xfeef, 0xfe89, 
-	0xfe43, 0xfe43, 0xfe43, 0xd447, 0xdc48, 0xdc48, 0xdc48, 0xdc48, 0xf5e2, 0xc4c2, 0xc4a1, 0x9bc1, 0x0000, 0xd407, 0xd407, 0xd407, 
-	0xe487, 0xdc47, 0x0841, 0x0841, 0x0861, 0x10a2, 0x18c3, 0x0820, 0x9389, 0xa3ea, 0xb48c, 0xbccd, 0xc50e, 0xcd4f, 0xcd70, 0xd570, 
-	0xd571, 0xd591, 0xd591, 0xd5b1, 0xd5b1, 0x8bab, 0xddd2, 0xddd2, 0xddd2, 0xddd2, 0xddd2, 0xd5b1, 0xacae, 0xacae, 0x8bab, 0x2945, 
-	0x1082, 0x0841, 0x0000, 0x3963, 0x49a4, 0x5a26, 0x9c70, 0x5248, 0xd71c, 0xbe9b, 0xae7a, 0x3163, 0xff12, 0xff78, 0xfeef, 0xfe67, 
-	0xfe43, 0xfe43, 0xe583, 0xdc68, 0xdc68, 0xdc48, 0xdc47, 0xdc67, 0xd522, 0xc4a1, 0xc4a1, 0x0000, 0x8349, 0xd407, 0xd407, 0xd407, 
-	0xe467, 0xe468, 0x0841, 0x0861, 0x1082, 0x1061, 0x5a25, 0xb44b, 0xb46c, 0xbc8c, 0xbcad, 0xcd2f, 0xd570, 0xd591, 0xd591, 0xd591, 
-	0xd591, 0xd591, 0xd591, 0xd591, 0x3164, 0xd5b1, 0xd5b2, 0xddb2, 0xddb2, 0xddb2, 0xc530, 0xacae, 0xac8e, 0x5226, 0x2945, 0x0861, 
-	0x0020, 0x8493, 0xc6bb, 0x3964, 0x83ad, 0x6288, 0x2924, 0xad96, 0xdf3d, 0xbebb, 0xae5a, 0x2102, 0xfef0, 0xff55, 0xfece, 0xfe46, 
-	0xfe43, 0xfe43, 0x5a20, 0xdc48, 0xdc48, 0xdc48, 0xdc47, 0xeda3, 0xc4a1, 0xbc81, 0x0000, 0x0842, 0x0864, 0xd407, 0xd407, 0xd407, 
-	0xdc67, 0xdc48, 0x0841, 0x1082, 0x0820, 0xb44b, 0xb46b, 0xb46b, 0xb46c, 0xbcad, 0xcd2f, 0xd591, 0xd5b1, 0xd5b1, 0xd591, 0xbccf, 
-	0xd570, 0xcd70, 0xcd70, 0xd570, 0xd591, 0xd5b1, 0xd5b2, 0xd5b2, 0xd5b2, 0xacae, 0xb4ae, 0xacae, 0x3164, 0x2104, 0x0841, 0x29a6, 
-	0xbe9a, 0xdf5d, 0xf7bf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xf7df, 0xdf5d, 0xc6dc, 0x4aab, 0x18c1, 0xfef0, 0xff12, 0xfecd, 0xfe45, 
-	0xfe43, 0xfe43, 0xb3a5, 0xdc48, 0xdc48, 0xdc47, 0xdc47, 0xc4a2, 0xc4a1, 0x0000, 0x0842, 0x0842, 0x1084, 0xd407, 0xd407, 0xdc85, 
-	0xdc68, 0xdc48, 0x0000, 0x0000, 0xb46c, 0xb46b, 0xb44b, 0xb46c, 0xbc8c, 0xc4ee, 0xd570, 0xddd2, 0xddb1, 0xd5b1, 0xd591, 0xb4ce, 
-	0x5a67, 0xcd50, 0xcd50, 0xcd70, 0xd591, 0xd5b1, 0xd5b2, 0xd5b2, 0xacae, 0xb4ae, 0xacae, 0x5a67, 0x18c3, 0x0000, 0xa5b7, 0xdf3d, 
-	0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x0861, 0x7329, 0xac8e, 0xac8e, 0x18c1, 0xfef0, 0xfef0, 0xfeab, 0xfe44, 
-	0xfe43, 0xe5a3, 0xdc48, 0xdc48, 0xdc47, 0xdc47, 0xbc63, 0xc4a1, 0x3940, 0x0000, 0x0000, 0x0000, 0x0840, 0xd407, 0xd407, 0xe581, 
-	0xdc68, 0xdc48, 0x92c5, 0x18a2, 0xb46c, 0xb44b, 0xb46c, 0x8b69, 0xbccd, 0xcd2f, 0xd5b1, 0xddd2, 0xddb2, 0xd5b1, 0xd591, 0xac6d, 
-	0xcd50, 0x5246, 0xcd4f, 0xcd50, 0xd591, 0xd5b1, 0xd5b2, 0xacae, 0xacae, 0xacae, 0x93ec, 0x10a2, 0x39e7, 0xb5f8, 0xf7be, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xef7d, 0x10a2, 0x8bcc, 0xd5b1, 0xd5b1, 0xd591, 0xac8e, 0xac8d, 0x20e2, 0xfef0, 0xfef0, 0xfe89, 0xfe43, 
-	0xfe43, 0x49c0, 0xdc47, 0xdc47, 0xdc47, 0xb366, 0xc4a1, 0x72e1, 0x0020, 0x3143, 0x5a25, 0x5205, 0x6a05, 0xd407, 0xd407, 0xe581, 
-	0xfe43, 0xdc28, 0xdc28, 0x9ae6, 0x7b08, 0xb46c, 0x0000, 0x0861, 0x0020, 0xa44d, 0xddd2, 0xddd2, 0xddd2, 0xd591, 0xcd70, 0xac6d, 
-	0xcd50, 0xbcce, 0x7b09, 0xcd50, 0xd5b1, 0xd5b2, 0xacae, 0xacae, 0xacae, 0xb4ae, 0x0861, 0xa576, 0xc659, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xce78, 0x1061, 0xddd2, 0xd591, 0xd591, 0xd591, 0xd570, 0xd570, 0xac6d, 0xac6d, 0x2943, 0xfef0, 0xfeef, 0xfe67, 0xfe23, 
-	0xfe23, 0x92e4, 0xdc48, 0xdc47, 0xb366, 0xc4c1, 0xb441, 0x0000, 0x5205, 0x6246, 0x6aa6, 0x6aa6, 0x5184, 0xd407, 0xdca4, 0xe581, 
-	0xdc48, 0xdc48, 0xdc28, 0xd408, 0x18a1, 0xbc8c, 0x0841, 0x0861, 0x0841, 0x1082, 0x0000, 0xddf3, 0xddd2, 0xd5b1, 0xb4ae, 0x93cb, 
-	0xcd70, 0xcd2f, 0xa42c, 0xa44d, 0xa42d, 0xacae, 0xacae, 0xacae, 0xac8e, 0x0020, 0x6287, 0xce79, 0xffff, 0xffff, 0xffff, 0xdedb, 
-	0x18c2, 0xd591, 0xd591, 0xd591, 0xd570, 0xcd50, 0xcd50, 0xcd4f, 0xc50f, 0x1061, 0x0863, 0x41c4, 0xfef0, 0xfeac, 0xfe44, 0xfe23, 
-	0xf5e3, 0xdc48, 0xdc47, 0xb366, 0xbc63, 0xb461, 0x0000, 0x9389, 0x6a86, 0x6aa7, 0x6a86, 0x6aa7, 0x20a1, 0xd407, 0xe581, 0xe581, 
-	0xfe24, 0xdc28, 0xdc08, 0xdc08, 0x0000, 0xbc8c, 0x0861, 0x0861, 0x0841, 0x0861, 0x2104, 0x2124, 0x836b, 0xd5b1, 0xac8e, 0x93ec, 
-	0xd591, 0xcd2f, 0xa42c, 0x9bec, 0xac8e, 0x5227, 0xac8e, 0xac6d, 0x0840, 0x7b29, 0xac6d, 0x8430, 0xe73c, 0xef7d, 0x0000, 0x3164, 
-	0x0000, 0x0021, 0x0842, 0x0863, 0x0863, 0x0862, 0x0000, 0x1084, 0x10a5, 0x1084, 0x0842, 0x6ae7, 0xfef0, 0xfe8a, 0xfe23, 0xfe23, 
-	0x3120, 0xdc47, 0xb366, 0xb3a5, 0xb461, 0x0000, 0x9389, 0x6a86, 0x6a86, 0x6a87, 0x6a86, 0x6a86, 0x0000, 0xd408, 0xe581, 0xe5a3, 
-	0xfe43, 0xfe04, 0xdc08, 0xdc08, 0x1861, 0xbcad, 0x0861, 0x0861, 0x0020, 0x0841, 0x0841, 0x10a2, 0x2965, 0x18a2, 0xacae, 0x9c2d, 
-	0xd591, 0xcd50, 0xc50f, 0xa42c, 0xa44d, 0xac6d, 0x0861, 0x2923, 0x7309, 0x7309, 0xa42c, 0x2903, 0x0000, 0x1084, 0x18c6, 0x18c6, 
-	0x18c6, 0x18c6, 0x10a5, 0x1084, 0x0883, 0x1084, 0x10a5, 0x10a5, 0x0000, 0x20e2, 0x7309, 0xb4eb, 0xfeef, 0xfe67, 0xfe23, 0xedc3, 
-	0xdc28, 0xb366, 0xb366, 0xbc81, 0x0020, 0x9389, 0x8b48, 0x6a86, 0x6a86, 0x6aa6, 0x6a86, 0x6a86, 0x0820, 0xe562, 0xe582, 0xee07, 
-	0xfe43, 0xfe43, 0xfe24, 0xdc08, 0x69e4, 0xbcad, 0x0841, 0x0020, 0x2924, 0xffff, 0x528a, 0x0841, 0x0841, 0x1082, 0x0020, 0x93ec, 
-	0xd5b1, 0xcd50, 0xcd2f, 0xa42c, 0xa44c, 0xa42c, 0xa42c, 0x836a, 0x3984, 0x0000, 0x10a5, 0x10a5, 0x10a5, 0x0863, 0x0000, 0x0000, 
-	0x0000, 0x2923, 0x8b23, 0xabe4, 0xabc4, 0x9b63, 0x0863, 0x0842, 0x8b8a, 0x838a, 0x41c5, 0xf6ae, 0xfece, 0xfe46, 0xfe03, 0x8aa4, 
-	0xb366, 0xb366, 0xb441, 0x0000, 0x93aa, 0x9389, 0x18a1, 0x6aa7, 0x6a86, 0x6aa7, 0x6a86, 0x6aa7, 0x61e3, 0xe581, 0xedc4, 0xc549, 
-	0xfe43, 0xfe43, 0xfe43, 0xfe43, 0xcba8, 0x5a46, 0x0020, 0x5226, 0x5247, 0xffff, 0xffff, 0xdedb, 0x20e2, 0x0841, 0x0841, 0x0020, 
-	0xd5b1, 0xcd70, 0xcd2f, 0xc50f, 0xa42c, 0xa42c, 0x2903, 0x0841, 0x0883, 0x0883, 0x0021, 0x0000, 0x0020, 0x31a6, 0x4a28, 0x5a67, 
-	0x62ca, 0x6a62, 0xc444, 0xdcc5, 0xdcc5, 0xdcc5, 0x0020, 0x0863, 0x7b29, 0xac6d, 0x18a2, 0xff0f, 0xfeab, 0xfe24, 0x2900, 0xb366, 
-	0xb366, 0x8b61, 0x1081, 0x9bca, 0x93aa, 0x6266, 0x1061, 0x6aa7, 0x6aa7, 0x6aa7, 0x6aa7, 0x6aa7, 0xe4c5, 0xe5a2, 0xee28, 0xc549, 
-	0xfe43, 0xfe43, 0xfe43, 0xfe43, 0xfe43, 0x1061, 0x0020, 0xd591, 0xbd0f, 0xffff, 0xffff, 0xffff, 0x49e6, 0x6ac8, 0x1881, 0x0020, 
-	0xd5b1, 0xcd70, 0xcd2f, 0xa42c, 0x18c2, 0x1084, 0x0863, 0x0863, 0x0000, 0x0820, 0x7282, 0x51e1, 0xd4e7, 0xde78, 0xde98, 0xdcc4, 
-	0xde98, 0xe526, 0xed46, 0xed46, 0xed46, 0xdce5, 0x5a23, 0x0863, 0x3984, 0xac8d, 0x0000, 0xfece, 0xfe68, 0xac42, 0xb366, 0xb366, 
-	0x5a41, 0x41a4, 0x9beb, 0x93ca, 0x93a9, 0x3123, 0x4183, 0x6aa7, 0x6aa7, 0x6aa6, 0x6aa7, 0x5205, 0xe582, 0xede6, 0xc549, 0xa425, 
-	0xfe43, 0xfe43, 0xfe43, 0xfe43, 0xfe23, 0x0000, 0xcd2f, 0xd5b1, 0xddf2, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b3, 0xad96, 0x0841, 
-	0x6ae9, 0x0840, 0x0020, 0x3164, 0x1084, 0x10a5, 0x0000, 0x49a2, 0xc443, 0xc443, 0xd4a4, 0xdcc5, 0xde34, 0xe6b8, 0xeef9, 0xed47, 
-	0xeed7, 0xed46, 0xed47, 0xed47, 0xed47, 0xe506, 0x7aa3, 0x0863, 0x49e5, 0xac8d, 0x0000, 0xfeac, 0xfe66, 0xab26, 0xb346, 0x18a0, 
-	0x8bab, 0xa40c, 0x9bcb, 0x93aa, 0x6aa7, 0x20e2, 0x51e4, 0x6a86, 0x6a86, 0x6aa7, 0x93aa, 0x0840, 0xedc3, 0xddc9, 0xc528, 0x0000, 
-	0xed06, 0xfe43, 0xfe43, 0xfe43, 0xfe43, 0x0000, 0xcd50, 0xddd2, 0xddf2, 0x18e4, 0xb5b6, 0x2965, 0x31a6, 0xef7d, 0x0020, 0x10c5, 
-	0x18c6, 0x18c6, 0x10a5, 0x10a5, 0x10a5, 0x0000, 0xd4a4, 0xdcc5, 0xdcc5, 0xdcc5, 0xdce5, 0xed26, 0xeefa, 0xeef9, 0xeed7, 0xee74, 
-	0xed67, 0xed47, 0xed47, 0xed47, 0xed47, 0xdce6, 0x0000, 0x0842, 0x93cc, 0xb4ce, 0x5224, 0xfe8a, 0x51a3, 0xb346, 0x0820, 0xac6d, 
-	0xa44c, 0x9c0b, 0x9bca, 0x7b28, 0x6aa7, 0x49a3, 0x51e4, 0x5205, 0x6a86, 0x93aa, 0x9bca, 0x3960, 0xee28, 0xc549, 0x1080, 0x8b61, 
-	0xdc08, 0xdc08, 0xd3e9, 0xe4a7, 0xfe24, 0x18a0, 0xd591, 0x4a06, 0x0842, 0x18c6, 0x18c6, 0x18c6, 0x18c6, 0x10a5, 0x18c6, 0x10c5, 
-	0x0021, 0x0000, 0x0000, 0x0000, 0x1084, 0x0863, 0xdcc5, 0xdcc5, 0xdcc5, 0xed26, 0xed26, 0xed46, 0xeef9, 0xeef9, 0xed89, 0xef1a, 
-	0xed47, 0xed47, 0xed47, 0xed47, 0xed8a, 0x18c1, 0x0883, 0x0000, 0x8bab, 0x41c5, 0xc54a, 0x1881, 0xb347, 0x0000, 0xacae, 0xac8d, 
-	0xa44c, 0x9beb, 0x93aa, 0x6aa7, 0x6aa7, 0x51e4, 0x51e4, 0x49e5, 0x93aa, 0x9bca, 0x9bca, 0xe5c5, 0xc549, 0x8384, 0x6261, 0x8b61, 
-	0xfe04, 0xf5a5, 0xdbe9, 0xd3e9, 0xdc09, 0x0000, 0x18e6, 0x10a5, 0x18e6, 0x0841, 0x0000, 0x5204, 0x3963, 0x18c6, 0x0000, 0xddd2, 
-	0xc530, 0xacae, 0xac8e, 0x8b8b, 0x2923, 0x10a4, 0x2901, 0xdcc5, 0xdcc5, 0xdcc5, 0xed46, 0xed26, 0xeef9, 0xeef9, 0xed46, 0xeef9, 
-	0xed47, 0xed47, 0xed46, 0xf73b, 0x0021, 0x0883, 0x0000, 0x8bcb, 0x9c2d, 0x0000, 0x2102, 0x8aa6, 0x18c2, 0xb4ae, 0xb4ae, 0xac6d, 
-	0xa40c, 0x9bca, 0x6aa7, 0x6aa7, 0x5225, 0x51e4, 0x72a6, 0x49c5, 0x93ca, 0x9bca, 0x18c2, 0xddc9, 0xcd48, 0x18a1, 0x0840, 0x8b61, 
-	0xdc08, 0xdc08, 0xd3e9, 0x0020, 0x18c6, 0x18c6, 0x0841, 0x0000, 0xb4ad, 0xf73a, 0xf71a, 0xf6b5, 0x8b44, 0x0000, 0xddd2, 0xddd2, 
-	0xb4ae, 0xb4ae, 0xacae, 0x836a, 0x8bab, 0x1084, 0x0000, 0xdce5, 0xdce5, 0xdce5, 0xdce5, 0xed68, 0xeef9, 0xeef9, 0xed68, 0xedab, 
-	0xedcc, 0xf71a, 0x18e3, 0x0863, 0x1084, 0x0000, 0x8bcb, 0x8bcb, 0xb4ae, 0x0000, 0x20a1, 0x940c, 0xb4cf, 0xb4cf, 0xac8e, 0xa44c, 
-	0x9beb, 0x72e8, 0x6aa7, 0x6aa7, 0x3122, 0x72a6, 0x72a6, 0x5205, 0x9bca, 0x93aa, 0x3982, 0xcd49, 0x0000, 0x8328, 0x6aa7, 0x8b61, 
-	0xdc08, 0xdc08, 0x18e6, 0x18c6, 0x0000, 0x3121, 0x0000, 0xf567, 0xf719, 0xce16, 0x9387, 0xf73a, 0x0000, 0xddf2, 0xddf2, 0xc530, 
-	0xb4cf, 0xb4cf, 0x93cc, 0x836a, 0xa44d, 0x41c5, 0x1084, 0xabc4, 0xdce5, 0xdce5, 0xdce5, 0xe5cf, 0xeef9, 0xee74, 0xef1a, 0xa4f2, 
-	0x0021, 0x10a4, 0x1084, 0x0020, 0x62a8, 0xac8e, 0xb4ae, 0xb4ae, 0x7b2a, 0x0000, 0xb4cf, 0xb4cf, 0xb4cf, 0xacae, 0xac6d, 0x9beb, 
-	0x8b69, 0x6aa7, 0x72e7, 0x9bca, 0x6245, 0x7ac6, 0x72a6, 0x6266, 0x9bca, 0x7b08, 0xcd69, 0x0000, 0x9bca, 0x6aa7, 0x6ac7, 0x0840, 
-	0xfe43, 0xfe43, 0x1881, 0x10a5, 0xeca3, 0xeca3, 0x0000, 0xf567, 0xf71a, 0xef1a, 0xf587, 0x0000, 0xddf3, 0xddf3, 0xde13, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0x836b, 0x3985, 0xb4ce, 0x0863, 0x0000, 0xc465, 0xe528, 0xd5d1, 0x9c90, 0x2103, 0x0022, 0x10a5, 0x10a5, 
-	0x0041, 0x0000, 0xa44d, 0xd5b1, 0xcd50, 0xb4ae, 0xb4ae, 0xb4ae, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4af, 0xac6d, 0x9c0b, 0x93ca, 
-	0x72e8, 0x9bca, 0x9beb, 0xa42c, 0x7ae7, 0x7ac6, 0x7ac6, 0x8369, 0x9bca, 0x0000, 0x0000, 0x9bca, 0x9bca, 0x6ac7, 0x72e8, 0x93aa, 
-	0xfe43, 0xfe43, 0xf623, 0x18c6, 0x59c1, 0xeca3, 0x0020, 0xf567, 0xf71a, 0xef3b, 0x0020, 0x6266, 0x8b68, 0xa3e9, 0xa3e9, 0x72c6, 
-	0x2103, 0xa46e, 0xbcef, 0xb4cf, 0x838b, 0x7309, 0x18c2, 0x0863, 0x0863, 0x0863, 0x0863, 0x0842, 0x0020, 0x0000, 0x20e3, 0xb4cf, 
-	0xddb1, 0xd5b1, 0xd5b1, 0xd5b1, 0xb4ae, 0xb4ae, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4ae, 0xac6d, 0x9c0b, 0x9bca, 0x93ca, 
-	0x9bea, 0xa40b, 0xa42c, 0x41c5, 0x8307, 0x7ac6, 0x7ac6, 0x9beb, 0x8b69, 0x0000, 0x9bca, 0x9bea, 0x72e8, 0x7b08, 0x93aa, 0x93ca, 
-	0xfe43, 0xfe43, 0xfe43, 0x0020, 0x18c6, 0xbc01, 0x0000, 0xf588, 0xf71a, 0xf5cb, 0x7b4a, 0x9ba9, 0xa3ea, 0xa3ea, 0xa3e9, 0x9ba8, 
-	0x9367, 0x8b27, 0x8b27, 0x7ac6, 0x5a04, 0xac8e, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4ae, 0xb4af, 0xddd2, 0xddd2, 
-	0xddd2, 0xddd2, 0xddd2, 0xd591, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xac6d, 0xa40b, 0x9beb, 0x9c0b, 0xa40c, 
-	0xa42c, 0xac6d, 0xa44d, 0x5205, 0x8328, 0x7ae6, 0x5a04, 0xa40b, 0x9beb, 0x9bea, 0x9bca, 0x9bca, 0x8349, 0x9bca, 0x9bca, 0x9bca, 
-	0xfe43, 0xfe43, 0xfe43, 0xfe63, 0x1084, 0x18c6, 0x0000, 0xcdf6, 0xde98, 0x9cb1, 0x0841, 0x0021, 0xac0a, 0xa40a, 0xa3c9, 0x9388, 
-	0x9347, 0x8b27, 0x8b27, 0x3143, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xddd2, 
-	0xddd2, 0xddd2, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xac8e, 0xa44c, 0x3984, 0x9c0c, 0xac8d, 0xb4ae, 
-	0xacae, 0xac8d, 0xa44d, 0x9389, 0x8328, 0x7ac6, 0x20c2, 0xa40c, 0x9c0b, 0x9bea, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 
-	0xfe43, 0xfe43, 0xfe43, 0xfe43, 0xfe23, 0x0000, 0x18c6, 0x18c6, 0x18c6, 0x18c6, 0x10a5, 0x0021, 0x1081, 0xac0a, 0x9ba9, 0x9347, 
-	0x8b27, 0x9367, 0x0020, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xac8e, 0xac8d, 0xac8e, 0x3943, 0x6a85, 0x41a5, 
-	0x836a, 0xb4ae, 0x49e5, 0x8b89, 0x8328, 0x7ac6, 0x4a06, 0xa42c, 0x9c0b, 0x9bea, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x93ca, 
-	0x2122, 0xe5a3, 0xfe43, 0xfe43, 0xfe43, 0xfe43, 0x8342, 0x732a, 0xb4cf, 0xd592, 0xeed8, 0xeef9, 0xef19, 0x5a67, 0x5205, 0x3143, 
-	0x0841, 0x9c4d, 0xb4ef, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4ef, 
-	0xb4ef, 0xb4ef, 0xb4f0, 0xb4f0, 0xbcf0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x836a, 0x72c7, 
-	0x93aa, 0x93ca, 0x8b8a, 0x8b69, 0x8307, 0x7ac6, 0xa44c, 0xa42c, 0x9c0b, 0x9beb, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x93ca, 
-	0x463c, 0x4e3c, 0x3cf7, 0x18e2, 0xdd83, 0xfe43, 0xd543, 0x4a06, 0xe614, 0xddf3, 0xeef9, 0xeef9, 0xeef9, 0xe634, 0xe634, 0xe614, 
-	0xe634, 0xe613, 0xcd91, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x8bcc, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4f0, 0xb4f0, 
-	0xb4f0, 0xbcf0, 0xbd10, 0xbd10, 0xbcf0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 
-	0x49c5, 0x9bcb, 0x93ca, 0x8b69, 0x7b07, 0x51e4, 0xa42c, 0xa42c, 0x9c0b, 0x9beb, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x93aa, 0x93aa, 
-	0x461c, 0x461c, 0x461c, 0x461c, 0x461c, 0x45fc, 0x1166, 0x18a2, 0xe634, 0xddf3, 0xde13, 0xeef9, 0xe634, 0xe634, 0xe654, 0xe634, 
-	0xe634, 0xe614, 0xde13, 0xde13, 0xc530, 0xb4ef, 0xb4ef, 0x41c5, 0x5a67, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4ef, 0xb4f0, 0xbcf0, 0xbd10, 
-	0xbd10, 0xbd10, 0xbd10, 0xbcf0, 0xb4f0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 
-	0xb4ae, 0x41c5, 0x93aa, 0x8b48, 0x7ae7, 0x72c6, 0x41a4, 0xa42c, 0x9c0b, 0x9beb, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x72c7, 0x9389, 
-	0x3dfc, 0x3dfc, 0x45fc, 0x45fc, 0x45fc, 0x45fc, 0x461d, 0x0000, 0xe654, 0xde13, 0xe613, 0xe634, 0xe654, 0xe655, 0xe655, 0xe654, 
-	0xe634, 0xe634, 0xe613, 0xde13, 0xde13, 0xde13, 0x0000, 0xa46e, 0xb4ef, 0xb4f0, 0xb4f0, 0xb4f0, 0xb4f0, 0xbcf0, 0xbd10, 0xbd10, 
-	0xbd10, 0xbd10, 0xbcf0, 0xb4f0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 
-	0xb4cf, 0x93ca, 0x9389, 0x8328, 0x72a6, 0x62a7, 0x3122, 0x6225, 0x9c0b, 0x9beb, 0x9bca, 0x9bca, 0x9bca, 0x9bca, 0x3984, 0x72e7, 
-	0x3dfc, 0x3dfc, 0x3dfc, 0x3dfc, 0x3ddc, 0x35dc, 0x3ddc, 0x0000, 0xe675, 0xe614, 0xe634, 0xe634, 0xe655, 0xe655, 0xe655, 0xe655, 
-	0xe634, 0xe634, 0xe634, 0xddf3, 0x1061, 0xac8e, 0xddf3, 0xbd10, 0xb4ef, 0xb4f0, 0xb4f0, 0xb4f0, 0xbcf0, 0xbd10, 0xbd10, 0xbd10, 
-	0xbd10, 0xbd10, 0xb4f0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 
-	0x41e5, 0x93ca, 0x8b69, 0x8307, 0x2903, 0xa44d, 0xa44c, 0xa44c, 0x62a7, 0x9beb, 0x9beb, 0x9bca, 0x93ca, 0x93a9, 0x0820, 0x6a86, 
-	0x35dc, 0x35dc, 0x35bc, 0x35bc, 0x259c, 0x257c, 0x257b, 0x0841, 0xee96, 0xe634, 0xe634, 0xe634, 0xe655, 0xe655, 0xe675, 0xe655, 
-	0xe654, 0xe634, 0xe654, 0xde13, 0xde13, 0xddd3, 0xb4f0, 0xb4f0, 0xb4f0, 0xbcf0, 0xb4f0, 0xb4f0, 0xbcf0, 0xbd10, 0xbd10, 0xbd10, 
-	0xbd10, 0xbcf0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4af, 
-	0x8b8a, 0x93aa, 0x8b48, 0x72a6, 0xac8d, 0xa44d, 0xa44c, 0xa42c, 0xa40c, 0x9beb, 0x9beb, 0x9bca, 0x93ca, 0x72c7, 0x3143, 0x6a86, 
-	0x35bc, 0x2d9c, 0x259c, 0x257c, 0x257c, 0x1d5c, 0x1d5c, 0x1061, 0xeeb7, 0xe655, 0xe634, 0xe654, 0xe655, 0xe655, 0xe675, 0xe675, 
-	0xe655, 0xe654, 0xe675, 0xe634, 0xe634, 0xbd10, 0xbd10, 0xbcf0, 0xb4f0, 0xb4f0, 0xb4f0, 0xb4f0, 0xbcf0, 0xbcf0, 0xbcf0, 0xbcf0, 
-	0xbcf0, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x6ae9, 
-	0x9beb, 0x9389, 0x8328, 0x3964, 0xac6d, 0xa44d, 0xa44c, 0xa42c, 0xa40c, 0x9c0b, 0x9beb, 0x9bca, 0x9bca, 0x3984, 0x6a86, 0x6aa7, 
-	0x2d9c, 0x257c, 0x257c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x10a2, 0xf718, 0xeeb6, 0xe634, 0xe655, 0xe655, 0xe675, 0xe675, 0xe675, 
-	0xe655, 0xe655, 0xe634, 0xe634, 0x730a, 0xbd10, 0xbd30, 0xbd10, 0xbd10, 0xbcf0, 0xbcf0, 0xbcf0, 0xb4f0, 0xb4f0, 0xb4f0, 0xb4ef, 
-	0xb4ef, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x6287, 
-	0x93aa, 0x8b48, 0x3963, 0xac6d, 0xac6d, 0xa44c, 0xa42c, 0xa42c, 0xa40c, 0xa40b, 0x9beb, 0x9bca, 0x93aa, 0x0000, 0x6aa7, 0x6a86, 
-	0x257c, 0x1d5c, 0x1d5c, 0x1d3c, 0x1d3c, 0x1d3c, 0x1d3c, 0x1d3c, 0x10a2, 0xf6f8, 0xe676, 0xe655, 0xe675, 0xe675, 0xe675, 0xe675, 
-	0xe675, 0xe655, 0xe655, 0xe654, 0xe634, 0xe654, 0xc571, 0xbd10, 0xbd10, 0xbd10, 0xbcf0, 0xbcf0, 0xb4f0, 0xb4f0, 0xb4f0, 0xb4ef, 
-	0xb4ef, 0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x7b2a, 0x9bca, 
-	0x8b89, 0x8348, 0xa44d, 0xac6d, 0xa44d, 0xa44c, 0xa42c, 0xa42c, 0xa40b, 0x9c0b, 0x9beb, 0x9bca, 0x6aa7, 0x0000, 0x6aa7, 0x6a86, 
-	0x1d5b, 0x1d5b, 0x1d3b, 0x1d3b, 0x1d3b, 0x1d1c, 0x1d1b, 0x1d1b, 0x1c78, 0x10a2, 0xeeb7, 0xe675, 0xe655, 0xe675, 0xe675, 0xe675, 
-	0xe675, 0xe655, 0xe655, 0xe655, 0xe654, 0xcdb2, 0xbd10, 0xbd10, 0xbd10, 0xbd10, 0xbcf0, 0xbcf0, 0xb4f0, 0xb4f0, 0xb4ef, 0xb4ef, 
-	0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x6287, 0x93aa, 
-	0x8b48, 0x3143, 0xac6d, 0xac4d, 0xa44c, 0xa42c, 0xa42c, 0xa40b, 0x9c0b, 0x9beb, 0x9bca, 0x93ca, 0x41a4, 0x49e5, 0x6a86, 0x6a86, 
-	0x1d3b, 0x1d3b, 0x1d3b, 0x1d1b, 0x1d1b, 0x1d1b, 0x1d1b, 0x1d1b, 0x1d1b, 0x1b52, 0x3165, 0xeeb7, 0xe675, 0xe675, 0xe675, 0xe675, 
-	0xe675, 0xe675, 0xe655, 0xe655, 0xe655, 0xc551, 0xbd31, 0xbd10, 0xbd10, 0xbd10, 0xbd10, 0xbcf0, 0xb4f0, 0xb4f0, 0xb4ef, 0xb4ef, 
-	0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x838b, 0x9bca, 0x8b89, 
-	0x3984, 0xac8e, 0xac6d, 0xa44c, 0xa42c, 0xa42c, 0xa40c, 0x9c0b, 0x9beb, 0x9bca, 0x9bca, 0x6aa7, 0x0000, 0x6a86, 0x6a86, 0x6a86, 
-	0x1d1b, 0x1d1b, 0x1d1b, 0x1d1b, 0x1d1b, 0x1cfb, 0x1cfb, 0x1cfb, 0x1cfb, 0x1cfb, 0x19c9, 0x5aa9, 0xeeb7, 0xe675, 0xe675, 0xe675, 
-	0xe675, 0xe675, 0xe655, 0xe655, 0xe655, 0xe655, 0xe654, 0xbd31, 0xbd10, 0xbd10, 0xbd10, 0xbcf0, 0xb4f0, 0xb4f0, 0xb4ef, 0xb4ef, 
-	0xb4ef, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x5a67, 0x93aa, 0x8b48, 
-	0xa44d, 0xac6d, 0xa44d, 0xa42c, 0xa42c, 0xa40b, 0x9c0b, 0x9beb, 0x9bea, 0x9bca, 0x8b89, 0x6286, 0x0020, 0x6a86, 0x6a86, 0x72c7, 
-	0x1cfb, 0x1cfb, 0x1d1b, 0x1cfb, 0x1cfb, 0x1cfb, 0x1cfb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1924, 0x9c6f, 0xeeb7, 0xe675, 0xe655, 
-	0xe655, 0xe655, 0xe655, 0xe655, 0xe655, 0xe654, 0xe634, 0xe634, 0xe634, 0xc551, 0xbd10, 0xbd10, 0xb4f0, 0xb4f0, 0xb4ef, 0xb4ef, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x838b, 0x93ca, 0x8b69, 0x41c5, 
-	0xac8e, 0xac6d, 0xa44d, 0xa42c, 0xa40c, 0x9c0b, 0x9beb, 0x9beb, 0x9bca, 0x93aa, 0x6aa7, 0x0000, 0x6a86, 0x6a86, 0x6aa7, 0x93a9, 
-	0x1cfb, 0x1cfb, 0x1cfb, 0x1cfb, 0x1cfb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cbb, 0x18e3, 0xcdd4, 0xee96, 0xe655, 
-	0xe655, 0xe655, 0xe654, 0xe654, 0xe654, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xcdb2, 0xbcf0, 0xb4f0, 0xb4ef, 0xb4ef, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x6aa8, 0x9389, 0x2923, 0xac8e, 
-	0xac6d, 0xac4d, 0xa44c, 0xa42c, 0xa40b, 0x9c0b, 0x9beb, 0x9bca, 0x93aa, 0x6aa7, 0x1081, 0x1081, 0x6a86, 0x6aa7, 0x7b08, 0x93aa, 
-	0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cbb, 0x1cbb, 0x1cbb, 0x14bb, 0x1cbb, 0x18e3, 0xeeb7, 0xee96, 
-	0xe654, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xe634, 0xe614, 0xe613, 0xde13, 0xc530, 0xb4ef, 0xb4ef, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x6ae9, 0x93aa, 0x2903, 0xacae, 0xac8e, 
-	0xac6d, 0xac4d, 0xa42c, 0xa40b, 0x9beb, 0x9beb, 0x9beb, 0x93aa, 0x8328, 0x6266, 0x0000, 0x51e4, 0x6aa7, 0x6aa7, 0x93aa, 0x93aa, 
-	0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cdb, 0x1cbb, 0x1cbb, 0x1cbb, 0x14bb, 0x14bb, 0x14bb, 0x1cbb, 0x14bb, 0x18e3, 0xf6d7, 
-	0xe655, 0xe634, 0xe634, 0xe634, 0xe614, 0xe614, 0xe634, 0xe614, 0xe614, 0xe613, 0xe614, 0xe613, 0xde13, 0xddf3, 0xb4ef, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4ef, 0x8349, 0x3143, 0xb4ae, 0xac8e, 0xac8d, 
-	0xac6d, 0xa42c, 0xa40c, 0x9c0b, 0x9beb, 0x9bea, 0x9bca, 0x93a9, 0x6a86, 0x0000, 0x18a1, 0x6266, 0x6aa7, 0x8349, 0x93aa, 0x93aa, 
-	0x14db, 0x14bb, 0x14bb, 0x14bb, 0x1cbb, 0x1cbb, 0x149b, 0x14bb, 0x14bb, 0x1cbb, 0x149b, 0x149b, 0x149b, 0x149b, 0x147a, 0x18c3, 
-	0xee96, 0xe634, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xde13, 0xddf3, 0xb4ef, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x5247, 0x5205, 0xb4ae, 0xacae, 0xac8e, 0xac6d, 
-	0xa44c, 0xa42c, 0x9beb, 0x9bea, 0x9bca, 0x93aa, 0x93aa, 0x6a86, 0x0000, 0x20c1, 0x4183, 0x6a86, 0x6aa7, 0x93aa, 0x93ca, 0x9bca, 
-	0x14bb, 0x14ba, 0x14bb, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149b, 0x149a, 0x1bf7, 
-	0x18c2, 0xe675, 0xde13, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xde13, 0xde13, 0xde13, 0xddf3, 0xc551, 0xb4cf, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xa44d, 0x5226, 0xb4cf, 0xacae, 0xac8e, 0xac6d, 0xa44c, 
-	0xa40c, 0x9beb, 0x9bca, 0x93aa, 0x93aa, 0x93a9, 0x6a87, 0x0000, 0x1881, 0x1061, 0x6266, 0x6aa7, 0x93aa, 0x93ca, 0x9bca, 0x9bca, 
-	0x14bb, 0x14bb, 0x14ba, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 
-	0x1a8e, 0x4a07, 0xe634, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xb4ef, 0xb4cf, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x3144, 0xb4ae, 0xacae, 0xac8e, 0xac4d, 0xa42c, 0x9c0b, 
-	0x9bca, 0x9bca, 0x93aa, 0x93aa, 0x93a9, 0x6aa7, 0x0020, 0x1061, 0x20c1, 0x6266, 0x6aa7, 0x6aa7, 0xbc8c, 0x9bca, 0x9bca, 0x93aa, 
-	0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x149a, 0x1c9a, 0x149a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 
-	0x147a, 0x1188, 0x8bed, 0xddf3, 0xddf2, 0xddf2, 0xddf2, 0xddf2, 0xddf3, 0xddf3, 0xddf3, 0xddf3, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0x3164, 0xb4ae, 0xac8e, 0xac6d, 0xa44c, 0xa42c, 0x9beb, 0x9bca, 
-	0x9bca, 0x93aa, 0x93aa, 0x93a9, 0x7b08, 0x0861, 0x0840, 0x20c1, 0x2902, 0x6aa7, 0x6aa7, 0xbc8c, 0xbcad, 0xbcad, 0x9bca, 0x9389, 
-	0x1cba, 0x1cba, 0x1c9b, 0x1c9b, 0x1cbb, 0x1c9a, 0x1c9a, 0x147a, 0x1c9a, 0x1c9a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 0x147a, 
-	0x147a, 0x147a, 0x1082, 0xd5d3, 0xddf2, 0xddf2, 0xddf2, 0xddf2, 0xddf2, 0xddd2, 0xddf2, 0x9c0d, 0x20e3, 0x0000, 0x3144, 0xb4cf, 
-	0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4cf, 0xb4ae, 0xac8e, 0xac6d, 0xac4d, 0xa44c, 0xa42c, 0x9beb, 0x9beb, 0x9bca, 0x93aa, 
-	0x93aa, 0x93aa, 0x93aa, 0x9389, 0x1061, 0x0840, 0x20c1, 0x1061, 0x6aa7, 0x6ac7, 0x72e8, 0xbcad, 0xbccd, 0xbccd, 0x9bca, 0x8b48, 
-	0x149a, 0x149a, 0x147a, 0x149a, 0x1c9b, 0x1cbb, 0x1cbb, 0x1c9a, 0x1c7a, 0x1c7a, 0x1c7a, 0x1c7a, 0x1c9a, 0x24bb, 0x1c9a, 0x249a, 
-	0x249a, 0x1c7a, 0x147a, 0x1061, 0xe633, 0x20c1, 0x2901, 0x3120, 0x2900, 0x20c0, 0x8b82, 0xfe43, 0xfe23, 0xfe43, 0xe5a3, 0x9be2, 
-	0x0000, 0x1081, 0xacae, 0xb4af, 0xb4ae, 0xac8e, 0xac6d, 0xa44d, 0xa42c, 0xa40c, 0x9c0b, 0x9beb, 0x9bea, 0x9bca, 0x93aa, 0x93aa, 
-	0x93aa, 0x93aa, 0x93aa, 0x0820, 0x0840, 0x20c1, 0x5205, 0x6aa7, 0x72c7, 0x72c8, 0xbccd, 0xc4ee, 0xc4ce, 0xbcad, 0x93aa, 0x7ae6, 
-	0x149a, 0x147a, 0x147a, 0x1c9a, 0x1c9a, 0x1c9a, 0x149a, 0x1c9b, 0x1c9b, 0x1cbb, 0x24bb, 0x24bb, 0x24bb, 0x1c9a, 0x249a, 0x249a, 
-	0x1c7a, 0x1c7a, 0x1c7a, 0x1c7a, 0x20c1, 0xedc3, 0xfeee, 0xfeab, 0xfe66, 0xfe65, 0xfe43, 0xfe43, 0xfe43, 0xe5e3, 0xdd63, 0xd523, 
-	0xd523, 0xd523, 0xbc82, 0x3981, 0x0000, 0x2903, 0x836a, 0x93cb, 0x2901, 0x9beb, 0x9beb, 0x9bca, 0x9bca, 0x9bca, 0x93aa, 0x93aa, 
-	0x93aa, 0x93aa, 0x0020, 0x1081, 0x0840, 0x6246, 0x6aa7, 0x93ca, 0x72e8, 0x8baa, 0xc4ee, 0xc4ee, 0xc4ce, 0x9bea, 0x9389, 0x72a5, 
-	0x1c9a, 0x1c7a, 0x1c9a, 0x1c7a, 0x1c7a, 0x147a, 0x1c9a, 0x24bb, 0x1c9b, 0x24bb, 0x24bb, 0x24bb, 0x2cdb, 0x24bb, 0x24ba, 0x249a, 
-	0x249a, 0x249a, 0x2cba, 0x249a, 0x24bb, 0xe5a3, 0xff31, 0xf623, 0xd523, 0x9bc2, 0xfe43, 0xede3, 0xfe43, 0xc4c2, 0xe5a3, 0xd523, 
-	0xd523, 0xcd03, 0xcd02, 0xcce2, 0xc4c2, 0xbc81, 0xac41, 0xa400, 0x1080, 0x0000, 0x0000, 0x1081, 0x3963, 0x9bca, 0x93ca, 0x9bca, 
-	0x9bca, 0x0000, 0x1081, 0x5a05, 0x6aa6, 0x9beb, 0xbccd, 0x9c0b, 0x72e8, 0xc50f, 0xc50e, 0xc4ee, 0xbccd, 0x9bca, 0x8b68, 0x6245, 
-	0x1c9a, 0x1c9a, 0x1c9a, 0x1c7a, 0x1c7a, 0x1c9a, 0x249a, 0x1c9b, 0x1c9a, 0x249b, 0x24ba, 0x24bb, 0x24bb, 0x24bb, 0x24bb, 0x24ba, 
-	0x34da, 0x4d3b, 0x34fb, 0x2cba, 0x2cba, 0x4181, 0xfe43, 0xff32, 0xfe43, 0xa402, 0xa3e2, 0xfe23, 0xfe43, 0x8b41, 0xfe43, 0xcd03, 
-	0xcd02, 0xcce2, 0xc4c2, 0xbc81, 0xb461, 0xac21, 0xa400, 0xa3e0, 0xa3e0, 0xa3c0, 0x9bc0, 0x9bc0, 0xa3c0, 0x20e0, 0x0020, 0x93aa, 
-	0x0000, 0x3143, 0x8b69, 0x9bca, 0xbcad, 0xbccd, 0xc4ee, 0x93aa, 0xa42c, 0xc52f, 0xc50e, 0xc4cd, 0xb46c, 0x93aa, 0x8327, 0x0020, 
-	0x1c9a, 0x1c9a, 0x1c9a, 0x1c9a, 0x1c9a, 0x1c9a, 0x249a, 0x249a, 0x24ba, 0x24ba, 0x24ba, 0x24bb, 0x24bb, 0x24bb, 0x24bb, 0x24bb, 
-	0x24bb, 0x2cdb, 0x34fb, 0x3d1b, 0x453c, 0x453b, 0x5201, 0xfe43, 0xfeaa, 0xfe44, 0xfe43, 0xfe43, 0xfe43, 0xfe43, 0xdd63, 0x8b61, 
-	0xd522, 0xbca1, 0xb461, 0xac21, 0xac00, 0xa3e0, 0xa3e0, 0xa3c0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9ba0, 0x0840, 0x0841, 
-	0x9bca, 0xb46c, 0xbcad, 0xbccd, 0xc4cd, 0xc4ee, 0xc4ee, 0x7b29, 0xcd2f, 0xc50f, 0xc4ee, 0xbcad, 0x93aa, 0x9389, 0x7ae6, 0x7285, 
-	0x1c9a, 0x1c9a, 0x1c9a, 0x1c9a, 0x249a, 0x249a, 0x249a, 0x24ba, 0x24bb, 0x24bb, 0x24ba, 0x24bb, 0x24bb, 0x2cdb, 0x3d1b, 0x3d1b, 
-	0x453c, 0x453c, 0x453c, 0x453c, 0x453c, 0x453c, 0x453c, 0x5a62, 0xe5c3, 0xfe43, 0xfe43, 0xfe43, 0xfe23, 0xf603, 0xf5e2, 0xeda2, 
-	0x6aa0, 0x6a80, 0xac00, 0xa3e0, 0xa3e0, 0xa3c0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9bc0, 0x9ba0, 0x0000, 0xa40b, 0xbc8d, 
-	0xbccd, 0xbccd, 0xc4cd, 0xc4ee, 0xc4ee, 0xc50e, 0xa44c, 0xa42c, 0xcd2f, 0xc50f, 0xbccd, 0xbc8c, 0x93aa, 0x8b48, 0x1060, 0x7285, 
-	0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x24ba, 0x24ba, 0x24ba, 0x24ba, 0x24bb, 0x453b, 0x455c, 0x4d5c, 0x453c, 0x453c, 0x453c, 
-	0x453c, 0x453c, 0x451c, 0x3cfc, 0x3cfc, 0x3cfc, 0x453c, 0x4d5c, 0x5494, 0x5a40, 0xfe43, 0xcd02, 0xcce2, 0xc4a1, 0xbc61, 0xb441, 
-	0xb440, 0xc4a0, 0x8300, 0x1060, 0x8b40, 0xa3c0, 0x9bc0, 0x9bc0, 0x9bc0, 0xa3c0, 0x4180, 0x0000, 0x0820, 0xbcad, 0xbcad, 0xc4cd, 
-	0xc4ee, 0xc50e, 0xc50e, 0xc50e, 0xc52f, 0xcd2f, 0xa44d, 0xcd50, 0xd571, 0xc50f, 0xbcad, 0x93aa, 0x9389, 0x8327, 0x5a24, 0x7285, 
-	0x2cdb, 0x24ba, 0x249a, 0x249a, 0x249a, 0x249a, 0x3d1b, 0x453c, 0x4d5c, 0x453c, 0x451c, 0x451c, 0x451c, 0x3cfc, 0x34fc, 0x34dc, 
-	0x34fc, 0x3d1c, 0x4d5c, 0x4d7c, 0x557c, 0x4d7c, 0x557c, 0x455c, 0x3d3c, 0x351c, 0x5a62, 0x8301, 0xbc81, 0xb441, 0xac20, 0xa400, 
-	0xa3e0, 0xa3e0, 0xa3c0, 0xa3c0, 0x9bc0, 0x72c0, 0x49c0, 0x51e0, 0x49e0, 0x0000, 0x0820, 0xbcad, 0xbcad, 0xbcad, 0xc4cd, 0xc4ee, 
-	0xc50e, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd50, 0xac6d, 0xd591, 0xd5b2, 0xc50f, 0xbcad, 0x93aa, 0x9389, 0x0840, 0x7265, 0x7285, 
-	0x453b, 0x34db, 0x24ba, 0x34fb, 0x453b, 0x453c, 0x3d1c, 0x3d1c, 0x3cfc, 0x2cdc, 0x2cfc, 0x34fc, 0x3d1c, 0x3d1c, 0x2cfb, 0x2cfb, 
-	0x351c, 0x4d7c, 0x4d7c, 0x455c, 0x3d3c, 0x455c, 0x455c, 0x455c, 0x455c, 0x4d7c, 0x3d1c, 0x34fb, 0x41a0, 0x49c0, 0x9380, 0xa3e0, 
-	0xa3e0, 0xa3e0, 0xa3e0, 0x9380, 0x6240, 0x18a0, 0x0000, 0x1081, 0x836a, 0xc50e, 0xc4ee, 0xc4ee, 0xc4ee, 0xc4ee, 0xc50e, 0xcd2f, 
-	0xcd2f, 0xcd2f, 0xcd4f, 0xcd2f, 0xcd50, 0xac8e, 0xd591, 0xd5d2, 0xcd71, 0xc4ee, 0x9bca, 0x93aa, 0x7b07, 0x49a3, 0x6a65, 0x72a5, 
-	0x3d1b, 0x3d1b, 0x3d1b, 0x3d1b, 0x3d1b, 0x2cdb, 0x24db, 0x24fb, 0x2cdb, 0x2cfb, 0x34fc, 0x3d1b, 0x24db, 0x1cdb, 0x1cdb, 0x1cdb, 
-	0x24fb, 0x2cfb, 0x2cfb, 0x3d3c, 0x3d3c, 0x455c, 0x455c, 0x455c, 0x455c, 0x453c, 0x455c, 0x4d7c, 0x3d3c, 0xddf2, 0x93ec, 0x41c5, 
-	0x20e2, 0x18a1, 0x3143, 0x6ac8, 0xac8d, 0xc4ef, 0xcd4f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 0xcd2f, 
-	0xcd50, 0xcd4f, 0xcd4f, 0xcd50, 0xcd70, 0x1061, 0xd5d2, 0xd5d2, 0xcd2f, 0xc4cd, 0x93aa, 0x9389, 0x0000, 0x51c3, 0x6a65, 0x7ac6
-};
-
-// 'trilluxe', 64x64px
-const uint16_t epd_bitmap_trilluxe [] PROGMEM = {
-	0x3103, 0x1860, 0x1860, 0x2061, 0x2040, 0x2881, 0x2081, 0x1800, 0x1800, 0x1820, 0x2041, 0x2081, 0x1820, 0x2061, 0x28c1, 0x4144, 
-	0x2060, 0x2060, 0x2081, 0x28a1, 0x2061, 0x2040, 0x2861, 0x30a2, 0x30c2, 0x30c2, 0x30a1, 0x2881, 0x2881, 0x2881, 0x2861, 0x1820, 
-	0x1820, 0x1820, 0x1820, 0x1840, 0x1020, 0x1020, 0x1020, 0x1000, 0x1000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0820, 0x1841, 0x1040, 
-	0x0800, 0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x30e2, 0x2881, 0x38c3, 0x38a2, 0x40c2, 0x6185, 0x5184, 0x5165, 0x4903, 0x5165, 0x59c6, 0x5986, 0x5986, 0x5144, 0x5164, 0x59a5, 
-	0x59c5, 0x59a4, 0x59a5, 0x5164, 0x5143, 0x4943, 0x4923, 0x5164, 0x5984, 0x5165, 0x5144, 0x4923, 0x5143, 0x5143, 0x5143, 0x4943, 
-	0x38c2, 0x40e2, 0x38e2, 0x38a1, 0x38a1, 0x4903, 0x5185, 0x38c2, 0x2860, 0x2860, 0x2020, 0x1800, 0x1800, 0x1800, 0x2061, 0x2061, 
-	0x2061, 0x1020, 0x0800, 0x0800, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x40c2, 0x6185, 0x7206, 0x92c9, 0xcc6f, 0xf636, 0xfefa, 0xdd34, 0xbc0f, 0xb3ad, 0xa32c, 0x8aa9, 0x8a69, 0x8a68, 0x7a27, 0x7206, 
-	0x7227, 0x7206, 0x7a27, 0x71e6, 0x69a5, 0x71e6, 0x8267, 0x92e9, 0x8ac8, 0x8aa8, 0x8267, 0x7a47, 0x7a27, 0x7a26, 0x69c4, 0x69c4, 
-	0x71e4, 0x7205, 0x71e5, 0x7205, 0x6163, 0x5942, 0x69c5, 0x7a67, 0x7247, 0x5984, 0x40c1, 0x3040, 0x2840, 0x2820, 0x3060, 0x2860, 
-	0x2881, 0x2040, 0x1820, 0x1820, 0x1860, 0x1020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x9aa8, 0xcc6f, 0xf636, 0xff7a, 0xff5a, 0xff3a, 0xfe17, 0xecf3, 0xf594, 0xf574, 0xdc90, 0xcc2e, 0xbbcd, 0xab2a, 0x9b0a, 0x92c9, 
-	0x8aa9, 0x92a9, 0x92a9, 0x8a88, 0x8a89, 0x8a88, 0x8a87, 0x92c8, 0x92e8, 0x9b09, 0x9ae9, 0x8a67, 0x8a67, 0x92c9, 0xa349, 0xbbeb, 
-	0xb3ca, 0xbbeb, 0xd4cf, 0xed72, 0xed51, 0xc40c, 0x8225, 0x6984, 0x8267, 0x9b09, 0x8a87, 0x7205, 0x69c4, 0x48c0, 0x40a0, 0x3880, 
-	0x3060, 0x3060, 0x2840, 0x2020, 0x1800, 0x1000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0xfeb5, 0xfed7, 0xff7b, 0xffbd, 0xffff, 0xffff, 0xffff, 0xffff, 0xff3c, 0xedf6, 0xe531, 0xd48f, 0xd44e, 0xd46e, 0xcc0d, 0xc3ed, 
-	0xb36b, 0xab09, 0xa2c9, 0xa2e9, 0xa2c9, 0x9aa8, 0x9ac8, 0xa2e9, 0xab4a, 0xa309, 0xa2e8, 0xa309, 0xab29, 0xb36a, 0xbbca, 0xcc4c, 
-	0xe4ce, 0xf52f, 0xfdb1, 0xfdd1, 0xfdf1, 0xfe12, 0xfdf3, 0xc3ec, 0x79a3, 0x6942, 0x8a86, 0x9b08, 0xa308, 0x9ae8, 0x8286, 0x61a3, 
-	0x5962, 0x5962, 0x5962, 0x5963, 0x38c1, 0x1820, 0x1000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0xfffc, 0xfffd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff9b, 0xfe97, 0xfdb4, 0xecd0, 0xf510, 0xf510, 
-	0xe4af, 0xd44d, 0xd42d, 0xd42e, 0xcc0d, 0xcc0d, 0xc3ec, 0xc3ab, 0xcc0c, 0xcc0c, 0xc3ec, 0xcc2c, 0xcc2c, 0xd44d, 0xc40b, 0xd48c, 
-	0xed2f, 0xf570, 0xfdd1, 0xfdf1, 0xfdf1, 0xfe11, 0xfd90, 0xecee, 0xd46d, 0x9ac7, 0x6942, 0x79c4, 0xab6a, 0xb38b, 0xa308, 0xab49, 
-	0x8a86, 0x8245, 0x8266, 0x7225, 0x59a4, 0x4122, 0x2060, 0x1840, 0x1841, 0x1040, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xff7b, 0xfeb7, 0xfd92, 0xfd92, 
-	0xfd91, 0xfd51, 0xf510, 0xe4af, 0xe48e, 0xdc8e, 0xdc8e, 0xdc8e, 0xd46d, 0xcc2c, 0xd44c, 0xdc8c, 0xe4cd, 0xe4ef, 0xe4ef, 0xed0f, 
-	0xed0e, 0xed2f, 0xfdd1, 0xfe12, 0xfdd1, 0xfe12, 0xfe11, 0xed0e, 0xdcad, 0xcc4c, 0x8a45, 0x7182, 0x7162, 0x9286, 0xab08, 0xaac7, 
-	0xab07, 0xbb68, 0xab07, 0xa328, 0x9b08, 0x71e5, 0x38c1, 0x30a2, 0x2060, 0x3103, 0x3944, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xfffd, 0xfffd, 0xfffc, 0xff18, 0xfe34, 
-	0xfd51, 0xfd51, 0xf530, 0xf530, 0xecef, 0xe4ae, 0xe4ae, 0xe4ad, 0xdcad, 0xe4ae, 0xe4ce, 0xdcad, 0xdc6c, 0xe4ad, 0xe4ee, 0xed0f, 
-	0xed2f, 0xf570, 0xfd90, 0xfe12, 0xfe73, 0xfe93, 0xfdb0, 0xf52e, 0xe4cd, 0xd46c, 0xc3ea, 0xa2e6, 0x8a03, 0x9264, 0x9ac6, 0xb348, 
-	0xab27, 0xbb88, 0xd42a, 0xcc2b, 0xb3aa, 0x92e7, 0x6205, 0x3902, 0x30c1, 0x28a1, 0x51e7, 0x3903, 0x1020, 0x0800, 0x0840, 0x0000, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xfffc, 0xffdb, 0xff7a, 0xfe96, 
-	0xfdd4, 0xfd72, 0xf510, 0xf530, 0xcbeb, 0xe48e, 0xecce, 0xe4ad, 0xe48d, 0xe4ad, 0xe4ce, 0xe4ce, 0xe4ce, 0xe4ae, 0xe4ce, 0xecef, 
-	0xed2f, 0xf52f, 0xfd70, 0xfdb1, 0xfdf2, 0xfe52, 0xfdd0, 0xf52e, 0xeced, 0xe4cc, 0xdc8c, 0xcc0a, 0xc3c9, 0xb347, 0xb347, 0xc3c9, 
-	0xcc09, 0xc3c8, 0xd409, 0xd46b, 0xd46b, 0xbbca, 0x7a46, 0x4101, 0x3101, 0x1840, 0x1840, 0x3123, 0x28c2, 0x0800, 0x0820, 0x0800, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xfffd, 0xffdb, 0xffdb, 0xff9a, 0xff39, 0xfe56, 
-	0xfdd3, 0xfd92, 0xfd71, 0xf4ef, 0xe4ae, 0xecce, 0xecae, 0xecae, 0xe4ae, 0xe4ad, 0xe4ae, 0xe4ce, 0xe4ee, 0xe4ee, 0xecee, 0xecee, 
-	0xf54f, 0xfd70, 0xfd90, 0xfdf2, 0xfdf2, 0xfdd1, 0xfdd1, 0xfd8f, 0xf50d, 0xf50d, 0xe4ac, 0xdc8b, 0xdc6b, 0xcc2a, 0xc3c8, 0xd409, 
-	0xd42a, 0xdc49, 0xdc6a, 0xdc4a, 0xdc6a, 0xcc0b, 0xa349, 0x61e4, 0x3921, 0x1040, 0x0800, 0x0820, 0x2081, 0x1020, 0x0800, 0x0800, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xffba, 0xff7a, 0xff7a, 0xff7a, 0xff39, 0xfed8, 0xfe56, 
-	0xfe14, 0xfdf3, 0xf510, 0xf510, 0xecef, 0xeccf, 0xe4ae, 0xe4ae, 0xecce, 0xe4ce, 0xe4ad, 0xe4ce, 0xe4ce, 0xe4ce, 0xe4ce, 0xe4ad, 
-	0xe4cd, 0xf52f, 0xfd70, 0xfe12, 0xfe12, 0xfdf1, 0xfd90, 0xfd6f, 0xf4ed, 0xf4ec, 0xeccc, 0xe4cc, 0xe4cc, 0xdcab, 0xdc6a, 0xdc6a, 
-	0xdc4a, 0xe48a, 0xe48a, 0xe48a, 0xdc49, 0xd40a, 0xa308, 0x7224, 0x3921, 0x1860, 0x1020, 0x0800, 0x1861, 0x2081, 0x1861, 0x1040, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xffba, 0xff5a, 0xff39, 0xff39, 0xff39, 0xfef8, 0xfe97, 0xfdd4, 
-	0xfd92, 0xf551, 0xf510, 0xf50f, 0xecef, 0xe4ce, 0xe4ae, 0xe48d, 0xe4ad, 0xe4ae, 0xe4ce, 0xe4ce, 0xe4ce, 0xe4cd, 0xe4cd, 0xe4ce, 
-	0xe4cd, 0xe4cd, 0xed0e, 0xfdb1, 0xfd90, 0xfd90, 0xfd6f, 0xfd2e, 0xeccc, 0xecac, 0xeccc, 0xe4cc, 0xeccc, 0xe4ab, 0xe48b, 0xdc8b, 
-	0xe48b, 0xe46b, 0xe46a, 0xe46a, 0xdc4a, 0xcbc9, 0xab49, 0x8286, 0x5183, 0x3903, 0x30c2, 0x1000, 0x0800, 0x1020, 0x1040, 0x1840, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xfffe, 0xfffc, 0xffba, 0xff79, 0xff39, 0xfef8, 0xff19, 0xff39, 0xfed8, 0xfe57, 0xfe35, 
-	0xfe55, 0xfe14, 0xfdd3, 0xfd92, 0xfd71, 0xf510, 0xf510, 0xf50f, 0xecef, 0xecef, 0xecef, 0xf50f, 0xf52f, 0xed0e, 0xed0e, 0xed0e, 
-	0xed0e, 0xed0e, 0xf54f, 0xfdb0, 0xfdf1, 0xfdb0, 0xfdb0, 0xfd6f, 0xeced, 0xecec, 0xeccc, 0xeccc, 0xeccb, 0xe4ab, 0xe48b, 0xe48a, 
-	0xe48b, 0xe48b, 0xe48b, 0xe46a, 0xdc2a, 0xcbc9, 0xb38a, 0x8ac8, 0x4902, 0x38c3, 0x30a2, 0x1840, 0x1040, 0x1861, 0x1000, 0x1020, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xfffd, 0xfffc, 0xffdb, 0xff59, 0xff7a, 0xff7a, 0xff59, 0xff39, 0xfef8, 0xfe77, 0xfe56, 
-	0xfdb3, 0xfd71, 0xfd72, 0xfd71, 0xfd71, 0xfd71, 0xfd71, 0xfd30, 0xfd30, 0xfd30, 0xfd30, 0xfd50, 0xfd50, 0xfd70, 0xfd4f, 0xf54f, 
-	0xfd4f, 0xfd90, 0xfdb0, 0xfd90, 0xfd4f, 0xfd90, 0xf54e, 0xf50e, 0xf4ed, 0xed0d, 0xecec, 0xeccb, 0xeccb, 0xeccb, 0xe48b, 0xe4ab, 
-	0xe4ab, 0xe48b, 0xe46a, 0xdc4a, 0xd429, 0xc3c9, 0xa348, 0x9308, 0x4943, 0x30c2, 0x2860, 0x1820, 0x1881, 0x28e3, 0x2081, 0x1861, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xfffe, 0xfffd, 0xfffd, 0xfffc, 0xffdb, 0xff7a, 0xff39, 0xff39, 0xff18, 0xfeb7, 0xfe35, 
-	0xfdb3, 0xfd72, 0xfdb2, 0xfdb2, 0xfd92, 0xfdd3, 0xfe14, 0xfdd2, 0xfd71, 0xfdd2, 0xfdd3, 0xfd91, 0xfd71, 0xfd70, 0xfd70, 0xfd4f, 
-	0xfd70, 0xfdf1, 0xfdf1, 0xfdf1, 0xfdd0, 0xfd90, 0xf50e, 0xf50d, 0xf50d, 0xf50d, 0xecec, 0xeccb, 0xeccc, 0xeccb, 0xe4ab, 0xe48b, 
-	0xe48b, 0xe48b, 0xdc6a, 0xdc29, 0xcc09, 0xbba8, 0xa348, 0x7a86, 0x4943, 0x2881, 0x2881, 0x1840, 0x2061, 0x28c3, 0x2081, 0x2061, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xfffc, 0xff9a, 0xff7a, 0xffba, 0xff59, 0xfe76, 0xfe35, 
-	0xfd72, 0xfd51, 0xfdb3, 0xfdd4, 0xfdb3, 0xfe35, 0xfe34, 0xfe14, 0xfe34, 0xfe55, 0xfe75, 0xfe55, 0xfdd3, 0xfd71, 0xfd91, 0xfd70, 
-	0xfd90, 0xfdf2, 0xfe12, 0xfe12, 0xfe12, 0xfdd1, 0xfd6f, 0xf52e, 0xf50d, 0xf50c, 0xecec, 0xeccc, 0xecab, 0xecab, 0xe48b, 0xe48b, 
-	0xe48b, 0xe48b, 0xdc4a, 0xd429, 0xd42a, 0xc3e9, 0x9b08, 0x6a04, 0x4963, 0x2880, 0x20c1, 0x1881, 0x1861, 0x28a2, 0x2081, 0x1861, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xfffc, 0xffdc, 0xfffc, 0xfffb, 0xfef8, 0xfe15, 0xfdd4, 
-	0xfd72, 0xfd71, 0xfe14, 0xfe14, 0xfe14, 0xfe76, 0xfef7, 0xff58, 0xff78, 0xff98, 0xfed6, 0xfe95, 0xfed5, 0xfe74, 0xfdd2, 0xfdd2, 
-	0xfdd1, 0xfdf1, 0xfe12, 0xfe32, 0xfe11, 0xfdb0, 0xfd6e, 0xf52e, 0xf50d, 0xed0c, 0xeccc, 0xecac, 0xe48b, 0xe48b, 0xe48b, 0xe48b, 
-	0xe46a, 0xe46a, 0xdc4a, 0xdc49, 0xd409, 0xc3e9, 0x9307, 0x59a2, 0x38e0, 0x2060, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1020, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xfffe, 0xfffe, 0xfffc, 0xff9a, 0xfe76, 0xfdd4, 0xfdb3, 
-	0xfd72, 0xfdf4, 0xfe35, 0xfe35, 0xfe96, 0xfef8, 0xff58, 0xff58, 0xff98, 0xffd9, 0xff98, 0xff17, 0xfe95, 0xfe54, 0xfe12, 0xfdf2, 
-	0xfdf2, 0xfdf1, 0xfdd1, 0xfdd1, 0xfd6f, 0xf50d, 0xed0d, 0xf50d, 0xecec, 0xeccc, 0xeccc, 0xecab, 0xe48b, 0xe46b, 0xe46b, 0xe46a, 
-	0xdc6a, 0xdc4a, 0xdc4a, 0xdc4a, 0xd429, 0xc3e9, 0xa327, 0x6181, 0x30a0, 0x2880, 0x1860, 0x1040, 0x1840, 0x1840, 0x1000, 0x1020, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffd, 0xffbb, 0xfeb7, 0xfdd4, 0xfd72, 0xfd72, 
-	0xfdb3, 0xfe15, 0xfe15, 0xfe35, 0xfe96, 0xff18, 0xff18, 0xff17, 0xff17, 0xff38, 0xfed6, 0xfe75, 0xfe54, 0xfdd2, 0xfd90, 0xfdb1, 
-	0xfdd1, 0xfdd1, 0xfd70, 0xfd4f, 0xf50e, 0xf4ed, 0xeced, 0xecec, 0xeccc, 0xeccc, 0xe4ac, 0xe48b, 0xe46b, 0xe46b, 0xdc6b, 0xdc4a, 
-	0xdc4a, 0xdc4a, 0xdc4a, 0xdc49, 0xd429, 0xcc2a, 0xb368, 0x79e3, 0x4921, 0x30c1, 0x1800, 0x1020, 0x1020, 0x1840, 0x1820, 0x1861, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xfffc, 0xff9b, 0xff39, 0xfe15, 0xfdd4, 0xfd52, 0xfd72, 
-	0xfd93, 0xfdd4, 0xfdf4, 0xfdb3, 0xfdb3, 0xfe35, 0xfe55, 0xfe55, 0xfe75, 0xfe34, 0xfdd3, 0xfd92, 0xfd91, 0xf530, 0xf4ce, 0xecee, 
-	0xfd4f, 0xf50e, 0xf52e, 0xf50e, 0xeced, 0xeccd, 0xeccc, 0xeccd, 0xeccd, 0xe4ac, 0xe48b, 0xe48b, 0xe46b, 0xe46b, 0xdc6b, 0xdc4a, 
-	0xdc4a, 0xdc2a, 0xdc4a, 0xd42a, 0xcc09, 0xcbe9, 0xc3c9, 0x9286, 0x69e4, 0x38c1, 0x2040, 0x1000, 0x1840, 0x1860, 0x1840, 0x1840, 
-	0xfffe, 0xfffe, 0xfffe, 0xfffe, 0xfffe, 0xfffe, 0xfffd, 0xffdc, 0xff7b, 0xff39, 0xfed8, 0xfe97, 0xfdd4, 0xfd52, 0xecaf, 0xecd0, 
-	0xecf0, 0xecf0, 0xe46f, 0xec90, 0xe46f, 0xfd32, 0xf531, 0xf531, 0xfd72, 0xf510, 0xec8f, 0xdc2e, 0xdc4d, 0xd40c, 0xd40b, 0xd42b, 
-	0xd44b, 0xdc8c, 0xe4ac, 0xe4cd, 0xe4ad, 0xdc8c, 0xdc8b, 0xdc8b, 0xdc6b, 0xdc6b, 0xe46b, 0xe46b, 0xe46b, 0xe46b, 0xdc4b, 0xdc4a, 
-	0xdc2a, 0xd42a, 0xd42a, 0xd42a, 0xd40a, 0xd40a, 0xd409, 0xb369, 0x71e5, 0x4924, 0x1820, 0x1020, 0x1820, 0x1840, 0x1000, 0x1020, 
-	0xfffe, 0xfffe, 0xfffd, 0xfffc, 0xfffb, 0xffdb, 0xff9a, 0xff39, 0xfe56, 0xfdb4, 0xfdb3, 0xfd72, 0xe46f, 0xdc0d, 0xcbec, 0xcc0d, 
-	0xcc0d, 0xc3cc, 0xc3cc, 0xcbec, 0xc3cc, 0xe48f, 0xdc4e, 0xcbec, 0xcc0c, 0xc3ab, 0xbb6b, 0xbb6b, 0xb34a, 0xbb6a, 0xc3cb, 0xc3eb, 
-	0xcc0b, 0xcc0b, 0xd42b, 0xd44b, 0xdc6b, 0xdc6b, 0xdc8b, 0xdc6b, 0xdc6b, 0xdc6b, 0xe46b, 0xe46b, 0xdc4b, 0xdc4a, 0xdc4a, 0xdc4a, 
-	0xd42a, 0xd42a, 0xd42a, 0xd42a, 0xd40a, 0xd409, 0xd3e9, 0xbbaa, 0x92a8, 0x4924, 0x2061, 0x1040, 0x1020, 0x1020, 0x0800, 0x0820, 
-	0xfffd, 0xfffd, 0xfffc, 0xfffb, 0xffda, 0xff58, 0xfed7, 0xfe35, 0xfd93, 0xfd12, 0xf4b0, 0xdc2e, 0xcbcc, 0xbbac, 0xab4a, 0xb34a, 
-	0xab0a, 0xa2e9, 0xab09, 0xab29, 0xa309, 0xab2a, 0xb38b, 0x9aa8, 0x9aa8, 0xa2c9, 0xa2c9, 0xa2c9, 0xa2e9, 0xa2e8, 0xa309, 0xb349, 
-	0xbb8a, 0xc3cb, 0xcc0b, 0xcc0b, 0xd44c, 0xd42b, 0xdc2b, 0xdc4b, 0xdc6b, 0xdc6b, 0xdc6c, 0xdc4b, 0xdc4a, 0xdc4a, 0xd44a, 0xd429, 
-	0xd42a, 0xd40a, 0xd42a, 0xd42a, 0xd40a, 0xd408, 0xd3e9, 0xcc2b, 0xab8a, 0x5985, 0x2061, 0x1820, 0x1040, 0x1040, 0x0820, 0x0820, 
-	0xfffe, 0xfffd, 0xfffb, 0xffba, 0xff59, 0xfeb7, 0xfe14, 0xfd92, 0xf510, 0xd40d, 0xc3ac, 0xab0a, 0xa2e9, 0x9ae9, 0x92a8, 0x92a8, 
-	0x8a88, 0x9268, 0x9288, 0x8a87, 0x8a47, 0x8a67, 0x8a68, 0x8248, 0x8228, 0x7a48, 0x82a8, 0x8a88, 0x7a27, 0x8a88, 0x92a8, 0x9ae9, 
-	0xa329, 0xab6a, 0xb3aa, 0xab89, 0xab49, 0xab69, 0xb369, 0xb389, 0xbbaa, 0xbbcb, 0xbbca, 0xc40a, 0xd44b, 0xcc0a, 0xcc0a, 0xcc0a, 
-	0xcc09, 0xcc0a, 0xd42a, 0xd42a, 0xd42a, 0xdc29, 0xdc09, 0xd42a, 0xbba9, 0x7a47, 0x2021, 0x1820, 0x1860, 0x1060, 0x0820, 0x0820, 
-	0xfffc, 0xfffc, 0xffdb, 0xff38, 0xfed6, 0xfe35, 0xfdb3, 0xe4d0, 0xcc2d, 0xab6b, 0x9ae9, 0x9288, 0x8247, 0x79e6, 0x7a06, 0x7a06, 
-	0x7a07, 0x8206, 0x79c6, 0x79e6, 0x79e6, 0x71c5, 0x69c6, 0x69a6, 0x6186, 0x5965, 0x4903, 0x5144, 0x5164, 0x5184, 0x5184, 0x5984, 
-	0x61c5, 0x61e5, 0x69e5, 0x61c4, 0x61c4, 0x61e5, 0x61e4, 0x69e5, 0x7226, 0x7a06, 0x8267, 0x8a46, 0x8a86, 0x92c7, 0x9ae7, 0xa327, 
-	0xbb88, 0xbba8, 0xcc0b, 0xcc0b, 0xd42a, 0xdc29, 0xdc49, 0xd44a, 0xd46b, 0xabeb, 0x2860, 0x2040, 0x1881, 0x0000, 0x0000, 0x0000, 
-	0xfffb, 0xfffb, 0xffbb, 0xfef8, 0xfe14, 0xf551, 0xf552, 0xbc0e, 0x92c9, 0x7207, 0x69c5, 0x69a5, 0x69a5, 0x6985, 0x6985, 0x6984, 
-	0x69a5, 0x79c6, 0x79a5, 0x7a06, 0x79e6, 0x69c5, 0x6185, 0x5944, 0x5104, 0x48e3, 0x48e3, 0x38a2, 0x3081, 0x2040, 0x2040, 0x1820, 
-	0x1020, 0x1020, 0x1820, 0x2020, 0x30a1, 0x3081, 0x3080, 0x3060, 0x38a1, 0x3040, 0x3860, 0x40a0, 0x50e1, 0x5962, 0x69a3, 0x7a04, 
-	0x8a43, 0xa306, 0xbbea, 0xc40a, 0xd42a, 0xdc2a, 0xdc4a, 0xdc4a, 0xd46a, 0xcc6d, 0x5142, 0x2060, 0x0800, 0x0000, 0x0000, 0x0800, 
-	0xff79, 0xfed8, 0xf5f5, 0xe511, 0xcc8f, 0x9309, 0x934a, 0x61c5, 0x40e2, 0x3881, 0x38a1, 0x38c2, 0x48e2, 0x50e3, 0x5923, 0x6184, 
-	0x6184, 0x71a5, 0x71c5, 0x8268, 0x9288, 0x71e6, 0x59a5, 0x5143, 0x40c1, 0x40a1, 0x3881, 0x3040, 0x2840, 0x2020, 0x1800, 0x1000, 
-	0x1000, 0x1000, 0x1820, 0x2040, 0x3081, 0x3081, 0x38c1, 0x40a1, 0x40a1, 0x4080, 0x40a1, 0x48c1, 0x5102, 0x5922, 0x6163, 0x6983, 
-	0x8224, 0x9ae6, 0xbb89, 0xcbea, 0xcbe9, 0xd40a, 0xdc4a, 0xd44a, 0xd44a, 0xd42a, 0x8265, 0x2040, 0x0800, 0x0000, 0x0800, 0x1820, 
-	0xe510, 0xbbed, 0xa34a, 0x8aa8, 0x69e6, 0x4943, 0x3060, 0x2840, 0x2000, 0x2840, 0x2840, 0x3081, 0x38a2, 0x40a2, 0x48e2, 0x5143, 
-	0x5143, 0x5943, 0x8207, 0xab0a, 0xbb8b, 0xa32a, 0x7a26, 0x5143, 0x40e2, 0x38a1, 0x3081, 0x3081, 0x2860, 0x2041, 0x1820, 0x1800, 
-	0x1820, 0x1840, 0x2861, 0x2882, 0x30a2, 0x38c2, 0x40c1, 0x40c1, 0x48e2, 0x48e2, 0x48e2, 0x5123, 0x5123, 0x5922, 0x5922, 0x6141, 
-	0x8204, 0x9ac6, 0xb348, 0xc3c9, 0xcbe9, 0xd429, 0xdc4a, 0xdc6a, 0xe46a, 0xe44b, 0xa328, 0x3080, 0x2061, 0x1020, 0x1820, 0x38a0, 
-	0xab29, 0x8aa8, 0x71e5, 0x5143, 0x5123, 0x40c2, 0x4903, 0x4904, 0x4103, 0x38c3, 0x30a3, 0x2041, 0x2000, 0x2000, 0x2820, 0x2880, 
-	0x38c1, 0x48e2, 0x9aca, 0xd48f, 0xf530, 0xf4ef, 0xcc2c, 0x6984, 0x48e2, 0x38a1, 0x3060, 0x2820, 0x1820, 0x1000, 0x1000, 0x1000, 
-	0x1000, 0x0800, 0x0800, 0x0800, 0x1020, 0x1840, 0x2881, 0x2881, 0x30a2, 0x2881, 0x2880, 0x3080, 0x40c1, 0x5101, 0x61a3, 0x79e3, 
-	0x8a44, 0xab27, 0xbb88, 0xd40a, 0xdc4a, 0xdc6a, 0xdc6a, 0xe48a, 0xe46a, 0xe46b, 0xc3eb, 0x5162, 0x20a1, 0x20a1, 0x2860, 0x6963, 
-	0x9a67, 0x8248, 0x79c6, 0x71e6, 0x69c6, 0x61a5, 0x5144, 0x38c2, 0x30a2, 0x2082, 0x1000, 0x0000, 0x0000, 0x0800, 0x1800, 0x1820, 
-	0x2840, 0x5103, 0xa38d, 0xff3a, 0xfe95, 0xfe12, 0xfe13, 0xcbec, 0x6143, 0x40c2, 0x38a1, 0x3081, 0x2000, 0x1000, 0x1800, 0x2061, 
-	0x3103, 0x1861, 0x0800, 0x0800, 0x0800, 0x1861, 0x1820, 0x1000, 0x1800, 0x2000, 0x2840, 0x40a1, 0x6162, 0x8245, 0xa306, 0xc3e9, 
-	0xdc8b, 0xdc8b, 0xeccc, 0xeccc, 0xeccc, 0xeccb, 0xe48b, 0xe48b, 0xe489, 0xe46a, 0xcc4c, 0x6a05, 0x20c0, 0x20c0, 0x2880, 0x8246, 
-	0xbb09, 0x8aa9, 0x9288, 0x9288, 0x6184, 0x4903, 0x38a2, 0x2041, 0x20a2, 0x0820, 0x0000, 0x0000, 0x0800, 0x1020, 0x2061, 0x2060, 
-	0x3881, 0x6144, 0xe618, 0xffff, 0xfffd, 0xff16, 0xfe33, 0xec6d, 0xb36a, 0x5122, 0x40c2, 0x4104, 0x4104, 0x4945, 0x40e4, 0x38c2, 
-	0x38c2, 0x38c2, 0x40c2, 0x48e2, 0x5963, 0x69e6, 0x8267, 0x8a87, 0x9b09, 0xab6a, 0xbbca, 0xcc2b, 0xd44b, 0xdc4b, 0xe48c, 0xed0d, 
-	0xf54d, 0xfd6e, 0xfd4e, 0xfd4d, 0xf50d, 0xecec, 0xeccc, 0xe48b, 0xe489, 0xdc29, 0xdc0c, 0x9aa8, 0x4902, 0x28c1, 0x3080, 0x8aa8, 
-	0xcc6d, 0x9b08, 0x9a67, 0x6983, 0x5123, 0x3881, 0x2841, 0x4124, 0x4965, 0x5186, 0x38e3, 0x3904, 0x4104, 0x4905, 0x5165, 0x6a27, 
-	0x7a08, 0xa2aa, 0xff9d, 0xffff, 0xffff, 0xff58, 0xfdd2, 0xe3ca, 0xe42c, 0xab29, 0x6143, 0x5944, 0x5965, 0x5944, 0x61a5, 0x69c5, 
-	0x69a5, 0x6185, 0x69a5, 0x6964, 0x71a4, 0x7983, 0x8a04, 0xa2c6, 0xbb69, 0xcbea, 0xd44b, 0xe48c, 0xdc6b, 0xdc8b, 0xeccc, 0xfd4e, 
-	0xfd8f, 0xfdb0, 0xfd6f, 0xfd4e, 0xfd2d, 0xf50d, 0xf4ed, 0xecac, 0xe46a, 0xe44b, 0xdbeb, 0xb329, 0x5143, 0x38e1, 0x30a0, 0x8246, 
-	0xfeb3, 0xed70, 0xd3ee, 0xa2e9, 0x9aa9, 0x9288, 0x9b0a, 0x71c5, 0x6985, 0x69a6, 0x5944, 0x5924, 0x5945, 0x71a7, 0x7a49, 0x8249, 
-	0x9249, 0xdc91, 0xffff, 0xffff, 0xfffe, 0xfef6, 0xfd71, 0xe3ca, 0xe3ea, 0xe42b, 0xdc2c, 0xcbec, 0xd46d, 0xbbcb, 0xbbaa, 0xcc0c, 
-	0xc3ab, 0xb34a, 0xbbab, 0xbb8a, 0xcc0c, 0xdc4c, 0xe4ad, 0xeccd, 0xf4cd, 0xf4cd, 0xf4ed, 0xeced, 0xf50e, 0xf52f, 0xfd90, 0xfdf1, 
-	0xfdf1, 0xfdd0, 0xfdb0, 0xfd6f, 0xfd6e, 0xfd2d, 0xf4ec, 0xecac, 0xe46b, 0xec4b, 0xe44c, 0xbb89, 0x7204, 0x40e0, 0x69c4, 0xb36a, 
-	0xfffb, 0xfffd, 0xffde, 0xffdc, 0xff18, 0xf5d3, 0xe4af, 0xc3ac, 0xa2c9, 0x9268, 0x8207, 0x8208, 0x8228, 0x8a49, 0x928a, 0x9aa9, 
-	0xb34b, 0xfefa, 0xffff, 0xffff, 0xfffe, 0xfe95, 0xfd51, 0xe3eb, 0xdbea, 0xd3c9, 0xe44b, 0xec8c, 0xf50e, 0xf52f, 0xf50e, 0xec8d, 
-	0xf4ce, 0xf4ce, 0xf4ef, 0xfd0f, 0xfd2f, 0xfd0f, 0xfd2f, 0xfd4f, 0xfd70, 0xfd90, 0xfdd1, 0xfdf1, 0xfdf1, 0xfe11, 0xfe11, 0xfe11, 
-	0xfdb0, 0xfd6f, 0xfd4f, 0xfd2e, 0xfd0d, 0xf4ed, 0xf4ed, 0xeccd, 0xec8c, 0xe46b, 0xdc4b, 0xc3ca, 0x9b28, 0x7204, 0x9ac7, 0xd40d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffbd, 0xff19, 0xfdf6, 0xdc91, 0xcb4d, 0xbaeb, 0xab0b, 0xbb8d, 0xc38d, 0xc3cd, 
-	0xfe97, 0xfffe, 0xffff, 0xffff, 0xffdd, 0xfe34, 0xfcaf, 0xec2c, 0xdbea, 0xd3c9, 0xd3c9, 0xec8c, 0xf50e, 0xf50f, 0xecce, 0xeccd, 
-	0xecad, 0xecae, 0xecad, 0xf4ce, 0xfd0f, 0xfd30, 0xfd50, 0xfd70, 0xfdb1, 0xfdf1, 0xfe12, 0xfe33, 0xfe53, 0xfe32, 0xfdf2, 0xfdb0, 
-	0xfd6f, 0xfd2f, 0xfd0e, 0xfced, 0xf4cd, 0xf4cc, 0xf4ac, 0xecad, 0xec8c, 0xe48b, 0xdc4b, 0xd44c, 0xc3cb, 0xa307, 0xbb48, 0xdc0b, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffbe, 0xff5c, 0xfe58, 0xfd95, 0xfe36, 
-	0xfffb, 0xfffe, 0xffff, 0xffff, 0xff7b, 0xfdf4, 0xf48e, 0xe44c, 0xdc2b, 0xd3ea, 0xd3c9, 0xd3ca, 0xcbca, 0xc369, 0xcbcb, 0xcbeb, 
-	0xd42c, 0xdc4d, 0xe46d, 0xe48d, 0xecad, 0xf4ef, 0xfd30, 0xfd50, 0xfd70, 0xfd91, 0xfdd1, 0xfe12, 0xfe33, 0xfdf2, 0xfdd1, 0xfd90, 
-	0xfd6f, 0xfd2f, 0xf4ee, 0xf4cd, 0xf4cd, 0xf4ac, 0xecac, 0xec8d, 0xec8c, 0xe46b, 0xdc4b, 0xd44b, 0xd40b, 0xbb69, 0xc368, 0xd409, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdd, 0xffba, 
-	0xffdb, 0xfffe, 0xffff, 0xfffe, 0xfe36, 0xfdd3, 0xfe13, 0xe46b, 0xdc4b, 0xdc2b, 0xdc0a, 0xd3ea, 0xcb89, 0xb308, 0x8a26, 0x9267, 
-	0xab29, 0xb34a, 0xc3ab, 0xcbed, 0xd40c, 0xdc4d, 0xe48d, 0xecae, 0xecae, 0xecce, 0xf4ee, 0xf4ef, 0xf4ee, 0xfd0e, 0xfd0e, 0xfd0e, 
-	0xfcee, 0xf4ed, 0xf4cd, 0xec8c, 0xec8c, 0xec8c, 0xec6c, 0xec6c, 0xe48c, 0xe46b, 0xdc4b, 0xd42b, 0xcbcb, 0xc389, 0xbb88, 0xcbe9, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffbe, 0xff7d, 0xfef9, 0xfe76, 
-	0xfffd, 0xffff, 0xff9c, 0xfdd5, 0xfc6f, 0xec4d, 0xdd0f, 0xe46c, 0xdc4b, 0xdc0a, 0xdc0a, 0xdc0a, 0xcbaa, 0xb329, 0x81e6, 0x7184, 
-	0x71a5, 0x79e6, 0x8a68, 0x92a8, 0xa2e9, 0xb349, 0xc38a, 0xcbeb, 0xd40c, 0xdc4c, 0xdc4c, 0xe48d, 0xecad, 0xecad, 0xf4cd, 0xf4cd, 
-	0xf4cd, 0xf4ad, 0xec8c, 0xec8c, 0xe46b, 0xe46b, 0xec6c, 0xe46b, 0xe44b, 0xdc4b, 0xdc4b, 0xd40b, 0xcbeb, 0xc3ca, 0xbbc9, 0xcc09, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xff7b, 0xfe98, 0xfd95, 0xfcd2, 0xf48f, 0xfef7, 
-	0xff9a, 0xf5b4, 0xdbad, 0xaaa9, 0xaa47, 0xa247, 0x9a67, 0x9286, 0xa2c7, 0xbb69, 0xcbca, 0xcbaa, 0xc389, 0xa286, 0xa2e9, 0xa2e9, 
-	0x8a67, 0x6985, 0x6144, 0x6185, 0x69a5, 0x7a06, 0x8267, 0x9ae8, 0xab49, 0xc3ab, 0xcbca, 0xcc0b, 0xd42b, 0xd42b, 0xdc4b, 0xe46b, 
-	0xe46c, 0xe48c, 0xe46c, 0xe46c, 0xe46c, 0xe44b, 0xe44b, 0xdc4b, 0xdc4b, 0xdc4b, 0xdc4b, 0xd42b, 0xcc2b, 0xc3c9, 0xbb88, 0xbb88, 
-	0xffff, 0xffff, 0xfffe, 0xfffe, 0xfffe, 0xfffe, 0xfffe, 0xffdd, 0xff9b, 0xfe16, 0xe4b0, 0xd3ce, 0xbb0a, 0xb2a8, 0xe4f1, 0xfeb8, 
-	0xdc2f, 0x9226, 0x81c6, 0x6964, 0x6124, 0x60e3, 0x5164, 0x5143, 0x48c2, 0x48c2, 0x6103, 0x7143, 0x81a4, 0xaa87, 0xbb2a, 0xbb49, 
-	0xbbcb, 0xbbcc, 0x9b2a, 0x7206, 0x5964, 0x5964, 0x5964, 0x61a4, 0x7a06, 0x9ac8, 0xab49, 0xbb69, 0xbb89, 0xc3aa, 0xcbca, 0xd40a, 
-	0xd42b, 0xdc2b, 0xdc4b, 0xdc2b, 0xdc2b, 0xdc4b, 0xdc4b, 0xdc4b, 0xdc4b, 0xd42b, 0xd42b, 0xd44c, 0xd44b, 0xbbc9, 0xbba9, 0xcbea, 
-	0xffff, 0xfffd, 0xfffc, 0xfffc, 0xffbb, 0xff5a, 0xfed7, 0xfdf5, 0xdc6f, 0xaae9, 0x9a69, 0x8a07, 0xa268, 0xed73, 0xff7b, 0xfefa, 
-	0xbb8d, 0x5861, 0x3040, 0x5945, 0x5144, 0x5104, 0x48e3, 0x3041, 0x2861, 0x2020, 0x2820, 0x50e2, 0xb36a, 0xc36a, 0xcbab, 0xcbcb, 
-	0xcbcb, 0xc3ab, 0xab49, 0x92a7, 0x6a06, 0x61e6, 0x4924, 0x4923, 0x5964, 0x69c5, 0x8a67, 0xa2e8, 0xab28, 0xb369, 0xbb89, 0xc3aa, 
-	0xcbca, 0xcbeb, 0xd40b, 0xd40b, 0xd42a, 0xdc2b, 0xd42b, 0xd42b, 0xd42b, 0xd42b, 0xd42c, 0xd44c, 0xd42b, 0xc3ca, 0xb389, 0xdc4c, 
-	0xfffe, 0xfffa, 0xff99, 0xff38, 0xfe97, 0xfdf5, 0xec90, 0xbb0a, 0x9a89, 0x8a07, 0x7186, 0x81e7, 0xd490, 0xff3a, 0xff7a, 0xffdc, 
-	0xffdd, 0xd4f2, 0x79c7, 0x6165, 0x4964, 0x48c2, 0x4061, 0x3841, 0x3040, 0x3020, 0x6185, 0xc3ec, 0xcbeb, 0xcbeb, 0xcbeb, 0xcbeb, 
-	0xc3ab, 0xbb6a, 0xab49, 0x8aa8, 0x5144, 0x4903, 0x4924, 0x40e3, 0x5124, 0x69a5, 0x7a26, 0x92c8, 0xa328, 0xab28, 0xab48, 0xb328, 
-	0xbb89, 0xc3aa, 0xc3ca, 0xcbca, 0xcbeb, 0xd40b, 0xd40b, 0xcc0b, 0xcc0b, 0xd42b, 0xd44c, 0xcc2b, 0xcc0b, 0xc3aa, 0xb369, 0xd42b, 
-	0xfffb, 0xff79, 0xfef7, 0xfe96, 0xfd73, 0xe4d0, 0xab4b, 0x8247, 0x71c6, 0x69a6, 0x69c7, 0x92a9, 0xdc90, 0xfe77, 0xfed8, 0xff3a, 
-	0xff7b, 0xff5b, 0xe514, 0x91e9, 0x6967, 0x4905, 0x40e3, 0x38a2, 0x69a6, 0xab6c, 0xb34a, 0xaac8, 0xbb4a, 0xc3cb, 0xcbcb, 0xcbea, 
-	0xc3aa, 0xb34a, 0x8a88, 0x3081, 0x1000, 0x2861, 0x3924, 0x4103, 0x4923, 0x69e5, 0x8a88, 0x92c8, 0x9ae8, 0xa349, 0xab29, 0xab28, 
-	0xb349, 0xbb8a, 0xbbaa, 0xc3aa, 0xc3ca, 0xcc0b, 0xcc2b, 0xcc0b, 0xcc0b, 0xd42b, 0xd44c, 0xcc2b, 0xc3ca, 0xc3aa, 0xb368, 0xb368, 
-	0xff38, 0xfeb7, 0xfe55, 0xfdb3, 0xe46f, 0xab4b, 0x7a27, 0x69e6, 0x5985, 0x61e7, 0x6207, 0x69e6, 0xab2a, 0xfe56, 0xfe97, 0xfed9, 
-	0xfed9, 0xfef9, 0xfeb8, 0xfdf5, 0x9268, 0x6144, 0x6985, 0x8227, 0xab09, 0xc369, 0xdc0c, 0xdc2d, 0xdc8e, 0xd44d, 0xd42c, 0xb34a, 
-	0x8246, 0x5103, 0x3040, 0x38a2, 0x2840, 0x38c2, 0x5165, 0x61e6, 0x61c5, 0x8267, 0x92c8, 0x9ae8, 0x9b08, 0xa328, 0xa329, 0xab28, 
-	0xab28, 0xbb89, 0xbbaa, 0xc3aa, 0xc3ca, 0xcbeb, 0xcc0b, 0xcc0b, 0xcc0b, 0xd42c, 0xd44c, 0xcc2b, 0xc3ea, 0xbb89, 0xbba9, 0x92e7, 
-	0xfe97, 0xfe14, 0xfdd4, 0xf511, 0xb3ab, 0x8a88, 0x7a07, 0x71e7, 0x69e7, 0x59e7, 0x59c6, 0x4903, 0x7a06, 0xfdf6, 0xfef8, 0xff19, 
-	0xfed9, 0xfe77, 0xfed8, 0xfed9, 0xfeb9, 0xf5d5, 0xe490, 0xcbed, 0xb329, 0x9a67, 0x9a67, 0x79e7, 0x6945, 0x58a3, 0x4861, 0x3800, 
-	0x4881, 0x7a27, 0xbc0d, 0xc44d, 0xab8b, 0x8ac9, 0x7247, 0x7247, 0x7a47, 0x8aa7, 0x92c8, 0x9ae8, 0x9b08, 0x9ae8, 0xa308, 0xab28, 
-	0xab28, 0xab49, 0xbb89, 0xbbaa, 0xc3ca, 0xcbeb, 0xcbec, 0xcc0c, 0xcc2c, 0xcc2b, 0xcc0b, 0xc3ca, 0xc3ea, 0xab48, 0xab69, 0x82a8, 
-	0xfe56, 0xfdf4, 0xfdb3, 0xe4d0, 0xb38b, 0x92a9, 0x8248, 0x7a28, 0x69c7, 0x61e7, 0x4944, 0x3082, 0x3020, 0x69a5, 0x9269, 0x81a6, 
-	0x8985, 0x8986, 0x89a7, 0x7105, 0x6905, 0x7125, 0x60c3, 0x5082, 0x48a3, 0x3861, 0x4062, 0x3821, 0x3840, 0x7a28, 0x8268, 0xab2b, 
-	0xb32a, 0xaac8, 0xd3ac, 0xd3eb, 0xc3ca, 0xb36a, 0x92e8, 0x7a67, 0x7205, 0x82a7, 0x92c8, 0x9b08, 0x9b08, 0xa308, 0xa328, 0xa328, 
-	0xa328, 0xab48, 0xb369, 0xbbaa, 0xc3eb, 0xcc0c, 0xcbec, 0xc3ec, 0xc40c, 0xc3ea, 0xbba9, 0xc3ca, 0xbbea, 0xab68, 0xa348, 0x932a, 
-	0xe5d4, 0xfdb4, 0xfdb3, 0xf532, 0xd44f, 0x9ac9, 0x9268, 0x92aa, 0x8269, 0x61e7, 0x5165, 0x4924, 0x5965, 0x71e7, 0x79c7, 0x79e7, 
-	0x8a29, 0x9acb, 0x79e8, 0x58a3, 0x5043, 0x4022, 0x3020, 0x3021, 0x3841, 0x48a2, 0x7186, 0xb32c, 0xbbad, 0x9ac9, 0x9a67, 0x9267, 
-	0x9a66, 0xb329, 0xcbcb, 0xcbcb, 0xc3aa, 0xbb8a, 0x9ae8, 0x8267, 0x7205, 0x7a46, 0x92e8, 0x9b08, 0xa329, 0xa328, 0xa328, 0xab49, 
-	0xab48, 0xab48, 0xb389, 0xbbaa, 0xc3eb, 0xcc0b, 0xc3eb, 0xcc0b, 0xc3ca, 0xbba9, 0xc3ea, 0xc40b, 0xbbca, 0xb389, 0xb3a9, 0xa3ab, 
-	0x5286, 0xfe36, 0xfdf4, 0xf572, 0xed11, 0xbbac, 0xb34b, 0xbbcd, 0x92ca, 0x7227, 0x61a6, 0x71e7, 0x7a49, 0x9228, 0xf4d2, 0xfe58, 
-	0xfd96, 0xf554, 0xfdd7, 0xe451, 0xb2ec, 0x9229, 0x7146, 0x81e8, 0x8a09, 0x9229, 0x89e7, 0x7986, 0x79a6, 0x79a6, 0x7984, 0x9246, 
-	0xaae8, 0xbbaa, 0xc3ca, 0xcbca, 0xc3cb, 0xbb8b, 0xab6b, 0x92c9, 0x7206, 0x7206, 0x8287, 0x92e8, 0xa308, 0xa328, 0xa329, 0xa328, 
-	0xab28, 0xab48, 0xb369, 0xbbca, 0xbbca, 0xc3ea, 0xc3eb, 0xc3ea, 0xbbca, 0xbba9, 0xc40b, 0xc40b, 0xbbaa, 0xbb88, 0xbb88, 0xa3aa, 
-	0x52e9, 0xeeda, 0xfe15, 0xfdb3, 0xf552, 0xdcb0, 0xdcb0, 0xdcd1, 0xab8d, 0x7a48, 0x69a5, 0x92aa, 0xab2c, 0xe44f, 0xfdb4, 0xfe16, 
-	0xfc90, 0xe3ce, 0xc32d, 0xa24a, 0x9a29, 0x89e8, 0x89e9, 0x7987, 0x6945, 0x6125, 0x50e3, 0x5104, 0x50c3, 0x6964, 0x8a67, 0xab29, 
-	0xbb6a, 0xbb89, 0xc3a9, 0xc3ca, 0xc3aa, 0xbbab, 0xab4a, 0x92c8, 0x8287, 0x7226, 0x8287, 0x8ac8, 0x9ae8, 0x9b08, 0xa308, 0xa328, 
-	0xab49, 0xb369, 0xb389, 0xbba9, 0xbbca, 0xbbca, 0xbba9, 0xbb89, 0xbbaa, 0xc3aa, 0xc3ca, 0xbbca, 0xbbea, 0xb368, 0xb368, 0x9b49, 
-	0xffff, 0xffff, 0xfefa, 0xfe36, 0xfdb3, 0xf532, 0xf532, 0xe4f1, 0xb3ac, 0x8268, 0x8aa9, 0xab4c, 0xe491, 0xec90, 0xfd72, 0xfe16, 
-	0xfd73, 0xcbad, 0x8186, 0x6946, 0x50e4, 0x48c3, 0x48e3, 0x4082, 0x3041, 0x3041, 0x3861, 0x40a2, 0x69a6, 0x7a06, 0x9aa8, 0xab29, 
-	0xb349, 0xbb69, 0xc3a9, 0xc3aa, 0xbbaa, 0xab49, 0x9b08, 0x92e8, 0x8aa8, 0x8287, 0x8287, 0x8aa7, 0x92c8, 0x92e8, 0x9b08, 0xa328, 
-	0xab49, 0xab69, 0xb3aa, 0xb3a9, 0xb3a9, 0xb3aa, 0xb3a9, 0xb369, 0xb389, 0xbbca, 0xbbaa, 0xb389, 0xb389, 0xa308, 0xb369, 0x7a47, 
-	0xffff, 0xffff, 0xffdf, 0xfe78, 0xfdf4, 0xfdd4, 0xf552, 0xdcd0, 0xbc0d, 0x82c9, 0x8288, 0xb38c, 0xecb0, 0xfdd3, 0xfe55, 0xfe14, 
-	0xfdb4, 0xf512, 0xab4b, 0x71c6, 0x6166, 0x4904, 0x4904, 0x40e3, 0x38c2, 0x40c3, 0x50e3, 0x6985, 0x8247, 0x9ac8, 0xb309, 0xb329, 
-	0xbb8a, 0xbb89, 0xc3ca, 0xc3eb, 0xbbab, 0xb38a, 0x9b29, 0x92e8, 0x8ac8, 0x92e9, 0x8aa7, 0x8aa7, 0x8ac8, 0x8ac8, 0x9b09, 0x9b28, 
-	0xa329, 0xab49, 0xab48, 0xab69, 0xab89, 0xab69, 0xab69, 0xb389, 0xb3aa, 0xb3aa, 0xb3a9, 0xa347, 0xab28, 0xa2e8, 0xa2c8, 0x40e2, 
-	0xffff, 0xffff, 0xffff, 0xff3c, 0xfdf6, 0xfdd4, 0xfdb3, 0xdcf0, 0xbbed, 0x8ae9, 0x8aea, 0xd46f, 0xfe55, 0xfe96, 0xfe75, 0xfe75, 
-	0xfdf4, 0xfd53, 0xf4d1, 0xbb4c, 0x79e7, 0x7186, 0x6966, 0x6185, 0x69c6, 0x8a88, 0xa30a, 0xa309, 0xab09, 0xab29, 0xc38a, 0xcbec, 
-	0xcc0c, 0xd42c, 0xcc2c, 0xb3cb, 0xa329, 0x9b09, 0x9309, 0x92e8, 0x8ac8, 0x8aa7, 0x82a7, 0x8ac7, 0x8ac8, 0x8aa7, 0x8ac8, 0x92c8, 
-	0x9b08, 0x9b28, 0xa349, 0xa309, 0x9ae8, 0x9ae8, 0xa328, 0xa328, 0xa349, 0xa349, 0xab69, 0xa328, 0xa328, 0xa307, 0x7a05, 0x49a7, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xfe78, 0xfe15, 0xfdd4, 0xdd10, 0xb3ec, 0x932a, 0x9b2a, 0xdcaf, 0xfdb2, 0xfe54, 0xfe96, 0xfe96, 
-	0xfe76, 0xfe35, 0xfdd5, 0xf595, 0xf638, 0xf638, 0xe553, 0xdc50, 0xd42f, 0xcc4e, 0xdc6e, 0xd46e, 0xd44d, 0xd44d, 0xdc6e, 0xe4ae, 
-	0xdc6d, 0xdc8d, 0xcc2c, 0xab6a, 0xa34a, 0x9b29, 0x9329, 0x92e8, 0x8ac7, 0x82a7, 0x8287, 0x7a87, 0x82a7, 0x82a7, 0x82a7, 0x82a7, 
-	0x8266, 0x8246, 0x8aa7, 0x8ac8, 0x8ac7, 0x8a87, 0x92a7, 0x92a7, 0x8aa7, 0x9b08, 0x92e7, 0x9ae8, 0xa308, 0x9287, 0x3881, 0xa4b3, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffbe, 0xfe16, 0xf5b4, 0xdcf0, 0xb42d, 0xabed, 0xb40d, 0xd4af, 0xf572, 0xfe14, 0xfe96, 0xff59, 
-	0xffba, 0xff9a, 0xffdc, 0xffde, 0xffff, 0xfffe, 0xff7b, 0xfeb8, 0xf572, 0xeccf, 0xdc8e, 0xdc6d, 0xdc8e, 0xdcae, 0xdc8e, 0xdc8e, 
-	0xd46d, 0xcc2c, 0xc40c, 0xb3aa, 0xb3ab, 0x9b49, 0x8ac8, 0x82a7, 0x7a87, 0x8287, 0x82c8, 0x7aa7, 0x7a87, 0x7a67, 0x6a05, 0x7225, 
-	0x7225, 0x7205, 0x7226, 0x7a67, 0x7a67, 0x7225, 0x7a66, 0x7a66, 0x7a65, 0x8a86, 0x8a86, 0x92c8, 0x9ae8, 0x5943, 0x1000, 0xdebb, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf73b, 0xe5b4, 0xe532, 0xc490, 0xbc4f, 0xbc6f, 0xdd11, 0xfdd4, 0xfdd5, 0xfeb7, 0xff9a, 
-	0xffbb, 0xfffb, 0xfffd, 0xfffd, 0xffdd, 0xff39, 0xfe56, 0xfdd4, 0xfdd4, 0xfd72, 0xe4f0, 0xd46e, 0xc3ec, 0xbbcb, 0xbbeb, 0xbbec, 
-	0xb3cb, 0xb3ab, 0xabab, 0xa34a, 0x9b29, 0x92e8, 0x82c8, 0x7247, 0x7247, 0x6a26, 0x6a46, 0x6a46, 0x6a26, 0x61c5, 0x6a05, 0x6a05, 
-	0x69e5, 0x61a4, 0x69e5, 0x6a05, 0x6a26, 0x6a05, 0x6a05, 0x6a04, 0x7225, 0x7a86, 0x8286, 0x92c8, 0x7a26, 0x2020, 0x3966, 0xffbf, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe658, 0xe573, 0xccd1, 0xccd1, 0xccb0, 0xcc8f, 0xdd31, 0xfe56, 0xfed8, 0xfef8, 
-	0xff18, 0xff9a, 0xff7a, 0xfef9, 0xfe56, 0xfdb4, 0xf511, 0xed11, 0xed32, 0xc3ed, 0xb38b, 0xa36a, 0xa34a, 0xab8b, 0xab8b, 0xa38b, 
-	0xa36a, 0x9329, 0x8ac8, 0x7a46, 0x82a8, 0x8ae9, 0x6a46, 0x59c5, 0x4964, 0x4943, 0x5184, 0x59a4, 0x59a4, 0x59c4, 0x5184, 0x59c5, 
-	0x5184, 0x5163, 0x59a4, 0x61e5, 0x61e5, 0x59a4, 0x5983, 0x5983, 0x6a04, 0x7a45, 0x82a6, 0x8a87, 0x48e2, 0x3924, 0xe6fc, 0xe77e, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd5f6, 0xc4b0, 0xc46f, 0xbc2e, 0xccd0, 0xe552, 0xf5d4, 0xfe55, 0xfe76, 
-	0xfeb7, 0xfe56, 0xfe36, 0xf594, 0xed32, 0xbbee, 0xb38d, 0x9aeb, 0x8aea, 0x82a8, 0x7247, 0x7a67, 0x7a68, 0x8288, 0x7a88, 0x7247, 
-	0x7226, 0x61c4, 0x61e5, 0x5183, 0x59a4, 0x6226, 0x5184, 0x4163, 0x4123, 0x4943, 0x4943, 0x4963, 0x59c5, 0x5184, 0x5184, 0x4984, 
-	0x4963, 0x51a4, 0x59a4, 0x51a4, 0x51a4, 0x4942, 0x4962, 0x59a3, 0x61e4, 0x7a86, 0x82a7, 0x71c5, 0x2820, 0xd67a, 0xef9e, 0x6370, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xc574, 0xc4d1, 0xb40e, 0xb40d, 0xbc4e, 0xbc4e, 0xccd0, 0xf5f5, 
-	0xdd52, 0xcc8f, 0xcc90, 0xa3ac, 0x82c9, 0x7228, 0x5166, 0x59a6, 0x4985, 0x4164, 0x4964, 0x5185, 0x4944, 0x5165, 0x4123, 0x4944, 
-	0x4143, 0x3902, 0x49a5, 0x4143, 0x51c5, 0x4984, 0x3902, 0x4123, 0x3923, 0x4164, 0x4964, 0x4143, 0x4963, 0x4963, 0x4963, 0x4123, 
-	0x4142, 0x4163, 0x4963, 0x4984, 0x3902, 0x3902, 0x4102, 0x4942, 0x59c3, 0x7a86, 0x7205, 0x48c2, 0xa472, 0xef9f, 0xc67b, 0x0046, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcdd6, 0xb46f, 0x9b8c, 0x938c, 0xa3cd, 0xb44e, 0xac0e, 
-	0x9b6c, 0x8b2a, 0x82ea, 0x7268, 0x51c6, 0x4165, 0x3904, 0x30e4, 0x3124, 0x2081, 0x28a2, 0x2081, 0x2061, 0x1820, 0x2061, 0x2882, 
-	0x28a2, 0x28a2, 0x2081, 0x2081, 0x28c2, 0x30c2, 0x30c2, 0x3903, 0x3903, 0x3923, 0x3923, 0x4123, 0x4144, 0x3923, 0x3923, 0x30e2, 
-	0x3922, 0x3101, 0x3102, 0x28a1, 0x2060, 0x28a0, 0x30c1, 0x4942, 0x6a04, 0x7225, 0x5143, 0x7aeb, 0xef7e, 0xe75e, 0x2989, 0x08e9, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd5f7, 0xac50, 0x8b8c, 0x8b4b, 0x936c, 0x8b4b, 
-	0x7aea, 0x51a5, 0x51c6, 0x4985, 0x3903, 0x30e3, 0x28a2, 0x28a2, 0x20a2, 0x18a2, 0x1881, 0x1040, 0x1020, 0x0800, 0x1000, 0x1020, 
-	0x1020, 0x1840, 0x1840, 0x2061, 0x28a1, 0x28c2, 0x30e2, 0x30e2, 0x30e2, 0x3923, 0x3923, 0x3903, 0x30c2, 0x30a1, 0x28a1, 0x28a1, 
-	0x28a1, 0x2040, 0x1820, 0x0800, 0x1000, 0x2060, 0x4122, 0x61e5, 0x69e4, 0x6163, 0x40a1, 0xe6ba, 0xef9f, 0x6b50, 0x0046, 0x8cd7, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd658, 0x9c0f, 0x9bcd, 0x9bad, 0x6a28, 
-	0x51a6, 0x4165, 0x28c3, 0x20a2, 0x2082, 0x2082, 0x2081, 0x1881, 0x1841, 0x1020, 0x1020, 0x0800, 0x0800, 0x0820, 0x0800, 0x0800, 
-	0x0800, 0x1020, 0x1861, 0x1861, 0x28c2, 0x28c2, 0x28c2, 0x28a1, 0x30e2, 0x28a1, 0x2081, 0x2081, 0x28a1, 0x2060, 0x2060, 0x1880, 
-	0x1840, 0x1000, 0x0800, 0x0800, 0x2081, 0x4143, 0x5184, 0x61c4, 0x6183, 0x48a1, 0x4904, 0xefbe, 0xdedd, 0x0045, 0x29ec, 0xe75e, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5c, 0x9c2f, 0x8b2b, 0x830a, 
-	0x5a27, 0x3944, 0x20c2, 0x20c2, 0x20a2, 0x1882, 0x1861, 0x1041, 0x1021, 0x0800, 0x1000, 0x0800, 0x1020, 0x1020, 0x0820, 0x1020, 
-	0x1020, 0x1020, 0x1841, 0x1861, 0x20a2, 0x2081, 0x1860, 0x1840, 0x1861, 0x1020, 0x1020, 0x1020, 0x1840, 0x1000, 0x0800, 0x0000, 
-	0x0800, 0x0800, 0x1020, 0x20a1, 0x4143, 0x5184, 0x5963, 0x5122, 0x48c1, 0x3882, 0xc596, 0xefdf, 0x5acd, 0x00a8, 0xbe7c, 0xe73d, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf75d, 0x9c0f, 0x72c9, 
-	0x6aa9, 0x5227, 0x41a5, 0x3143, 0x3124, 0x2904, 0x20c3, 0x20a2, 0x1862, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1040, 
-	0x1041, 0x1020, 0x1041, 0x1020, 0x1020, 0x1020, 0x1000, 0x1020, 0x1020, 0x0820, 0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 
-	0x0800, 0x2060, 0x28a1, 0x3923, 0x4123, 0x4922, 0x48e1, 0x48c1, 0x48c3, 0xc5b7, 0xefbf, 0xd6dc, 0x0025, 0x6bf4, 0xef7e, 0xd6dd, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xa491, 
-	0x6289, 0x5206, 0x4185, 0x4185, 0x3124, 0x20e3, 0x20c3, 0x20a3, 0x2082, 0x2082, 0x1861, 0x1841, 0x1841, 0x1841, 0x1020, 0x0800, 
-	0x1000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 
-	0x2081, 0x28a1, 0x30e0, 0x3922, 0x3901, 0x4901, 0x5902, 0x50c2, 0xb4f3, 0xefbf, 0xef9f, 0x31aa, 0x112a, 0xdf3e, 0xe73d, 0xd6bc
-};
-
-// 'dracon', 64x64px
-const uint16_t epd_bitmap_dracon [] PROGMEM = {
-	0xbccd, 0xbccd, 0xbced, 0xbcec, 0xbcec, 0xbced, 0xbced, 0xbd0d, 0xbced, 0xbd0d, 0xc50d, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 
-	0xc52d, 0xc54e, 0xc52d, 0xc52d, 0xc52d, 0xc54e, 0xc54e, 0xc54e, 0xc54e, 0xc54e, 0xc54e, 0xc54e, 0xc54e, 0xc54e, 0xc54d, 0xc52d, 
-	0xc54d, 0xc54d, 0xc52d, 0xc54d, 0xcd8f, 0xcd6f, 0xc52e, 0xcd8f, 0xcd8e, 0xcd8e, 0xcd8e, 0xd58f, 0xd5af, 0xde11, 0xe673, 0xd5af, 
-	0xde10, 0xffba, 0xcd8e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd5ae, 0xd5ae, 
-	0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbd0d, 0xbd0d, 0xbd0d, 0xbd0d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 
-	0xc52d, 0xc52d, 0xc52d, 0xc52d, 0xc54e, 0xc54e, 0xc54e, 0xcd6e, 0xcd6e, 0xcd4e, 0xcd4e, 0xcd4e, 0xcd4e, 0xcd6e, 0xc54e, 0xc54e, 
-	0xc52d, 0xc54d, 0xc52d, 0xcd6e, 0xcd6f, 0xcd6f, 0xcd8f, 0xcd8e, 0xcd8e, 0xcd8e, 0xcd8e, 0xcd8f, 0xd5af, 0xde11, 0xe652, 0xcd6e, 
-	0xd5f1, 0xff78, 0xcd8e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd8e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd4e, 0xcd6e, 0xd5ce, 0xd5ae, 
-	0xbcec, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbd0d, 0xbd0d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xc54e, 
-	0xc52d, 0xc54e, 0xc54e, 0xc54d, 0xc54e, 0xc54e, 0xcd4e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd4e, 0xcd6e, 
-	0xcd4d, 0xc54d, 0xc54d, 0xcd6e, 0xcd8f, 0xc54f, 0xd5d0, 0xcd8f, 0xcd8e, 0xcd8e, 0xcd8e, 0xcd8f, 0xd5af, 0xddf0, 0xde31, 0xc54d, 
-	0xddd0, 0xd631, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd8e, 0xcd8e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58f, 0xd5ce, 0xd5ce, 
-	0xbcec, 0xbccc, 0xbccc, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xc52e, 
-	0xc52e, 0xcd4e, 0xc54e, 0xc54e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 
-	0xc54d, 0xc54e, 0xcd4e, 0xcd6e, 0xcd8f, 0xc54f, 0xcd8f, 0xcd6e, 0xcd6e, 0xcd8e, 0xcd8e, 0xcd8e, 0xd58f, 0xddf0, 0xde31, 0xcd4d, 
-	0xd610, 0xe694, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58f, 0xcd8e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd5ae, 0xd5ce, 0xd5ce, 
-	0xbccc, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52e, 0xc54e, 0xc54e, 
-	0xc54e, 0xcd4e, 0xcd4e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58e, 0xd56e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 
-	0xcd4e, 0xcd4e, 0xcd6e, 0xcd6e, 0xcd8f, 0xcd6f, 0xcd4e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd8e, 0xd58e, 0xddf0, 0xe652, 0xc54d, 
-	0xde72, 0xde73, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd5cf, 0xd5ce, 0xd5ae, 
-	0xbccc, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52e, 0xc52d, 0xcd4e, 
-	0xcd4e, 0xcd4e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd56e, 0xd58f, 0xd58f, 0xd58e, 0xd58e, 0xd58f, 0xd58e, 0xd5ae, 0xd58e, 0xd56e, 0xcd6e, 
-	0xcd6e, 0xcd6e, 0xcd6e, 0xcd8f, 0xd5af, 0xcd6f, 0xeeb3, 0xd56e, 0xd56e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58e, 0xddf0, 0xeeb3, 0xc54d, 
-	0xe692, 0xd5f1, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd8e, 0xd58e, 0xcd8e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xddcf, 0xd5ce, 0xd5ce, 
-	0xbced, 0xbced, 0xbced, 0xbced, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xc54d, 0xcd4d, 
-	0xcd4d, 0xcd6e, 0xcd6e, 0xcd6e, 0xd56e, 0xd58e, 0xd58e, 0xd5af, 0xddef, 0xf6f3, 0xff34, 0xee91, 0xe62f, 0xddac, 0xcd2b, 0xa3e8, 
-	0xcd4e, 0xd56e, 0xcd6e, 0xd58f, 0xd5af, 0xcd6e, 0xeed4, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58e, 0xd5ef, 0xeeb3, 0xcd6d, 
-	0xeeb4, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6d, 0xcd6e, 0xcd8e, 0xddcf, 0xd5ce, 0xd5ae, 
-	0xbcec, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbcec, 0xbcec, 0xbcec, 0xbd0d, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xcd4d, 0xcd4e, 
-	0xcd6e, 0xcd6e, 0xd56e, 0xd56e, 0xd58f, 0xd5cf, 0xde30, 0xff13, 0xf713, 0xf713, 0xeed2, 0xf6d1, 0xee2e, 0xd54b, 0xbc27, 0xa3c7, 
-	0x9b66, 0x9325, 0xc50c, 0xd5af, 0xd5af, 0xcd8e, 0xf6d4, 0xd58e, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xd58e, 0xd5cf, 0xee72, 0xcd8e, 
-	0xf715, 0xcd8e, 0xcd8e, 0xcd6e, 0xcd6e, 0xd58e, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd58e, 0xddce, 0xddce, 0xddce, 
-	0xbcec, 0xbcec, 0xbcec, 0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xbd0d, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xcd2d, 0xcd4e, 
-	0xcd6e, 0xcd6e, 0xd58e, 0xd5af, 0xde10, 0xff34, 0xff34, 0xf734, 0xf713, 0xf6d2, 0xf6f2, 0xf6f2, 0xddcc, 0xd52a, 0xd50b, 0xabe7, 
-	0xa387, 0xa3a7, 0xac08, 0xddaf, 0xd5cf, 0xd58e, 0xeeb4, 0xd5ae, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xd58e, 0xd5cf, 0xddf0, 0xd58e, 
-	0xeef6, 0xd5af, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6e, 0xd5ae, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6e, 0xcd6d, 0xd58e, 0xddce, 0xd5ce, 0xddce, 
-	0xbcec, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbced, 0xbd0d, 0xbced, 0xbd0d, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xcd4e, 0xcd4e, 
-	0xd56e, 0xd58f, 0xddcf, 0xf6d2, 0xf6f2, 0xf734, 0xf734, 0xff34, 0xf712, 0xf712, 0xf712, 0xeeb1, 0xe60d, 0xd52a, 0xc4c9, 0xbc69, 
-	0xb409, 0x9b66, 0xa3a7, 0xc50c, 0xd5cf, 0xd58e, 0xe652, 0xddae, 0xd5ae, 0xd5ae, 0xd58e, 0xcd6e, 0xd58e, 0xd5cf, 0xddf0, 0xcd6d, 
-	0xeeb3, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xd58e, 0xd58e, 0xd58e, 0xd58e, 0xcd6e, 0xcd6e, 0xcd6d, 0xddcf, 0xd5ce, 0xd5ae, 0xd5ae, 
-	0xbcec, 0xbcec, 0xbccc, 0xbced, 0xbccc, 0xbcec, 0xbcec, 0xbcec, 0xbd0d, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xcd2d, 0xcd4e, 0xcd4e, 
-	0xd58f, 0xddef, 0xff34, 0xf713, 0xf714, 0xff55, 0xf713, 0xf6f2, 0xf6f1, 0xeed1, 0xf712, 0xee90, 0xe60d, 0xd54a, 0xccc9, 0xbc68, 
-	0xb408, 0xabe8, 0xabe8, 0xbcaa, 0xddcf, 0xd58e, 0xde11, 0xd5ae, 0xd5ae, 0xd5ae, 0xd58e, 0xd58e, 0xd5ae, 0xddcf, 0xd5cf, 0xd58d, 
-	0xde11, 0xd58e, 0xd58e, 0xd56e, 0xd58e, 0xd58e, 0xd5ae, 0xd58e, 0xd56e, 0xcd6d, 0xcd6d, 0xcd6e, 0xd5ce, 0xd5ce, 0xd5ae, 0xd5ae, 
-	0xbced, 0xbced, 0xbcec, 0xbcec, 0xbcec, 0xbcec, 0xbced, 0xbced, 0xc4ed, 0xc50d, 0xc50d, 0xc50d, 0xc52d, 0xcd4e, 0xcd6e, 0xd56e, 
-	0xe610, 0xf6f3, 0xf734, 0xf713, 0xf713, 0xeeb1, 0xf6d1, 0xf713, 0xf713, 0xf733, 0xf712, 0xf6d1, 0xe62e, 0xd56b, 0xcce9, 0xbc48, 
-	0xbc49, 0xa386, 0xabc7, 0xb448, 0xcd4d, 0xd56e, 0xde11, 0xddaf, 0xddae, 0xddae, 0xd58e, 0xd58e, 0xddaf, 0xddf0, 0xd5ae, 0xde10, 
-	0xddf0, 0xd58e, 0xd56e, 0xd58e, 0xd58e, 0xd58e, 0xd5ae, 0xd58e, 0xd56e, 0xd56e, 0xd56d, 0xd56e, 0xddce, 0xddae, 0xddae, 0xd5ae, 
-	0xbced, 0xbced, 0xbccc, 0xbcec, 0xbcec, 0xbcec, 0xbced, 0xbced, 0xc4ed, 0xc50d, 0xc50d, 0xc52d, 0xc52d, 0xcd4d, 0xcd4e, 0xddef, 
-	0xee70, 0xf6d1, 0xf733, 0xf713, 0xf733, 0xeeb1, 0xff13, 0xf713, 0xf6f2, 0xeef2, 0xf6f1, 0xee6f, 0xe5ed, 0xc4e9, 0xbc47, 0xbc28, 
-	0xabe7, 0x9b46, 0xabe8, 0xb428, 0xb469, 0xcd6d, 0xddf0, 0xddce, 0xddae, 0xddae, 0xddae, 0xddae, 0xddcf, 0xe651, 0xd5ae, 0xeeb3, 
-	0xddf0, 0xd58e, 0xd58e, 0xd58e, 0xd58e, 0xd5ae, 0xd5ae, 0xd58e, 0xd56e, 0xd56e, 0xd56d, 0xd58d, 0xddce, 0xddae, 0xd5ae, 0xddce, 
-	0xbced, 0xbcec, 0xbccc, 0xbcec, 0xbcec, 0xbcec, 0xbced, 0xbced, 0xc4ed, 0xc50d, 0xc50d, 0xc52d, 0xcd4d, 0xcd6d, 0xd58e, 0xf6d2, 
-	0xeeb1, 0xff33, 0xf6f3, 0xf6f2, 0xf733, 0xff34, 0xf6f2, 0xeed1, 0xf6f2, 0xeeb0, 0xe62e, 0xe62e, 0xee2e, 0xdd8b, 0xdd4c, 0xc489, 
-	0xbc49, 0x9b25, 0xa366, 0xabe7, 0xabe7, 0xcd2c, 0xddf0, 0xddce, 0xddce, 0xddae, 0xddce, 0xddce, 0xe5ef, 0xe672, 0xd5ae, 0xf715, 
-	0xddef, 0xd5ae, 0xd58e, 0xd58e, 0xd58e, 0xd5ae, 0xd5ae, 0xd58e, 0xd56e, 0xcd6d, 0xd56d, 0xd58d, 0xddce, 0xddce, 0xddae, 0xddce, 
-	0xc4ec, 0xbcec, 0xbcec, 0xbcec, 0xbccc, 0xbccd, 0xbcec, 0xbcec, 0xbcec, 0xc50d, 0xc50d, 0xc52d, 0xcd2d, 0xcd6e, 0xf6d3, 0xf713, 
-	0xf6d2, 0xf713, 0xf713, 0xf713, 0xff54, 0xf713, 0xeed1, 0xf713, 0xeeb1, 0xe650, 0xe671, 0xe60f, 0xb46a, 0x7ac5, 0x6224, 0x61e4, 
-	0x7285, 0x8b28, 0x9327, 0xa3a7, 0xb407, 0xc4ca, 0xddae, 0xddce, 0xddce, 0xddce, 0xddce, 0xddef, 0xe60f, 0xee92, 0xd5ad, 0xf736, 
-	0xddcf, 0xddae, 0xdd8e, 0xd58e, 0xd58e, 0xddae, 0xd5ae, 0xd58e, 0xd56d, 0xd56d, 0xd56d, 0xd58e, 0xddae, 0xddae, 0xddae, 0xddae, 
-	0xc50c, 0xbcec, 0xbccc, 0xbcec, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbcec, 0xc4ed, 0xc50d, 0xc52d, 0xcd4d, 0xd58e, 0xf713, 0xeed2, 
-	0xf6d2, 0xf713, 0xff55, 0xef13, 0xf712, 0xeeb1, 0xf6f3, 0xcdae, 0x8b87, 0x7285, 0x6a45, 0x51a3, 0x4963, 0x4143, 0x3923, 0x3122, 
-	0x2901, 0x2901, 0x2903, 0x30c1, 0x5a04, 0xb40a, 0xc4ca, 0xddee, 0xddef, 0xddee, 0xddee, 0xddef, 0xe630, 0xeed3, 0xd5ce, 0xf736, 
-	0xddcf, 0xddce, 0xddae, 0xd5ae, 0xddae, 0xddae, 0xd58e, 0xd58e, 0xd56d, 0xd56d, 0xd56d, 0xddae, 0xddae, 0xddad, 0xddae, 0xddae, 
-	0xc50c, 0xbcec, 0xbced, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbcec, 0xbcec, 0xbcec, 0xc50d, 0xc50c, 0xcd4d, 0xddef, 0xeed2, 0xeed2, 
-	0xf733, 0xf6f2, 0xff54, 0xf714, 0xd5d0, 0x9327, 0x82c6, 0x6a25, 0x6205, 0x6205, 0x59c4, 0x5182, 0x4941, 0x38e0, 0x3901, 0x3901, 
-	0x4102, 0x4123, 0x4963, 0x4983, 0x4141, 0x4982, 0x7223, 0xddce, 0xddee, 0xddce, 0xddef, 0xe60f, 0xe630, 0xf6f4, 0xddef, 0xf757, 
-	0xddef, 0xddce, 0xddae, 0xddae, 0xd5ae, 0xddae, 0xdd8e, 0xd56d, 0xd56d, 0xd56d, 0xd54d, 0xddae, 0xddae, 0xddad, 0xddae, 0xddce, 
-	0xc50d, 0xbcec, 0xbcec, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbcec, 0xc4ed, 0xc50d, 0xcd2d, 0xe651, 0xf713, 0xf6f2, 
-	0xf713, 0xff33, 0xd5af, 0x9b67, 0x82e5, 0x8306, 0x8b06, 0xc4cd, 0xcd0d, 0xa3c7, 0xc4ab, 0xa366, 0x9b26, 0x9b26, 0x9b06, 0x9306, 
-	0x8ac5, 0x9307, 0x9b27, 0x9b26, 0x9b26, 0x9306, 0x9326, 0xa366, 0x9b25, 0x9b46, 0xa366, 0xabc7, 0x9b66, 0xbcab, 0xcd4d, 0xeed5, 
-	0xddcf, 0xddae, 0xddae, 0xd5ae, 0xd5ae, 0xddae, 0xd58e, 0xd56e, 0xd56d, 0xd54d, 0xd56d, 0xddae, 0xddae, 0xd5ae, 0xddae, 0xddce, 
-	0xc50d, 0xc50c, 0xbcec, 0xbccc, 0xbccc, 0xbccc, 0xbcac, 0xbccc, 0xbccc, 0xbcec, 0xbccc, 0xc4ec, 0xc4ec, 0xf6b2, 0xeef2, 0xf712, 
-	0xeef2, 0xd5cf, 0xc4cb, 0xb42a, 0xbc8a, 0xa3a7, 0xb3c8, 0xaba7, 0xab66, 0x9b06, 0x9b07, 0xa327, 0xa327, 0x9b07, 0x9b27, 0x9b06, 
-	0x9b06, 0x92c5, 0x9b06, 0x92a5, 0x92c5, 0x9ae5, 0x9b26, 0x9b26, 0x92c5, 0x9b06, 0x9b06, 0x9b26, 0xa346, 0xa346, 0xa346, 0xaba8, 
-	0xab87, 0xb3e8, 0xac08, 0xd54c, 0xddae, 0xd58e, 0xd56d, 0xd56d, 0xd54d, 0xd56d, 0xd56d, 0xddae, 0xd58d, 0xddae, 0xddae, 0xddae, 
-	0xc52d, 0xc50d, 0xbcec, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbccc, 0xbcec, 0xcd2c, 0xee91, 0xc4cb, 0xb429, 
-	0xb3e8, 0xb3c8, 0xab87, 0xa366, 0xa347, 0xa306, 0xa347, 0xa327, 0x9b27, 0x9ae5, 0xa307, 0x9ae6, 0x9ae6, 0x9ac6, 0x92a5, 0x92c6, 
-	0x92c6, 0x8a85, 0x8a65, 0x92c6, 0x8265, 0x8a85, 0x8aa4, 0x92c5, 0x8a64, 0x92a5, 0x9b06, 0x92c5, 0x92a5, 0x9b26, 0xa347, 0xa346, 
-	0xa346, 0xaba7, 0xab66, 0xb3c7, 0xb408, 0xbc89, 0xd56d, 0xd56d, 0xd54d, 0xd56d, 0xd56d, 0xddae, 0xdd8d, 0xdd8d, 0xddae, 0xddce, 
-	0xcd4d, 0xc50d, 0xc4ec, 0xbcec, 0xbcac, 0xbccc, 0xbccc, 0xbccc, 0xb4ec, 0xcd6e, 0xe610, 0xb44a, 0xa3c8, 0xaba8, 0xab87, 0x9b05, 
-	0x9b06, 0xa346, 0xa326, 0x9b06, 0x9b06, 0xa327, 0x9ae6, 0x9b06, 0x9ae6, 0x92c6, 0x8aa5, 0x8aa6, 0x8a85, 0x8a85, 0x8a85, 0x8aa5, 
-	0x8285, 0x7a44, 0x8265, 0x8aa5, 0x8244, 0x8a85, 0x8a85, 0x8aa5, 0x92c5, 0x8a84, 0x8a84, 0x92a5, 0x92c6, 0x8a84, 0x92e5, 0x9b26, 
-	0xa326, 0xab67, 0xa346, 0x9b25, 0xa346, 0xb3e8, 0xabc7, 0xd54d, 0xd54d, 0xd54d, 0xddae, 0xddae, 0xdd8d, 0xddad, 0xddae, 0xddce, 
-	0xd56e, 0xcd4d, 0xc50c, 0xbcec, 0xbccc, 0xbccc, 0xbcec, 0xe631, 0xc52d, 0xac29, 0xa3a8, 0xa367, 0x92c5, 0x92e5, 0x9b06, 0xa367, 
-	0x9b26, 0xa346, 0x9b06, 0x9ae6, 0x92c6, 0x8a85, 0x8265, 0x8aa6, 0x8265, 0x8265, 0x8265, 0x7a45, 0x7225, 0x7245, 0x69e4, 0x5983, 
-	0x4901, 0x5162, 0x5121, 0x5982, 0x61c3, 0x7204, 0x82a6, 0x7a44, 0x8aa5, 0x7a43, 0x8264, 0x8264, 0x8a85, 0x92e6, 0x9b06, 0x92c5, 
-	0xa347, 0xa326, 0xa326, 0xa366, 0xab67, 0xb3a7, 0xc48a, 0xd54c, 0xd54c, 0xd54c, 0xdd8d, 0xdd8d, 0xdd8d, 0xdd8d, 0xddae, 0xddae, 
-	0xd58e, 0xcd4e, 0xcd2d, 0xc4ec, 0xbccc, 0xee72, 0xe651, 0x9bc7, 0xdd8e, 0xa3a8, 0x8aa5, 0x9306, 0x92c5, 0x92e5, 0x9b06, 0xab88, 
-	0x92c5, 0x92e6, 0x92c5, 0x92c5, 0x8245, 0x7a25, 0x7204, 0x69e4, 0x4921, 0x4102, 0x4102, 0x4902, 0x4922, 0x4922, 0x4943, 0x4943, 
-	0x4923, 0x4942, 0x4943, 0x5163, 0x5162, 0x4922, 0x38e1, 0x30a0, 0x59c3, 0x61a2, 0x7203, 0x8ac5, 0x92e6, 0x8aa5, 0x92a5, 0x8a64, 
-	0x92e5, 0x9b05, 0x9b05, 0xa325, 0x9b05, 0xb408, 0xd50c, 0xd54c, 0xd54c, 0xd54c, 0xddae, 0xdd8d, 0xdd8d, 0xdd8d, 0xddad, 0xddce, 
-	0xddaf, 0xd58e, 0xd56e, 0xcd4d, 0xf6d3, 0xcd8d, 0xddef, 0x9346, 0x82a5, 0x92e6, 0x92e6, 0xa367, 0x9b26, 0x9ae6, 0xa327, 0x92c6, 
-	0x8a85, 0x8a65, 0x8245, 0x7225, 0x5983, 0x4902, 0x4122, 0x4943, 0x5163, 0x5163, 0x5163, 0x5143, 0x5143, 0x5163, 0x5163, 0x5163, 
-	0x5163, 0x5163, 0x5983, 0x5983, 0x61a3, 0x69e4, 0x61c4, 0x4142, 0x2081, 0x2081, 0x51a3, 0x69e3, 0x8264, 0x8a85, 0x8a84, 0x8243, 
-	0x8aa4, 0x92c4, 0xab66, 0xab66, 0xbbe7, 0xd52b, 0xd54c, 0xd54c, 0xd54c, 0xd54c, 0xddad, 0xddae, 0xdd8d, 0xddad, 0xddae, 0xddae, 
-	0xe5f0, 0xddcf, 0xddaf, 0xe650, 0xe650, 0xb429, 0x9326, 0x9b67, 0x9306, 0x9b27, 0x9b26, 0x92e6, 0x92c5, 0x9ae6, 0x92c6, 0x8285, 
-	0x7a65, 0x6a05, 0x38c1, 0x38e1, 0x4943, 0x5164, 0x5984, 0x59a4, 0x59a4, 0x61a4, 0x5983, 0x5963, 0x5163, 0x5963, 0x5984, 0x5983, 
-	0x5163, 0x5983, 0x59a3, 0x61a3, 0x61a3, 0x71e4, 0x6a04, 0x69c3, 0x3901, 0x20a1, 0x1860, 0x5183, 0x61a2, 0x7a23, 0x8aa5, 0x92c6, 
-	0x8aa4, 0xa326, 0xa366, 0xbc29, 0xb449, 0xdd6c, 0xd54c, 0xd54c, 0xd56c, 0xd56c, 0xddad, 0xddad, 0xddad, 0xddad, 0xddad, 0xddce, 
-	0xe610, 0xde10, 0xe671, 0xf691, 0x8b24, 0xd52d, 0x8283, 0x9b27, 0x8a84, 0x9b26, 0x9b06, 0x8a84, 0x8a85, 0x8a85, 0x7a24, 0x61e3, 
-	0x30e1, 0x1040, 0x30c2, 0x4943, 0x5184, 0x59a4, 0x61c5, 0x61c5, 0x61c5, 0x69e5, 0x61a4, 0x61a4, 0x59a4, 0x5983, 0x59a4, 0x5983, 
-	0x5963, 0x5983, 0x5983, 0x61a3, 0x69c4, 0x7204, 0x7225, 0x7a45, 0x7245, 0x2080, 0x1040, 0x28c1, 0x5982, 0x82a5, 0x8a85, 0x92e6, 
-	0x9ae5, 0xab86, 0xb3c7, 0xbcab, 0xff57, 0xeeb2, 0xdd8b, 0xdd4c, 0xdd6c, 0xdd8c, 0xddad, 0xddad, 0xddad, 0xddad, 0xddcd, 0xddae, 
-	0xe630, 0xee91, 0xf6b2, 0xc4ea, 0xe5d0, 0xa3a7, 0xbc2a, 0xaba8, 0x92e5, 0xa347, 0x9b06, 0x92e6, 0x7a24, 0x7204, 0x5183, 0x2080, 
-	0x0821, 0x1861, 0x3902, 0x5184, 0x59c5, 0x61c5, 0x61c5, 0x69e5, 0x69e5, 0x69e5, 0x61c4, 0x61a4, 0x5983, 0x5983, 0x5983, 0x5983, 
-	0x5983, 0x5963, 0x5983, 0x61a3, 0x69c4, 0x7a25, 0x7a65, 0x8265, 0x8ae7, 0x4142, 0x20a1, 0x3102, 0x3922, 0x6a04, 0x8264, 0x8284, 
-	0x9b47, 0xaba7, 0xc4ab, 0xff78, 0xef37, 0xf714, 0xe62a, 0xe5ab, 0xdd6c, 0xddad, 0xddad, 0xddad, 0xddad, 0xddad, 0xddcd, 0xddce, 
-	0xe630, 0xeeb1, 0xd58d, 0xf651, 0xa3e8, 0xabc8, 0xaba8, 0x8aa4, 0x9b05, 0x9b06, 0x92a5, 0x8285, 0x61c3, 0x4142, 0x1861, 0x0841, 
-	0x1041, 0x1881, 0x4163, 0x61c5, 0x61c5, 0x61c5, 0x69e5, 0x69e5, 0x6a05, 0x69c5, 0x61c4, 0x61a4, 0x61a4, 0x59a4, 0x61a4, 0x6184, 
-	0x6184, 0x6183, 0x6183, 0x61a3, 0x71e4, 0x7a25, 0x8266, 0x8ae6, 0xa347, 0x82c7, 0x20a1, 0x28e1, 0x5183, 0x69e3, 0x7a23, 0x92e6, 
-	0x9b26, 0xbcab, 0xff78, 0xff79, 0xf715, 0xe62c, 0xee09, 0xdda8, 0xe5ca, 0xe5cd, 0xddad, 0xddad, 0xddad, 0xddad, 0xddcd, 0xe5ee, 
-	0xe650, 0xde0f, 0xa3e6, 0x9345, 0xc4ab, 0xbc49, 0xa387, 0xa347, 0x9b06, 0x8aa5, 0x7a24, 0x59c3, 0x3901, 0x1861, 0x0841, 0x0841, 
-	0x1041, 0x28c2, 0x4984, 0x6a06, 0x69e5, 0x69c5, 0x71c6, 0x71e6, 0x71e5, 0x71c5, 0x69a5, 0x69c5, 0x69a5, 0x69a4, 0x69a4, 0x61a4, 
-	0x61a4, 0x6184, 0x61a4, 0x69c4, 0x7a05, 0x8266, 0x8aa6, 0x92e7, 0xa348, 0xa389, 0x3902, 0x28e1, 0x4962, 0x7224, 0x8ac5, 0xa367, 
-	0xb469, 0xff78, 0xff99, 0xff98, 0xf737, 0xdda9, 0xe568, 0xe5a8, 0xedea, 0xe5ee, 0xe5cd, 0xddad, 0xddad, 0xddad, 0xddad, 0xe60f, 
-	0xee50, 0xee91, 0xdd8d, 0xedef, 0xb408, 0x9b45, 0x92e5, 0xa347, 0x92e5, 0x8264, 0x61c3, 0x4143, 0x1840, 0x0841, 0x0841, 0x1041, 
-	0x1061, 0x3102, 0x59a4, 0x7a27, 0x7a46, 0x8246, 0x8a66, 0x92a7, 0x9ae8, 0xa329, 0x92a7, 0x7a05, 0x79e5, 0x71c5, 0x69a5, 0x69a4, 
-	0x69c4, 0x61a4, 0x61a4, 0x61c4, 0x7205, 0x7a25, 0x8266, 0x8aa6, 0x9b27, 0xab88, 0x5162, 0x30e1, 0x4982, 0x7224, 0x9b25, 0xbc6a, 
-	0xff98, 0xf7ba, 0xff79, 0xff79, 0xf758, 0xedeb, 0xe568, 0xee0a, 0xf68d, 0xe62f, 0xe5ad, 0xddad, 0xddad, 0xddad, 0xddad, 0xe60f, 
-	0xee71, 0xee91, 0xbc48, 0xa386, 0xc48a, 0xb3c8, 0xa346, 0x92c5, 0x8ac5, 0x7203, 0x4962, 0x28e1, 0x1061, 0x1041, 0x0841, 0x1061, 
-	0x1881, 0x4964, 0x7a66, 0xab6a, 0xedd2, 0xf695, 0xfed6, 0xfeb5, 0xfe95, 0xedd1, 0xe570, 0xd4ad, 0xc42b, 0xab69, 0x8a87, 0x71e5, 
-	0x69c5, 0x69c5, 0x61a4, 0x5984, 0x4943, 0x4943, 0x4943, 0x4963, 0x5182, 0x92e7, 0x82a6, 0x30e1, 0x5182, 0x8ac5, 0xd52a, 0xf710, 
-	0xff9a, 0xffb9, 0xff9a, 0xff79, 0xff57, 0xee6c, 0xe5ea, 0xee2b, 0xe5eb, 0xddce, 0xe5cd, 0xddad, 0xddad, 0xddad, 0xddad, 0xe60f, 
-	0xee71, 0xee71, 0xc4a9, 0xa3a6, 0xab87, 0xb3c8, 0xa346, 0xa326, 0x8244, 0x61a2, 0x4962, 0x28e2, 0x1041, 0x1041, 0x20a2, 0x28c1, 
-	0x4143, 0x7a87, 0xed90, 0xf633, 0xf6d5, 0xfef6, 0xfe95, 0xe5d2, 0xcccf, 0xc46d, 0xb3ab, 0x92c7, 0x92c7, 0x9ae8, 0xab8a, 0xab8a, 
-	0x8aa7, 0x7205, 0x5963, 0x4102, 0x28a1, 0x2881, 0x2881, 0x38c1, 0x59a4, 0x69e4, 0xa3aa, 0x30e2, 0x61e2, 0xee0c, 0xf6ad, 0xff55, 
-	0xff9a, 0xff9a, 0xff9a, 0xffb9, 0xf714, 0xee8b, 0xe5c9, 0xe5a9, 0xee6f, 0xddcd, 0xddad, 0xddad, 0xddad, 0xddad, 0xddce, 0xe60f, 
-	0xee91, 0xee91, 0xf6d0, 0xdd8d, 0xb3c7, 0x9b05, 0xb3a8, 0x9b26, 0x8aa4, 0x7202, 0x5182, 0x30e2, 0x1861, 0x1040, 0x30e1, 0x8b6a, 
-	0x7204, 0xedf2, 0xf652, 0xf673, 0xf674, 0xd52e, 0xb3ca, 0x8aa7, 0x61c4, 0x5984, 0x6184, 0x69c5, 0x7205, 0x8246, 0xa328, 0xa2e8, 
-	0x8246, 0x71e5, 0x61a4, 0x5163, 0x5143, 0x5143, 0x61a3, 0x7204, 0x8ac6, 0xab88, 0xb3ea, 0x40e1, 0x6a23, 0xee6b, 0xeeab, 0xff97, 
-	0xff9a, 0xff9a, 0xff9a, 0xff99, 0xf6f1, 0xf68b, 0xdd88, 0xdd89, 0xe60e, 0xe5cd, 0xddac, 0xddad, 0xddad, 0xe5ad, 0xe5ee, 0xe60f, 
-	0xee91, 0xee92, 0xf6f1, 0xdd8d, 0xc449, 0xbc28, 0xc44a, 0x9b05, 0x92c4, 0x8284, 0x6a24, 0x4162, 0x20a1, 0x3122, 0x5a05, 0x59a3, 
-	0x9b08, 0xf633, 0xf652, 0xedf2, 0xccac, 0xc40b, 0xb38a, 0x9286, 0x8246, 0x7a05, 0x79e5, 0x8a25, 0x8a86, 0xa329, 0xb3aa, 0xab48, 
-	0x8245, 0x7a25, 0x61a4, 0x4922, 0x4102, 0x3902, 0x4943, 0x69e5, 0x8aa6, 0xa368, 0xbc0a, 0x5142, 0x6a02, 0xee6a, 0xeeac, 0xff79, 
-	0xff79, 0xeed6, 0xde32, 0xd58e, 0xcca7, 0xd507, 0xe5a9, 0xddcb, 0xddcd, 0xddac, 0xddad, 0xdd8d, 0xe5ad, 0xe5ad, 0xe60f, 0xe60f, 
-	0xee92, 0xeeb2, 0xeef5, 0xcceb, 0xc467, 0xcca9, 0xaba6, 0xa366, 0x9305, 0xa327, 0x7a64, 0x51a3, 0x30e2, 0x3902, 0x59e4, 0x5183, 
-	0xb3aa, 0xf632, 0xf633, 0xe56f, 0xe56f, 0xdd0d, 0xc40a, 0xbbca, 0xa309, 0x7205, 0x69c4, 0x79e5, 0x8a46, 0x9aa7, 0xdd4f, 0xdd2f, 
-	0xa2e7, 0x7204, 0x4922, 0x1861, 0x1040, 0x1041, 0x2081, 0x30a1, 0x5962, 0x8ac6, 0xabc8, 0x6a24, 0x7a22, 0xee2b, 0xe5cb, 0xcd8e, 
-	0xcd2d, 0xc50c, 0xcd0c, 0xc4cb, 0xc3e6, 0xcc66, 0xe568, 0xee4e, 0xddcd, 0xddac, 0xddac, 0xdd8d, 0xdd8d, 0xe5ad, 0xe60f, 0xe60f, 
-	0xee71, 0xee92, 0xf718, 0xd58e, 0xc446, 0xc406, 0xc427, 0xbbe7, 0xa366, 0x92c5, 0x9b47, 0x6a45, 0x4143, 0x4122, 0x51a4, 0x5983, 
-	0xc44b, 0xf653, 0xf653, 0xedd0, 0xe54e, 0xd4ac, 0xa2e7, 0x69c4, 0x38e1, 0x30a1, 0x5143, 0x5123, 0x81e5, 0x92a7, 0xf654, 0xfef6, 
-	0xcc0b, 0x8286, 0x5143, 0x40c3, 0x40e3, 0x4923, 0x6183, 0x71e4, 0x8aa6, 0x9b27, 0xa388, 0x9b27, 0xb3e7, 0xc405, 0xc3c7, 0xbc8a, 
-	0xbc8b, 0xb48b, 0xb46b, 0xbc49, 0xbba5, 0xc406, 0xdd48, 0xee2e, 0xddac, 0xddac, 0xddac, 0xdd8c, 0xdd8d, 0xddad, 0xe60f, 0xe5ef, 
-	0xee51, 0xe6b2, 0xff79, 0xde10, 0xcc68, 0xc426, 0xc406, 0xbbc5, 0xbbc6, 0xbc29, 0x9367, 0x61c4, 0x4143, 0x4122, 0x4143, 0x61c4, 
-	0xccad, 0xf653, 0xf653, 0xee11, 0xe56f, 0x9b06, 0x9328, 0xb42b, 0xa349, 0x9287, 0x79e5, 0x79e5, 0x8a86, 0xfed7, 0xfef7, 0xf6f6, 
-	0xed50, 0xa2c7, 0x71e4, 0x5163, 0x5142, 0x5143, 0x5963, 0x6183, 0x7a05, 0x9b07, 0xabc9, 0xb409, 0xcc88, 0xbb65, 0xb3c7, 0xb40a, 
-	0xb44a, 0xb44a, 0xb429, 0xab86, 0xb364, 0xbbc5, 0xd4e6, 0xee0d, 0xddac, 0xdd8c, 0xdd8c, 0xdd8c, 0xdd8c, 0xe5cd, 0xe60e, 0xe5ee, 
-	0xee50, 0xeed3, 0xff9a, 0xeed4, 0xcca8, 0xc406, 0xbbc5, 0xbba5, 0xbbc5, 0xc4ab, 0xac0b, 0x5183, 0x3901, 0x4142, 0x4122, 0x7225, 
-	0xe5d1, 0xf673, 0xf693, 0xee73, 0xf673, 0xf673, 0xee11, 0xd50d, 0xb389, 0x9a86, 0x8a25, 0x8a26, 0xcc6d, 0xf6b6, 0xf695, 0xfeb6, 
-	0xf5d2, 0xbb69, 0x92a7, 0x7a06, 0x61a4, 0x61a4, 0x6984, 0x71c4, 0x8246, 0xa328, 0xb3c9, 0xcc6a, 0xdcc8, 0xb344, 0xbbe9, 0xabe9, 
-	0xb44a, 0xb42a, 0xb429, 0xab45, 0xb364, 0xb384, 0xd4a6, 0xe5ec, 0xdd8c, 0xdd8c, 0xdd8c, 0xdd8c, 0xddac, 0xe5ee, 0xe60e, 0xe60e, 
-	0xee50, 0xf6f2, 0xffba, 0xf758, 0xe5ec, 0xcc47, 0xc406, 0xbbc5, 0xbbc5, 0xbc49, 0xb46c, 0x59a3, 0x4943, 0x4121, 0x4963, 0x69e4, 
-	0xf653, 0xf693, 0xf6d5, 0xff17, 0xf6f6, 0xf6b5, 0xe5f1, 0xdccd, 0xd42c, 0xcc8c, 0xdd0f, 0xe550, 0xe550, 0xff38, 0xfed6, 0xf6b6, 
-	0xf6b5, 0xdc8d, 0xb348, 0x8a87, 0x71e5, 0x71a4, 0x71c4, 0x79c5, 0x8a66, 0xab69, 0xbc0a, 0xedd0, 0xed4e, 0xab46, 0xabe9, 0xabc9, 
-	0xac09, 0xac0a, 0xb409, 0xab04, 0xb344, 0xab24, 0xd4a6, 0xe5ed, 0xdd8c, 0xdd8c, 0xdd6c, 0xdd6c, 0xdd8c, 0xe5ee, 0xe60e, 0xe5ee, 
-	0xe62f, 0xf6f1, 0xff98, 0xff79, 0xf6d0, 0xdd29, 0xc426, 0xc406, 0xbbe6, 0xbc27, 0xc4cd, 0x61e4, 0x7a46, 0x7204, 0x69c4, 0x71e5, 
-	0xf653, 0xf6b4, 0xf6d5, 0xff17, 0xff37, 0xf6d6, 0xf673, 0xedf1, 0xedf1, 0xedd1, 0xe5b0, 0xe54e, 0xedb0, 0xff17, 0xff17, 0xfef6, 
-	0xff58, 0xed50, 0xbb89, 0x9b08, 0x79e5, 0x79e5, 0x79e5, 0x7a05, 0x8a46, 0xa327, 0xfe74, 0xf653, 0xed6f, 0xcc4a, 0xabe9, 0xb3c9, 
-	0xabe9, 0xabc8, 0xaba7, 0xa304, 0xa304, 0xb384, 0xd486, 0xe5cd, 0xdd8c, 0xdd6c, 0xdd6c, 0xdd8b, 0xdd8c, 0xe5ee, 0xe5ee, 0xe5ee, 
-	0xe60f, 0xf711, 0xffb8, 0xf778, 0xf6f2, 0xedeb, 0xdd28, 0xcc26, 0xc426, 0xc427, 0xc50d, 0x82a6, 0x7a85, 0xe50f, 0x8a46, 0x8225, 
-	0xee12, 0xf6b5, 0xfef5, 0xff17, 0xff38, 0xff58, 0xf6b5, 0xee73, 0xf632, 0xedd1, 0xe590, 0xe54f, 0xed90, 0xf6b5, 0xff17, 0xfef7, 
-	0xff59, 0xf5f3, 0xc40b, 0xab69, 0x8a66, 0x79c4, 0x79e5, 0x8205, 0x9266, 0xa327, 0xf653, 0xf5f2, 0xed6f, 0xc3e9, 0xb3e9, 0xb40a, 
-	0xabe9, 0xa3a8, 0xb3e8, 0xa366, 0xbbe8, 0xbc28, 0xb406, 0xd52b, 0xdd6c, 0xdd6c, 0xdd6c, 0xdd6b, 0xddac, 0xe5ed, 0xe5cd, 0xe5ed, 
-	0xe60e, 0xf710, 0xffb8, 0xf798, 0xff35, 0xee2b, 0xe588, 0xe548, 0xcc86, 0xcc27, 0xc50d, 0xac4b, 0xac0b, 0xfe95, 0xab48, 0xa327, 
-	0xf653, 0xf6d5, 0xfef6, 0xff37, 0xff59, 0xff79, 0xff37, 0xf6b5, 0xf633, 0xedd1, 0xe54f, 0xd48c, 0xcc4b, 0xfeb5, 0xf6d6, 0xfed6, 
-	0xff38, 0xf634, 0xdcae, 0xab69, 0xab48, 0x8a46, 0x81e5, 0x8205, 0x9266, 0xab08, 0xf5f2, 0xf5d1, 0xed90, 0xdc6c, 0xab06, 0x9263, 
-	0x9ac5, 0xab87, 0xaba7, 0x9b26, 0xaba7, 0xb408, 0xabe8, 0xddad, 0xdd6c, 0xdd6b, 0xdd6c, 0xdd6b, 0xe5ac, 0xe5cd, 0xe5cd, 0xe5cd, 
-	0xe62e, 0xf70f, 0xffb9, 0xff78, 0xf756, 0xe62a, 0xe5a8, 0xe5a9, 0xe568, 0xd4e7, 0xcced, 0xc4ed, 0xc4ac, 0xc50f, 0xee74, 0xfe94, 
-	0xdd4f, 0xfed6, 0xf6f6, 0xff37, 0xff37, 0xff37, 0xfef6, 0xf675, 0xedf2, 0xe52f, 0xcc2b, 0xb348, 0xab28, 0xf6b5, 0xff37, 0xfef7, 
-	0xff58, 0xf633, 0xdcef, 0xab28, 0xbbeb, 0x8205, 0x79c5, 0x79e4, 0x8a46, 0xa2c7, 0xdccd, 0xf612, 0xf5d1, 0xe50d, 0xc3a8, 0xa2a4, 
-	0x9a83, 0x9aa4, 0x9ac5, 0x8ae5, 0x92c4, 0x9b46, 0xaba8, 0xcd0b, 0xdd4b, 0xdd6b, 0xdd6b, 0xdd6b, 0xe5cd, 0xe5cd, 0xddcd, 0xddcd, 
-	0xe630, 0xf732, 0xff9a, 0xff98, 0xf757, 0xee2c, 0xe5a9, 0xdd68, 0xe5c9, 0xe5c9, 0xdd8c, 0xc4cc, 0xc4cd, 0xb46c, 0xff58, 0xff17, 
-	0xf6b4, 0xfef6, 0xf6f6, 0xff37, 0xfef6, 0xf6d6, 0xf694, 0xee12, 0xe54f, 0xcc2b, 0xab08, 0xaae8, 0xab29, 0xe5b2, 0xe5b1, 0xdd50, 
-	0xee13, 0xedb1, 0xbbca, 0xa307, 0xa348, 0x92a7, 0x71e4, 0x69a3, 0x6983, 0x8a45, 0xc3e9, 0xf632, 0xf632, 0xedaf, 0xc3e9, 0xbb87, 
-	0xaae4, 0xaae4, 0xab25, 0xabe8, 0xa3a8, 0x9ba8, 0xb44a, 0xe5cd, 0xdd6b, 0xdd6b, 0xdd6b, 0xdd6b, 0xe5cd, 0xe5cd, 0xe5cd, 0xe5cd, 
-	0xe672, 0xff9a, 0xff9a, 0xff78, 0xf737, 0xe62c, 0xe5a9, 0xe5a8, 0xe5c8, 0xee4a, 0xee8e, 0xcd4e, 0xbccd, 0xc4ed, 0xd570, 0xf716, 
-	0xff37, 0xff17, 0xff17, 0xff17, 0xf6d5, 0xf694, 0xee12, 0xe56f, 0xcc6b, 0xab28, 0xa2e8, 0x9ac7, 0x9b28, 0xee53, 0xee53, 0xe570, 
-	0xa369, 0xb369, 0xa2e8, 0x9286, 0x9b07, 0xa348, 0x9b08, 0x7a05, 0x69c5, 0x8205, 0xbbc9, 0xe590, 0xedf0, 0xed6f, 0xd42a, 0xbbe8, 
-	0xab05, 0xab04, 0xab25, 0xabe8, 0xabc8, 0xb449, 0xbc6a, 0xddcd, 0xdd6b, 0xdd6b, 0xdd6b, 0xdd6b, 0xddcd, 0xddad, 0xe5cd, 0xe5cd, 
-	0xee94, 0xffba, 0xffbb, 0xff79, 0xf757, 0xee8f, 0xe5ea, 0xedc9, 0xe5c8, 0xee4b, 0xeeae, 0xe610, 0xd58f, 0xcd4f, 0xc50e, 0xcd2e, 
-	0xe5f2, 0xee54, 0xf717, 0xfef6, 0xf6b5, 0xee33, 0xe590, 0xd4cd, 0xab48, 0xa2e8, 0x9287, 0x9ac7, 0xe591, 0xf6d5, 0xee33, 0xe5f1, 
-	0xd4ed, 0x9aa7, 0x8a66, 0x8225, 0x92a6, 0xa36a, 0x8286, 0x5943, 0x71a4, 0x8225, 0xbba9, 0xc44a, 0xedf0, 0xee11, 0xedaf, 0xdcec, 
-	0xbbe8, 0xab25, 0xab04, 0xb3e8, 0xa3e9, 0xb44a, 0xb46b, 0xddae, 0xdd6b, 0xdd4b, 0xdd6b, 0xdd8c, 0xe5cd, 0xe5cd, 0xe5ad, 0xe5cd, 
-	0xf6f5, 0xffdb, 0xff9b, 0xff79, 0xf758, 0xf6d2, 0xe5ea, 0xe5c8, 0xe5e9, 0xe62a, 0xeecd, 0xe631, 0xd56e, 0xee73, 0xc54f, 0xc4cd, 
-	0x8a85, 0x82a6, 0xff37, 0xf716, 0xfed5, 0xee32, 0xedd1, 0xc46c, 0xbbca, 0x9ae7, 0xab49, 0xe5b1, 0xeeb4, 0xeeb4, 0xf694, 0xedf2, 
-	0xcc4c, 0xab08, 0x9a65, 0x8204, 0x8225, 0x2860, 0x3881, 0x69a4, 0x71e4, 0x8a66, 0xbba8, 0xbc09, 0xccec, 0xf672, 0xee10, 0xe58e, 
-	0xd4cb, 0xbbe8, 0xab25, 0xab87, 0xabe9, 0xb46a, 0xb46a, 0xcd4d, 0xdd6b, 0xdd6b, 0xdd6b, 0xe5ac, 0xddac, 0xe5ac, 0xe5ad, 0xe5ac, 
-	0xf737, 0xffbb, 0xff9b, 0xff79, 0xf757, 0xeef3, 0xe5ca, 0xe5a8, 0xee0a, 0xee6b, 0xeecc, 0xe651, 0xcd2d, 0xe674, 0xeed5, 0xd5af, 
-	0xabc8, 0x7224, 0xf6d6, 0xff17, 0xf6d5, 0xf694, 0xee32, 0xe58f, 0xdd0d, 0xcc6b, 0x9ac6, 0xc4ad, 0xe5b1, 0xcc8c, 0xb368, 0xaae7, 
-	0xaac7, 0x9225, 0x9aa7, 0x8a65, 0x8245, 0x3881, 0x7a05, 0x7a05, 0x7a04, 0x92a6, 0xb3a8, 0xb3c8, 0xbc09, 0xf672, 0xf672, 0xee10, 
-	0xe58e, 0xc46a, 0xbbe8, 0xa346, 0xac09, 0xb44a, 0xb44a, 0xcd0c, 0xdd8c, 0xdd6b, 0xdd6b, 0xe5ac, 0xddac, 0xe58c, 0xe5ac, 0xe5ad, 
-	0xf735, 0xffbb, 0xffbb, 0xf779, 0xf737, 0xf715, 0xee0b, 0xe5ea, 0xee0a, 0xee4a, 0xf6cd, 0xee70, 0xcced, 0xddf1, 0xeef5, 0xeeb5, 
-	0xd52b, 0x8264, 0xac0a, 0xf716, 0xfef6, 0xf6b5, 0xee73, 0xe5f1, 0xe58f, 0xc42a, 0xa308, 0x8225, 0x71c4, 0xe570, 0xdd6e, 0xf5f1, 
-	0xe54f, 0xc44b, 0xa308, 0x71a3, 0x71a3, 0x8a26, 0xa328, 0x8a86, 0x8a45, 0xa306, 0xb3c8, 0xb3c8, 0xb3c8, 0xbc2a, 0xf672, 0xf631, 
-	0xedf0, 0xe54d, 0xc3e9, 0xbc2a, 0xac09, 0xbc6b, 0xb46a, 0xc50c, 0xe5ad, 0xdd4a, 0xdd6b, 0xe58c, 0xe58c, 0xe58c, 0xe5ac, 0xe5ac, 
-	0xf712, 0xffba, 0xffba, 0xf779, 0xf738, 0xf716, 0xe5eb, 0xee0a, 0xede9, 0xee6a, 0xf6ed, 0xee6f, 0xcd0d, 0xcd4e, 0xf6f6, 0xeef6, 
-	0xee6f, 0xbc28, 0x8ac5, 0xfed5, 0xf6f6, 0xf6d5, 0xf674, 0xee32, 0xe5b0, 0xd4cd, 0xcc8b, 0xedcf, 0xf652, 0xf673, 0xf5b1, 0xe50f, 
-	0xecee, 0xd42b, 0xed70, 0xcc0b, 0xb2c7, 0xab07, 0xab47, 0x92a6, 0x9ae6, 0xab47, 0xb3a8, 0xabc8, 0xb3c8, 0xb3e9, 0xdd4e, 0xf651, 
-	0xe5ae, 0xedcf, 0xcc8b, 0xbc09, 0xbc2a, 0xb44a, 0xb44a, 0xc4ec, 0xe5ee, 0xdd4b, 0xdd6b, 0xe58c, 0xe58c, 0xe58c, 0xe58c, 0xe5ac, 
-	0xf6f1, 0xf775, 0xffbb, 0xff79, 0xf758, 0xf737, 0xee6e, 0xe5c9, 0xede9, 0xe609, 0xf6ec, 0xee4e, 0xd50c, 0xc4ec, 0xeeb4, 0xef17, 
-	0xf6d1, 0xd509, 0xb3e7, 0xb3ea, 0xf6f5, 0xf6f5, 0xee73, 0xee53, 0xedf1, 0xe56e, 0xe58f, 0xee11, 0xf653, 0xf6b5, 0xee53, 0xe570, 
-	0xdcad, 0xf591, 0xfe95, 0xf612, 0xdc8c, 0xb368, 0xab88, 0x9ac7, 0xab48, 0xb3a8, 0xb3a8, 0xaba8, 0xabc8, 0xb3e9, 0xbc09, 0xee11, 
-	0xf651, 0xee10, 0xedcf, 0xd4ab, 0xbc09, 0xbc6a, 0xb429, 0xbcab, 0xe5ee, 0xe56b, 0xe58c, 0xe58c, 0xe58c, 0xe58c, 0xe5ac, 0xe5ac, 
-	0xf6d0, 0xf774, 0xffbb, 0xf779, 0xf737, 0xf717, 0xe66f, 0xedea, 0xe5c9, 0xee29, 0xf6cc, 0xee6c, 0xd50c, 0xc4ab, 0xe653, 0xf716, 
-	0xf6d2, 0xee0b, 0xdd49, 0xab65, 0xf653, 0xf6d5, 0xf694, 0xee73, 0xee32, 0xf652, 0xee11, 0xee52, 0xf673, 0xf693, 0xf652, 0xe5f1, 
-	0xdcac, 0xf591, 0xf633, 0xfe53, 0xf5f1, 0xe52e, 0xbba9, 0xb368, 0xbbc9, 0xb326, 0xab47, 0xaba8, 0xabc8, 0xb3e9, 0xb3e8, 0xb387, 
-	0xfe51, 0xee71, 0xee10, 0xe5ae, 0xcc8b, 0xc46a, 0xbc4a, 0xb44a, 0xdd8d, 0xdd6b, 0xe58c, 0xe58c, 0xe58c, 0xe5ac, 0xe5ac, 0xe5ac, 
-	0xf6af, 0xf754, 0xffba, 0xf779, 0xf757, 0xf717, 0xee90, 0xedeb, 0xe5c9, 0xe5e9, 0xf6cc, 0xee8b, 0xd52c, 0xc48a, 0xd56e, 0xf716, 
-	0xf6f4, 0xe60a, 0xe5c8, 0xdd48, 0xdd8c, 0xf6b4, 0xf6d5, 0xee74, 0xee73, 0xee73, 0xf694, 0xee73, 0xf6b4, 0xf694, 0xf653, 0xedf1, 
-	0xe4ed, 0xd46c, 0xf5f2, 0xf633, 0xf652, 0xedd0, 0xedd0, 0xdd4e, 0xc429, 0xab05, 0xb367, 0xabc8, 0xaba8, 0xb409, 0xb3e8, 0xb346, 
-	0xb3a7, 0xf630, 0xee10, 0xee10, 0xe58e, 0xc44a, 0xc46b, 0xbc6a, 0xdd8e, 0xdd8c, 0xe58c, 0xe5ac, 0xe5ac, 0xe5ac, 0xe5ac, 0xe5ac, 
-	0xee6f, 0xf753, 0xff9a, 0xf778, 0xf737, 0xf737, 0xf6f4, 0xedea, 0xe5ea, 0xee29, 0xeecc, 0xeecb, 0xdd6d, 0xc48b, 0xcd0c, 0xf6f5, 
-	0xf734, 0xee4b, 0xee0a, 0xe5a9, 0xe5ea, 0xfef5, 0xee94, 0xf694, 0xf6b5, 0xf6b4, 0xf6b5, 0xf6d5, 0xfef5, 0xfef5, 0xf673, 0xee52, 
-	0xedf1, 0xedb0, 0xed70, 0xf5d1, 0xf5f1, 0xedf1, 0xf672, 0xf652, 0xedf0, 0xe54d, 0xc44a, 0xbc09, 0xb3e9, 0xbc09, 0xbbc8, 0xb3a7, 
-	0xb305, 0xbba7, 0xedef, 0xee10, 0xedef, 0xdd0c, 0xcc4a, 0xc46a, 0xd56d, 0xddad, 0xe58c, 0xe5ac, 0xe5ac, 0xe5ad, 0xe5ac, 0xddac, 
-	0xe5ee, 0xf753, 0xff9a, 0xf779, 0xf737, 0xeef6, 0xeef5, 0xe5ea, 0xe5c9, 0xe609, 0xeeab, 0xeecc, 0xdd8c, 0xc48a, 0xcccc, 0xee93, 
-	0xf735, 0xee4b, 0xede9, 0xe5a9, 0xe5a9, 0xe60f, 0xff16, 0xee74, 0xf694, 0xf6b5, 0xf6d5, 0xf6d5, 0xff16, 0xff16, 0xfed5, 0xf653, 
-	0xee32, 0xedd1, 0xd4ed, 0xcc6c, 0xed8f, 0xf631, 0xf672, 0xf652, 0xf631, 0xee11, 0xe5ae, 0xe56e, 0xc429, 0xbbe9, 0xbbc8, 0xb3c8, 
-	0xb305, 0xb2e4, 0xb386, 0xedaf, 0xe5ae, 0xee10, 0xdd4e, 0xcc2a, 0xc44a, 0xe5ad, 0xe58c, 0xe5ad, 0xf691, 0xee51, 0xe5ef, 0xe5ce, 
-	0xe5ce, 0xf733, 0xff9a, 0xff79, 0xf737, 0xeef5, 0xeef6, 0xee2c, 0xee2a, 0xee4a, 0xf6ab, 0xf6ec, 0xddab, 0xcc8a, 0xcccb, 0xe5f1, 
-	0xf755, 0xee4c, 0xedc8, 0xedea, 0xe5a8, 0xee2b, 0xfef5, 0xff16, 0xee53, 0xee73, 0xf6b4, 0xf6b5, 0xf6d5, 0xf6d5, 0xf694, 0xf653, 
-	0xee11, 0xe54f, 0xc40b, 0xab28, 0xbbaa, 0xe54e, 0xf652, 0xf672, 0xf651, 0xee11, 0xf631, 0xf631, 0xedf0, 0xe56e, 0xc42a, 0xbbe9, 
-	0xb325, 0xb325, 0xbb46, 0xedaf, 0xf694, 0xf672, 0xf693, 0xe5d0, 0xf631, 0xe5ef, 0xee31, 0xf692, 0xee52, 0xe5ef, 0xdd6d, 0xf6b3, 
-	0xe5ce, 0xf712, 0xff99, 0xf778, 0xf737, 0xeef5, 0xeed5, 0xee6f, 0xee2a, 0xee4a, 0xee8b, 0xf70d, 0xe5ca, 0xcc8a, 0xcccc, 0xddd0, 
-	0xf736, 0xee6c, 0xedea, 0xee0a, 0xee09, 0xedea, 0xcd0d, 0xff16, 0xfef6, 0xee94, 0xee32, 0xee53, 0xf653, 0xee73, 0xee32, 0xe5d1, 
-	0xe54f, 0xd4ac, 0xab48, 0x9ac7, 0xa307, 0xab28, 0xbc09, 0xedf0, 0xf631, 0xee31, 0xf631, 0xf672, 0xf652, 0xee11, 0xed8e, 0xdcec, 
-	0xc408, 0xbb87, 0xc429, 0xfed5, 0xff57, 0xff16, 0xfed4, 0xfef5, 0xf6b3, 0xff16, 0xf6f5, 0xf693, 0xee72, 0xdd6e, 0xcc8b, 0xccac, 
-	0xe5cd, 0xf710, 0xff98, 0xf778, 0xf758, 0xeef6, 0xeef5, 0xf6b2, 0xee4a, 0xee4a, 0xee6b, 0xeeec, 0xee2b, 0xcca9, 0xccec, 0xd56e, 
-	0xf737, 0xee6d, 0xedea, 0xee0a, 0xe5c9, 0xe5c9, 0xcccb, 0xb44c, 0xf6d5, 0xf6d5, 0xf694, 0xee53, 0xe5b0, 0xdd4f, 0xd4ed, 0xd4cd, 
-	0xc42b, 0xab48, 0xa308, 0xa2e7, 0xab48, 0xa2e7, 0xbba9, 0xbbe9, 0xdd4e, 0xedd0, 0xf652, 0xf652, 0xf632, 0xee11, 0xedef, 0xedcf, 
-	0xf672, 0xfef5, 0xff57, 0xf6f6, 0xf673, 0xf693, 0xf672, 0xf673, 0xff16, 0xff56, 0xff15, 0xf6b3, 0xee31, 0xdd4d, 0xcc6a, 0xa306, 
-	0xe5cd, 0xf70f, 0xff77, 0xff79, 0xf758, 0xf6f6, 0xeef4, 0xf6d4, 0xee4b, 0xee29, 0xee4a, 0xf70d, 0xee6a, 0xd4a9, 0xccec, 0xd54d, 
-	0xf737, 0xee8f, 0xe5c9, 0xedea, 0xe58a, 0xcca9, 0xc46c, 0xabca, 0xc4ce, 0xff16, 0xf6d4, 0xee32, 0xd52e, 0xbc0a, 0xab88, 0xa327, 
-	0xa327, 0xa308, 0xab28, 0x9ae7, 0x92a6, 0xa307, 0xb3a9, 0xa327, 0xb3c9, 0xc44a, 0xe56e, 0xedf0, 0xee10, 0xf5f0, 0xedcf, 0xedf0, 
-	0xf6b4, 0xfef6, 0xfef5, 0xf693, 0xf652, 0xf673, 0xf672, 0xf672, 0xf672, 0xff36, 0xff16, 0xfef5, 0xf651, 0xd4ec, 0xc42a, 0x8a44, 
-	0xe5cd, 0xf70e, 0xf735, 0xff78, 0xf757, 0xeef5, 0xeed5, 0xf6f4, 0xe62b, 0xee0a, 0xee4a, 0xf6ec, 0xee6b, 0xd4c9, 0xd4eb, 0xd54d, 
-	0xf6f5, 0xf671, 0xdd2a, 0xbc28, 0xb409, 0xabca, 0xbc2b, 0xa38a, 0xa369, 0xc4ee, 0xf6d5, 0xf694, 0xee11, 0xd4ed, 0xb389, 0xa328, 
-	0xb3ca, 0xccac, 0xe54f, 0xb3ca, 0x9ae7, 0xab68, 0xa328, 0x92c7, 0x9b07, 0xbc0a, 0xb3a8, 0xb3c8, 0xdd4e, 0xed8f, 0xed8f, 0xedd0, 
-	0xfeb4, 0xfef5, 0xfeb5, 0xf673, 0xf632, 0xf672, 0xfed4, 0xf672, 0xee51, 0xff16, 0xff37, 0xf6d4, 0xf672, 0xd4ab, 0xbbc9, 0x8204, 
-	0xddac, 0xf70e, 0xf712, 0xff78, 0xf737, 0xeed5, 0xf6f5, 0xf715, 0xee6e, 0xee0a, 0xee4a, 0xf70c, 0xf6ab, 0xd4e8, 0xcceb, 0xc4ab, 
-	0xb44b, 0xb42a, 0xabca, 0xaba9, 0xabc9, 0xabea, 0xabca, 0x9b69, 0x92e8, 0x9309, 0xbc8c, 0xf674, 0xee52, 0xdd4e, 0xb3a9, 0xa327, 
-	0xaba9, 0xe5af, 0xee31, 0xdd2e, 0xab68, 0xab88, 0x9ae7, 0x8a66, 0x92c7, 0xab89, 0xa327, 0xa307, 0xa307, 0xb368, 0xdccd, 0xedaf, 
-	0xfe93, 0xf673, 0xfeb4, 0xf693, 0xf652, 0xfe92, 0xf693, 0xf693, 0xf693, 0xff16, 0xf716, 0xf6b3, 0xee51, 0xd4ab, 0xb388, 0x8224, 
-	0xe5ad, 0xf70e, 0xf6ef, 0xff77, 0xf757, 0xeed6, 0xf6d5, 0xf6f5, 0xf6b1, 0xe5aa, 0xee2a, 0xee6d, 0xd509, 0xc44a, 0xb409, 0xabca, 
-	0xab69, 0xa389, 0xa389, 0xa369, 0xa369, 0xabcb, 0x9b49, 0x9308, 0x8ac8, 0x82e7, 0x8ac8, 0xabea, 0xee53, 0xedd0, 0xbbea, 0xa348, 
-	0x9b07, 0xedf1, 0xf693, 0xdd4e, 0xb389, 0xb3c9, 0x9ae7, 0x8a87, 0x9ae7, 0x92c7, 0x9ae7, 0x9ae7, 0x9ae7, 0xa2e8, 0xb389, 0xc42a, 
-	0xf632, 0xf653, 0xf673, 0xf673, 0xf652, 0xf673, 0xf673, 0xf631, 0xf652, 0xf6b4, 0xff16, 0xf6b4, 0xee72, 0xdd2e, 0xb3a9, 0x9265, 
-	0xddcc, 0xf70e, 0xf6ce, 0xff56, 0xf6f5, 0xde12, 0xc50e, 0xbcac, 0xbc6a, 0xbc49, 0xbc09, 0xb3c8, 0xaba8, 0xaba9, 0xaba9, 0xabc9, 
-	0xabca, 0xa369, 0xa389, 0xa369, 0xa369, 0x9b49, 0x9b49, 0x9329, 0x8ac8, 0x82a8, 0x8ac8, 0x92e8, 0xa389, 0xe5d0, 0xd4cd, 0xa348, 
-	0xa307, 0xdd90, 0xf6b5, 0xdd6f, 0xb388, 0xbc0b, 0x9ae7, 0x92a6, 0x92c6, 0x9b07, 0xc46c, 0xcc8d, 0x9b07, 0xa308, 0xa328, 0xb388, 
-	0xb40a, 0xedf1, 0xf653, 0xf673, 0xf673, 0xf672, 0xf673, 0xfe93, 0xf651, 0xfed4, 0xff36, 0xf6d5, 0xf693, 0xdd8f, 0xc42a, 0xc42b, 
-	0xddce, 0xee4f, 0xd58c, 0xc4ac, 0xc46b, 0xbc2b, 0xb40a, 0xb409, 0xabc9, 0xab88, 0xa347, 0xa328, 0x9b28, 0x9b07, 0x9b48, 0xa369, 
-	0xa389, 0xa389, 0xa369, 0x9b48, 0x9308, 0x9308, 0x9308, 0x8ac8, 0x92e8, 0x8ac8, 0x82a7, 0x8ae8, 0x92e8, 0xa389, 0xd50d, 0xb3a9, 
-	0xa307, 0xdd90, 0xf694, 0xe58f, 0xb388, 0xa347, 0xbc0a, 0xdd0e, 0xed90, 0xe5d0, 0xe5af, 0xdd4e, 0xdd0e, 0xc46c, 0xa348, 0xa328, 
-	0xb369, 0xb3c9, 0xf632, 0xfe94, 0xf6b4, 0xff16, 0xfed5, 0xf693, 0xfed4, 0xf694, 0xff36, 0xf6f5, 0xf693, 0xedf0, 0xd46b, 0xf693
-};
-
-// 'bonjwachill', 64x64px
-const uint16_t epd_bitmap_bonjwachill [] PROGMEM = {
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0102, 0x0a05, 0x1c6b, 0x1c8b, 0x24ac, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24ac, 0x1c8b, 0x1c6b, 0x0a05, 0x0102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1b89, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x1ba9, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x1245, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x24ac, 0x24cc, 0x1ccc, 0x24ac, 0x246b, 0x248b, 
-	0x1c6b, 0x1c8b, 0x1cab, 0x1ccc, 0x24cc, 0x1ccc, 0x1ccc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1266, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x12c7, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x1cac, 0x1ccc, 0x248c, 0x09a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x09c4, 0x24ac, 0x24ac, 0x1ccc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x12c7, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0963, 
-	0x24ac, 0x24cc, 0x1ccc, 0x1ccc, 0x24cc, 0x1bc9, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x1c0a, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 
-	0x0983, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x248b, 0x24cc, 
-	0x24cc, 0x24ac, 0x24ac, 0x1a87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c2, 0x12e7, 0x1c6b, 0x1cab, 0x1ccc, 0x24ac, 0x24cc, 
-	0x24ac, 0x24ac, 0x1ccc, 0x1cab, 0x244b, 0x1265, 0x00a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b48, 0x1ccc, 0x24ac, 0x24ac, 
-	0x24cc, 0x248b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0102, 0x24ac, 0x24cc, 0x24cc, 
-	0x24ac, 0x12e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a1, 0x1c4b, 0x24ac, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x24ac, 0x1ccc, 0x1c4b, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b68, 0x24ac, 
-	0x24cc, 0x24cc, 0x24ac, 0x0923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1307, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 
-	0x0020, 0x0000, 0x0000, 0x0000, 0x1ae7, 0x24cb, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x246b, 0x09e5, 0x08c2, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0020, 0x0902, 0x09e4, 0x248c, 0x1cac, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x12a7, 0x0000, 0x0000, 0x0000, 0x0020, 
-	0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c0a, 0x24cc, 0x24cc, 0x24ac, 0x1aa7, 0x0000, 
-	0x0000, 0x0000, 0x0a45, 0x24cc, 0x24cc, 0x24ac, 0x24ac, 0x1b08, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1348, 0x1ccc, 0x24cc, 0x24cc, 0x1cac, 0x09e4, 0x0000, 0x0000, 
-	0x0020, 0x1b08, 0x24ac, 0x24cc, 0x24cc, 0x1c2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x24ac, 0x1ccc, 0x0861, 0x0000, 0x0000, 
-	0x0040, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x0081, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0061, 0x08e2, 0x1c6b, 0x24ac, 0x24ac, 
-	0x248c, 0x24ac, 0x244b, 0x08c1, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0902, 0x24ac, 0x24cc, 0x24ac, 0x24ac, 0x0020, 
-	0x0020, 0x0000, 0x0081, 0x24ac, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c0a, 0x24cc, 0x24ac, 0x1cac, 0x0000, 0x0000, 0x0000, 0x1266, 
-	0x24ac, 0x24ac, 0x24ac, 0x0963, 0x0000, 0x0000, 0x0000, 0x0020, 0x1266, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x0a25, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c4, 0x24ac, 0x24cc, 0x24cc, 
-	0x1226, 0x0000, 0x0000, 0x0061, 0x24cc, 0x24cc, 0x24cc, 0x1c0a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1307, 0x24cc, 0x1ccc, 0x1cac, 0x0000, 0x0020, 0x0000, 0x242b, 0x1cac, 
-	0x24cc, 0x1c0a, 0x0000, 0x0000, 0x0000, 0x0020, 0x23eb, 0x24ac, 0x1ccc, 0x24ac, 0x24ac, 0x24ac, 0x1c8b, 0x12c7, 0x1225, 0x1225, 
-	0x0a25, 0x1225, 0x1ae7, 0x248b, 0x24ac, 0x1ccc, 0x24cc, 0x24ac, 0x1ccc, 0x2389, 0x0020, 0x0000, 0x0000, 0x0000, 0x242a, 0x24ac, 
-	0x1ccc, 0x2389, 0x0000, 0x0000, 0x0040, 0x24ac, 0x24cc, 0x24cc, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0102, 0x24cc, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x1c8b, 0x24ac, 0x24ac, 
-	0x11e5, 0x0000, 0x0000, 0x0000, 0x1bea, 0x1ccc, 0x24ac, 0x1ccc, 0x24cc, 0x1a86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x1ac8, 0x24cc, 0x24cc, 0x24ac, 0x24ac, 0x1348, 0x0000, 0x0000, 0x0000, 0x1225, 
-	0x24ac, 0x24ac, 0x248b, 0x0000, 0x0000, 0x0041, 0x24cc, 0x24ac, 0x24cc, 0x0902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x0061, 0x0000, 0x0000, 0x248b, 0x24ac, 0x24cc, 0x0060, 
-	0x0000, 0x0000, 0x0902, 0x24cc, 0x24ac, 0x24ac, 0x240a, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x00e2, 0x0902, 
-	0x0902, 0x08e2, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x1c6b, 0x24cc, 0x1ccc, 0x1ccc, 0x00c1, 0x0000, 0x0000, 
-	0x0143, 0x24cc, 0x24ac, 0x248b, 0x0000, 0x0000, 0x00a1, 0x24ac, 0x24cc, 0x24cc, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x248b, 0x24cc, 0x24cc, 0x1a26, 0x0000, 0x0000, 0x1c2b, 0x1ccc, 0x24ac, 0x0040, 0x0000, 
-	0x0000, 0x1328, 0x1ccc, 0x24ac, 0x1c8b, 0x08a2, 0x0000, 0x0000, 0x0000, 0x0061, 0x1b48, 0x24cc, 0x24ac, 0x24ac, 0x24ac, 0x24cc, 
-	0x24cc, 0x24ac, 0x24ac, 0x24cc, 0x1ccc, 0x1b28, 0x0040, 0x0000, 0x0000, 0x0000, 0x0902, 0x24ac, 0x24ac, 0x24ac, 0x0a65, 0x0000, 
-	0x0000, 0x08a1, 0x24cc, 0x24ac, 0x1be9, 0x0000, 0x0000, 0x1ae7, 0x24cc, 0x24cc, 0x24ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0963, 0x24cc, 0x24cc, 0x248c, 0x0000, 0x0000, 0x12a6, 0x24ac, 0x24cc, 0x0060, 0x0000, 0x0000, 
-	0x1ba9, 0x24cc, 0x24cc, 0x1b68, 0x0020, 0x0020, 0x0020, 0x08c2, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1ccc, 0x24ac, 0x0041, 0x0020, 0x0020, 0x0020, 0x1409, 0x24ac, 0x24cc, 0x1b89, 
-	0x0000, 0x0000, 0x0143, 0x24cc, 0x24ac, 0x1225, 0x0020, 0x0020, 0x24ac, 0x24cc, 0x24cc, 0x0984, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24ac, 0x24ac, 0x0000, 0x0000, 0x0040, 0x24ac, 0x24ac, 0x11a4, 0x0000, 0x0000, 0x1ba9, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x1389, 0x0000, 0x0000, 0x0a05, 0x24cc, 0x24ac, 0x0041, 0x0000, 0x0020, 0x24ac, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x12c7, 0x24cc, 0x24ac, 0x0a25, 0x0000, 0x0000, 0x1ccc, 0x24cc, 0x1bea, 0x0000, 0x0000, 0x1b48, 0x1ccc, 
-	0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 
-	0x24cc, 0x24cc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 0x1ccc, 
-	0x1ccc, 0x1a66, 0x0000, 0x0000, 0x1c2a, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x1b69, 0x24cc, 0x24cc, 0x12e7, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0ac6, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x09e5, 0x0000, 0x0000, 0x1ccc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x1245, 0x24cc, 0x24ac, 0x0983, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x0902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09a4, 0x1ccc, 0x24ac, 0x0000, 0x0000, 0x1328, 0x24cc, 0x24cc, 0x1266, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x24ac, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x1348, 0x24cc, 0x24cc, 0x24ac, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 
-	0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x1c2a, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 
-	0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x24ab, 0x1cac, 0x24cc, 0x12e7, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 
-	0x0000, 0x0040, 0x24cc, 0x24cc, 0x1307, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x1bea, 0x24cc, 0x24cc, 0x0040, 0x0000, 
-	0x0000, 0x1b89, 0x24cc, 0x1ccc, 0x0020, 0x0000, 0x0000, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 
-	0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x0081, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0081, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 
-	0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x0000, 0x0000, 0x0061, 0x24cc, 0x24cc, 0x1ba9, 0x0000, 
-	0x0000, 0x24ab, 0x24cc, 0x1ccc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0000, 
-	0x0000, 0x24cc, 0x24cc, 0x1c6b, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 
-	0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x09e4, 0x1ccc, 
-	0x24cc, 0x09e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 
-	0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x11e4, 0x24cc, 0x24cc, 0x24cc, 0x0000, 
-	0x0102, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x0102, 
-	0x0a05, 0x24cc, 0x24ac, 0x1c6b, 0x1c6b, 0x1c6b, 0x1c6b, 0x246b, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c6b, 0x246b, 0x1c6b, 
-	0x1c6b, 0x1c6b, 0x1c6b, 0x1ccc, 0x24ac, 0x24cc, 0x1c6b, 0x1c6b, 0x246b, 0x24ac, 0x24cc, 0x24cc, 0x1cac, 0x1c6b, 0x1c6b, 0x1ccc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1cac, 0x244b, 0x1c6b, 0x24ac, 0x24cc, 0x1c6b, 0x1c6b, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x1c6b, 
-	0x1c6b, 0x246b, 0x24cc, 0x24cc, 0x1ccc, 0x1cac, 0x1c6b, 0x1c6b, 0x1ccc, 0x24cc, 0x246b, 0x1c6b, 0x1c6b, 0x24cc, 0x24cc, 0x0a25, 
-	0x1c6b, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ccc, 0x24cc, 0x24ac, 0x10c2, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x0000, 0x1c0a, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x1b48, 0x0000, 
-	0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0040, 0x0000, 0x1307, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x1c8b, 
-	0x1c8b, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0081, 0x24cc, 0x1cab, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0020, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x24cc, 0x24cc, 0x248b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x1266, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x248b, 
-	0x24ac, 0x24cc, 0x1c6b, 0x0000, 0x0000, 0x24ac, 0x24ac, 0x08c2, 0x0000, 0x00a1, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x1ccc, 0x24ac, 
-	0x24ac, 0x24cc, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0020, 0x1bca, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x1bc9, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x24cc, 0x1cac, 0x0061, 0x0000, 0x12c7, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x24ac, 
-	0x24cc, 0x24cc, 0x1c6b, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x0041, 0x0000, 0x00a1, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x1ccc, 0x24cc, 
-	0x24cc, 0x24ac, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x1123, 0x0000, 0x0020, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0020, 0x0000, 0x1143, 
-	0x0000, 0x0000, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x1ac7, 0x0000, 0x0020, 0x0000, 0x0000, 0x1c4b, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x246b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x24cc, 0x24cc, 
-	0x24cc, 0x1ccc, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x1cac, 0x0000, 0x0000, 0x1c6b, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x1c0a, 0x0000, 0x0020, 0x24ac, 
-	0x0000, 0x0000, 0x24cc, 0x0902, 0x0000, 0x09a4, 0x1ccc, 0x24cc, 0x0000, 0x0000, 0x244b, 0x0000, 0x0000, 0x1c4b, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x244b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09e4, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x24cc, 0x24cc, 
-	0x24cc, 0x1ccc, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x1cac, 0x1b69, 0x0000, 0x0040, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x24cc, 0x0000, 0x0000, 0x1b48, 0x24ac, 
-	0x0000, 0x0000, 0x24ac, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x1307, 0x0000, 0x0040, 0x1cac, 0x0000, 0x0000, 0x1c4b, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x246b, 0x0000, 0x0000, 0x248b, 0x1cab, 0x12e7, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x24cc, 0x24cc, 
-	0x24cc, 0x1ccc, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x1cac, 0x24ac, 0x0000, 0x0000, 0x1b28, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x1b69, 0x0000, 0x0000, 0x1cac, 0x24ac, 
-	0x0000, 0x0000, 0x0923, 0x0000, 0x09a4, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x1b69, 0x1ba9, 0x0000, 0x0000, 0x1c4b, 0x24cc, 0x24cc, 
-	0x24ac, 0x24cc, 0x244b, 0x0000, 0x0000, 0x1ccc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x24cc, 0x24cc, 
-	0x24cc, 0x24ac, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x1225, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x1368, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x22e8, 0x24ac, 0x24ac, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24ac, 0x242b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c8b, 0x24cc, 0x24ac, 
-	0x1c8b, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x1102, 0x1103, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x1103, 
-	0x1103, 0x0020, 0x0000, 0x0000, 0x248b, 0x24cc, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x24ac, 0x0000, 0x0020, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x24cc, 0x10e3, 0x10e3, 0x0000, 0x0000, 0x0000, 0x1ccc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0020, 0x24cc, 0x24cc, 0x24ac, 
-	0x0000, 0x0000, 0x0000, 0x00e2, 0x24cc, 0x24ac, 0x0020, 0x0000, 0x1389, 0x1be9, 0x1be9, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x248b, 
-	0x1c6b, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x1ccc, 0x11e5, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x1266, 0x0000, 0x0000, 0x0000, 0x0000, 0x1225, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x0000, 0x1205, 0x1ccc, 0x24cc, 0x24ac, 
-	0x0000, 0x0000, 0x0000, 0x24ac, 0x1ccc, 0x1c2a, 0x0000, 0x0000, 0x1ccc, 0x24cc, 0x1c6b, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x1c8b, 
-	0x0a05, 0x24cc, 0x24ac, 0x11e5, 0x11e5, 0x11e5, 0x11e5, 0x11e5, 0x1b89, 0x24ac, 0x24cc, 0x1ccc, 0x1ccc, 0x1b69, 0x11e5, 0x11e5, 
-	0x11e5, 0x11e5, 0x12a6, 0x24ac, 0x1ccc, 0x24cc, 0x1205, 0x11e5, 0x24ac, 0x24cc, 0x24cc, 0x1cac, 0x1205, 0x11e5, 0x11e5, 0x24ac, 
-	0x24cc, 0x1205, 0x11e5, 0x11e5, 0x1205, 0x1c4b, 0x1ccc, 0x24cc, 0x24cc, 0x1205, 0x11e5, 0x1205, 0x1ccc, 0x24cc, 0x24cc, 0x24ab, 
-	0x11e5, 0x11e5, 0x1a05, 0x24cc, 0x24ac, 0x1225, 0x11e5, 0x1ba9, 0x24ac, 0x24cc, 0x1c4b, 0x11e5, 0x11e5, 0x24cc, 0x24cc, 0x0a45, 
-	0x0102, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x0923, 
-	0x0000, 0x24cc, 0x24cc, 0x24ac, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 
-	0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x24cc, 
-	0x24cc, 0x1c6b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 
-	0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x246b, 0x24cc, 0x24cc, 0x24cc, 0x0000, 
-	0x0000, 0x24ac, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0000, 
-	0x0000, 0x1ba9, 0x24cc, 0x24cc, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 
-	0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x24cc, 0x24cc, 0x1ba9, 0x0000, 
-	0x0000, 0x0040, 0x24cc, 0x24ac, 0x12a7, 0x0020, 0x0000, 0x1ccc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x0040, 0x0000, 
-	0x0000, 0x0000, 0x24ac, 0x24cc, 0x24cc, 0x0000, 0x0000, 0x1bea, 0x24cc, 0x1ccc, 0x1ccc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1ccc, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x1266, 0x24cc, 0x24cc, 0x08e2, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09e5, 0x24cc, 0x24cc, 0x1286, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x24ac, 0x24ac, 0x1cac, 0x0020, 0x0000, 0x1c0a, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x12e7, 0x24cc, 0x24ac, 0x0902, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x0020, 0x0000, 0x0a25, 0x24cc, 0x24cc, 0x1307, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24ac, 0x24cc, 0x0000, 0x0000, 0x0902, 0x24cc, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24ac, 0x0081, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0963, 0x24cc, 0x24cc, 0x1b89, 0x0000, 0x0020, 0x23ea, 0x1ccc, 0x24cc, 0x1123, 0x1123, 0x1103, 
-	0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x0902, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x1163, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 0x1103, 
-	0x1103, 0x1103, 0x1123, 0x24cc, 0x24ac, 0x1328, 0x0000, 0x0000, 0x1c6b, 0x24cc, 0x24cc, 0x09a4, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x248b, 0x24cc, 0x24cc, 0x00e2, 0x0000, 0x0000, 0x248b, 0x1ccc, 0x24ac, 0x0020, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0040, 0x24ac, 0x24cc, 0x1c6b, 0x0000, 0x0000, 0x11c5, 0x1ccc, 0x24cc, 0x24ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24ac, 0x0020, 0x0000, 0x0000, 0x24ac, 0x24ac, 0x24cc, 0x0921, 
-	0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0901, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x0962, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 0x0922, 
-	0x0921, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0020, 0x1cac, 0x24cc, 0x24cc, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0923, 0x24cc, 0x24cc, 0x24ab, 0x0000, 0x0000, 0x0000, 0x1ccc, 0x24ac, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x1ccc, 0x0000, 0x0000, 0x0000, 0x1cac, 0x24cc, 0x24cc, 0x0923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1308, 0x24cc, 0x24cc, 0x1c8b, 0x0000, 0x0000, 0x0000, 0x248b, 0x1cac, 
-	0x24cc, 0x24ac, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x23ea, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x244b, 0x246b, 0x2c4b, 0x24ac, 0x24ac, 
-	0x1ccc, 0x244b, 0x0000, 0x0020, 0x0000, 0x24ac, 0x24cc, 0x24cc, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c2a, 0x24cc, 0x24ac, 0x248b, 0x0000, 0x0000, 0x0000, 0x1c2a, 
-	0x24ac, 0x1ccc, 0x24ab, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x24ac, 0x1ccc, 0x24ac, 
-	0x1368, 0x0000, 0x0000, 0x0000, 0x24ab, 0x24cc, 0x24cc, 0x1c2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 0x24cc, 0x24ac, 0x1cac, 0x0000, 0x0000, 0x0000, 
-	0x1143, 0x24cc, 0x24ac, 0x24ac, 0x244b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1c6b, 0x1cac, 0x24ac, 0x24cc, 0x0081, 
-	0x0000, 0x0000, 0x0020, 0x1ccc, 0x24cc, 0x24cc, 0x24ac, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c0a, 0x24cc, 0x24cc, 0x1ccc, 0x08e2, 0x0000, 
-	0x0000, 0x0000, 0x1c0a, 0x24cc, 0x24cc, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24ac, 0x24cc, 0x24cc, 0x1b89, 0x0000, 0x0000, 
-	0x0000, 0x0963, 0x1ccc, 0x24cc, 0x24cc, 0x1c2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1328, 0x24cc, 0x24ac, 0x1ccc, 0x1b69, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x240a, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x1bca, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x240a, 0x24ac, 0x24cc, 0x24cc, 0x1328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0902, 0x24cc, 0x24cc, 0x24cc, 
-	0x24ac, 0x08e2, 0x0020, 0x0000, 0x0000, 0x0020, 0x2389, 0x24ac, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x1c4b, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1ccc, 0x22c8, 0x0020, 0x0000, 0x0000, 0x0000, 0x0922, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x0923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x248b, 0x24cc, 
-	0x24cc, 0x24cc, 0x24ac, 0x08c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0943, 0x246b, 0x24ac, 0x1c4a, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x1ccc, 0x24ac, 0x1c4b, 0x0943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0902, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x248b, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0984, 
-	0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1286, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1287, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 
-	0x09a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x12e7, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1246, 0x0881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24ac, 
-	0x24cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c2, 0x1aa7, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x1307, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x1266, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x24cc, 0x1c8b, 0x1c4b, 0x242b, 0x24ac, 
-	0x24cc, 0x242b, 0x1c4b, 0x1c8b, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x1286, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1ba9, 0x24ac, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24cc, 0x24ac, 0x1ba9, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0102, 0x0a25, 0x1c8b, 0x248b, 0x24ac, 0x24cc, 0x24cc, 
-	0x24cc, 0x24cc, 0x24ac, 0x248b, 0x1c8b, 0x0a25, 0x0923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-// 'maxim', 64x64px
-const uint16_t epd_bitmap_maxim [] PROGMEM = {
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 
-	0x18c3, 0x8bc7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x7305, 0x62a4, 0x6284, 0x6284, 0x6284, 0x6aa5, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x62a4, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c08, 0x630c, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0x2965, 
-	0x8ba7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x93c7, 0x9be7, 0x9c28, 0x8386, 0x62a4, 0x6aa5, 0x93c7, 0x9c28, 0x8366, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x7305, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x0000, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x9cf3, 0x5a64, 
-	0x9c28, 0x9c28, 0x9c08, 0x72e5, 0x8ba7, 0x9c28, 0x9c28, 0x6aa5, 0x6ac5, 0x9c28, 0x9c08, 0x6ac5, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x6284, 0x6284, 0x72e5, 0x8ba7, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x8ba7, 0x10a2, 0xffdf, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffdf, 0x0820, 0x9c28, 
-	0x9c28, 0x72e5, 0x72e5, 0x9c28, 0x9c28, 0x9c28, 0x6284, 0x9c07, 0x9c28, 0x72e5, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x7305, 
-	0x93e7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0000, 0xb596, 0xbdd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0x2104, 0x9c08, 0x9c08, 
-	0x6284, 0x8ba7, 0x9c28, 0x9c28, 0x9c28, 0x62a4, 0x9c28, 0x93e7, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x8386, 0x9c08, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x5a44, 0x18c3, 0xffdf, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd69a, 0x3142, 0x9c08, 0x6284, 
-	0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x8ba7, 0x9c28, 0x7b46, 0x62a4, 0x6284, 0x7b46, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x9c08, 0x9be7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0820, 0x9cf3, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7be, 0x0000, 0x9c28, 0x6284, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x72e5, 0x72e5, 0x62a4, 0x93e7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x93c7, 0x6ac5, 0x62a4, 0x6284, 0x62a4, 0x62a4, 0x72e5, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6ac5, 0x0020, 0xffff, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7be, 0x0000, 0x8366, 0x72e5, 0x9c07, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6ac5, 0x8ba7, 0x6284, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x7305, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x8366, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0000, 0xdedb, 0x2124, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc638, 0x18e3, 0x6284, 0x9c08, 0x8ba7, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x8366, 0x6284, 0x8346, 0x6284, 0x62a4, 0x8366, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x8346, 
-	0x6284, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x6aa5, 0x7b46, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x18a1, 0xd6ba, 0x2104, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x8c51, 0x41a2, 0x9c08, 0x6aa5, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x6284, 0x62a4, 0x6ac5, 0x7b46, 0x62a4, 0x62a4, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6284, 0x62a4, 
-	0x62a4, 0x62a4, 0x6aa4, 0x93c7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0000, 0xf7be, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0x0820, 0x62a4, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x8386, 
-	0x6284, 0x62a4, 0x6aa5, 0x9c08, 0x6284, 0x62a4, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x6284, 0x62a4, 0x62a4, 
-	0x6284, 0x93c7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x8ba7, 0x7b46, 0x72e5, 0x6aa4, 0x62a4, 0x6284, 
-	0x6284, 0x7305, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0020, 0xb596, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0x0000, 0x6aa4, 0x62a4, 0x8ba7, 0x9c28, 0x9c28, 0x6ac5, 0x62a4, 
-	0x62a4, 0x72e5, 0x9c28, 0x6284, 0x62a4, 0x62a4, 0x6aa4, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x62a4, 0x62a4, 0x6284, 0x8346, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x8b87, 0x72e5, 0x62a4, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 
-	0x7b26, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x2901, 0xf7be, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x73ae, 0x5223, 0x62a4, 0x6284, 0x9c28, 0x9c28, 0x6284, 0x6284, 0x72e5, 
-	0x9c28, 0x9c28, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x7b26, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6284, 0x6284, 0x72e5, 0x9c28, 0x9c28, 
-	0x8366, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x72e5, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x8366, 0xce79, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7be, 0x0000, 0x62a4, 0x62a4, 0x93c7, 0x9c08, 0x6284, 0x72e5, 0x9c28, 0x9c28, 
-	0x93e7, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x8b87, 0x9c28, 0x9c28, 0x9c28, 0x6284, 0x62a4, 0x9c08, 0x8ba7, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x6aa4, 0x7b05, 0x8ba7, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x93e7, 0xb5b6, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd69a, 0x41c3, 0x62a4, 0x6284, 0x9c28, 0x6284, 0x7305, 0x9c28, 0x9c28, 0x72e5, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x93c7, 0x9c28, 0x9c08, 0x62a4, 0x7b46, 0x9c08, 0x6284, 0x62a4, 0x62a4, 0x62a4, 
-	0x6284, 0x6284, 0x6ac5, 0x7b25, 0x8ba7, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x8c71, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x39c7, 0x62a4, 0x62a4, 0x93e7, 0x6284, 0x6284, 0x9c08, 0x7b46, 0x6284, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x93e7, 0x9c07, 0x62a4, 0x93e7, 0x93c7, 0x62a4, 0x62a4, 0x6284, 0x7305, 0x9c08, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x8c51, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x6b6d, 0x6284, 0x62a4, 0x8346, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x93c7, 0x6284, 0x8366, 0x9c07, 0x6284, 0x6284, 0x93e7, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x3982, 0xf79e, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x10a2, 0x6aa4, 0x72e5, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x9c08, 0x62a4, 0x8346, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x62a4, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0820, 0xdefb, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x528a, 0xf79e, 0x9492, 0x0000, 0x62a4, 0x62a4, 0x6284, 0x6aa5, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x8ba7, 0x6284, 0x93e7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x8386, 
-	0x6ac5, 0x6284, 0x6284, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x18c3, 0x632c, 0x0000, 
-	0x0000, 0x0000, 0x2124, 0xad55, 0x1060, 0x6284, 0x6aa4, 0x62a4, 0x62a4, 0x6284, 0x9c28, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x7b46, 0x6284, 0x62a4, 0x62a4, 
-	0x62a4, 0x6284, 0x6284, 0x9c08, 0x9c28, 0x8ba7, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x8386, 0x52aa, 0x18c3, 0x0000, 
-	0x0000, 0x0000, 0xe73c, 0x0000, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x9be7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x93e7, 0x6284, 0x6284, 0x6ae6, 0x940b, 0xacce, 
-	0xacef, 0x7b48, 0x9c28, 0x9c28, 0x93e7, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0840, 0xffdf, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0xffdf, 0x2901, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x9c08, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x93e7, 0x6284, 0x8ba8, 0xaccf, 0xd612, 0xff55, 0xacce, 
-	0x940b, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x8346, 0x0000, 0xf7be, 0x0000, 0x0000, 
-	0x0000, 0x1082, 0xe71c, 0x41c2, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6aa4, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x8ba7, 0x6284, 0xaccf, 0xe693, 0xff55, 0xff55, 0xff55, 0xa4ad, 
-	0x9c07, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x7b26, 0x93e7, 0x93e8, 0x6b6d, 0x4208, 0x0000, 
-	0x0000, 0xffdf, 0x0000, 0x62a4, 0x62a4, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x6ac5, 0x62a4, 0x62a4, 0x6ac5, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x8386, 0x6aa4, 0x6ae6, 0xde73, 0xff55, 0xff55, 0xff55, 0xff55, 0xff35, 0x72e5, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x7305, 0x6ac5, 0x9c28, 0x9c28, 0x0820, 0xffdf, 0x0000, 
-	0x5acb, 0x39c7, 0x62a4, 0x62a4, 0x62a4, 0x9c28, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x6284, 0x6284, 0x6284, 0x6aa5, 0x7b26, 
-	0x9c08, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x6aa5, 0x7305, 0x8366, 0x8ba7, 0x93e7, 0x9c08, 0x9c08, 0x9c08, 0x93e7, 0x8386, 
-	0x7305, 0x6aa5, 0x6284, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0x7327, 0xff35, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0x6ae5, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x6284, 0x6284, 0x9c28, 0x9c28, 0x9c28, 0x8ba7, 0x8410, 0x10a2, 
-	0xf7be, 0x0020, 0x62a4, 0x62a4, 0x93e7, 0x62a4, 0x62a4, 0x62a4, 0x6aa5, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x8ba7, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0x9c6c, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xc56f, 0x8366, 0x9c28, 
-	0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x6aa5, 0x62a4, 0x72e5, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0000, 0xc618, 
-	0xe73c, 0x41a2, 0x6aa4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6aa5, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6ac5, 0x942c, 
-	0x942b, 0x6aa5, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x6284, 0x6ac5, 0x9c4c, 0xeed4, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0x6284, 0x6284, 0x62a4, 
-	0x7305, 0x8386, 0x7b46, 0x6ac5, 0x6284, 0x62a4, 0x62a4, 0x8366, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x20e1, 0xffdf, 
-	0xc638, 0x632c, 0x18e3, 0x0000, 0x0840, 0x62a4, 0x62a4, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c08, 0x7305, 0x6284, 0xa4ae, 0xacef, 
-	0xacef, 0xacef, 0xacef, 0xacce, 0x942c, 0x8389, 0x7307, 0x6ac5, 0x6aa5, 0x6aa5, 0x62a4, 0x6aa5, 0x6ac5, 0x7306, 0x83a9, 0x9c2a, 
-	0xad0f, 0xc5b1, 0xeed4, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0x8388, 0x62a4, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x72e5, 0x93e7, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6284, 0xef7d, 
-	0x0000, 0x0861, 0x4a49, 0xd69a, 0x3962, 0x62a4, 0x62a4, 0x7b46, 0x8b86, 0x7305, 0x6284, 0x62a4, 0x6284, 0xaccf, 0xacef, 0xacef, 
-	0xacef, 0xacef, 0xc5b1, 0xaccf, 0xacef, 0xacef, 0xacef, 0xf715, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xe693, 0x62a4, 
-	0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6aa5, 0x9c07, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x7b25, 0xef5d, 
-	0x0000, 0x0000, 0xffdf, 0x0000, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0xaccf, 0xacef, 0xacef, 0xacef, 
-	0xcdb1, 0xff55, 0xff55, 0xff55, 0xaccf, 0xacef, 0xacef, 0xeeb4, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xcdb0, 0x62a4, 
-	0x62a4, 0x6284, 0x62a4, 0x7306, 0x6aa5, 0x7b05, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x6284, 0xef7d, 
-	0x0000, 0x0000, 0xffdf, 0x0000, 0x5a44, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x6ac5, 0xacef, 0xacef, 0xacef, 
-	0xacef, 0xaccf, 0xaccf, 0xcdd1, 0xff55, 0xaccf, 0xacef, 0xbd70, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xde32, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff35, 0xde73, 0xd612, 0xe6b3, 0xff55, 0xff55, 0xff55, 0xff55, 0xf6f4, 
-	0xff35, 0xacce, 0xacce, 0x6aa5, 0x62a4, 0x8ba7, 0x9c28, 0x9c07, 0x9c07, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x1880, 0xffdf, 
-	0x0000, 0x0000, 0x0841, 0xf7be, 0x4228, 0x0000, 0x1080, 0x41a2, 0x62a4, 0x62a4, 0x62a4, 0x62a4, 0x7b27, 0xacef, 0xacef, 0xacef, 
-	0xacef, 0xacef, 0xacef, 0xacef, 0xacce, 0xeed4, 0xaccf, 0x8bcb, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xc5b1, 0xff55, 0xff55, 0xff55, 0xff55, 0xe693, 0xa48d, 0xa4ae, 0xeef4, 0xff55, 0xff55, 0xff35, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xbd70, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0xacab, 0xff55, 0xff55, 0xf715, 0x9c07, 0x9c28, 0x9c28, 0x9c28, 0x10a2, 0x94b2, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0xd6ba, 0xffff, 0x3142, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0xacef, 0xacef, 0xacce, 0xb52f, 
-	0xd5f2, 0xe693, 0xeed4, 0xeeb4, 0xde73, 0xc591, 0x6247, 0x940c, 0xa48d, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xf715, 
-	0xe6b3, 0xff75, 0xeeb4, 0x8329, 0x72e8, 0xa4ae, 0xa4ae, 0xa4ae, 0xcdd1, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0x6ae6, 0x62a4, 0x62a4, 0x62a4, 0x8388, 0xff55, 0xff55, 0xff55, 0xff55, 0xcdae, 0x9c28, 0x9c28, 0x0860, 0xf79e, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffdf, 0x2921, 0x6264, 0x6284, 0x62a4, 0xacce, 0xacef, 0xacef, 0xff35, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff35, 0x836a, 0x38c2, 0xde53, 0xff35, 0xff55, 0xff55, 0xeed4, 0x8bab, 
-	0xc570, 0xe693, 0xff35, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xde53, 0xcdd1, 0xf6f4, 0xff55, 0xff55, 0xff55, 
-	0xf6f4, 0x6284, 0x62a4, 0x62a4, 0x62a4, 0xb530, 0xff35, 0xaccf, 0xacef, 0xff55, 0xe692, 0x9c28, 0x0000, 0xdedb, 0x2124, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7be, 0x0000, 0x2124, 0x0840, 0x83a9, 0xacef, 0xacef, 0xacef, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xf6f4, 0xa4ae, 0xad0f, 0xff55, 0xeef4, 0xcdb1, 0xc590, 0xf6f4, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xff55, 0xeef4, 0xbd70, 0xb52f, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0x72e5, 0x62a4, 0x62a4, 0x62a4, 0x6284, 0xaccf, 0xff55, 0xf6f4, 0xaccf, 0xff55, 0xc5b0, 0x0861, 0xffff, 0x10a2, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cf3, 0xce79, 0x0000, 0xacef, 0xacef, 0xacef, 0xaccf, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xff55, 0xaccf, 0xc5b1, 0xff35, 0xff55, 0xff35, 0xff35, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xff35, 0xbd70, 0xe693, 0xff55, 0xff55, 0xff55, 0xaccf, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0x7b47, 0x62a4, 0x62a4, 0x6284, 0x62a4, 0xacef, 0xeef4, 0xb50f, 0xb530, 0xff55, 0x4a46, 0xf7be, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd6ba, 0x0000, 0x83a9, 0xacef, 0xacef, 0xaccf, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xb52f, 0xaccf, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff35, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xaccf, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff35, 
-	0x6284, 0x6284, 0x62a4, 0x6284, 0xc58f, 0xe693, 0xaccf, 0xacef, 0xeeb4, 0xff55, 0x0000, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0x4228, 0x5203, 0x6aa5, 0xacce, 0xacef, 0xacef, 0xeed4, 0xff55, 
-	0xff55, 0xff55, 0xff55, 0xaccf, 0x4103, 0xeeb4, 0xff55, 0xff55, 0xff55, 0xff55, 0xff35, 0xd5f2, 0xacef, 0xaccf, 0xacef, 0xacef, 
-	0xacef, 0xacef, 0x4123, 0x6226, 0xb4ce, 0xff55, 0xff35, 0xaccf, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xaccc, 0xbd6e, 0xf714, 0xeeb3, 0xeeb3, 0xf714, 0xde53, 0xf715, 0xad0f, 0x8c71, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x2124, 0x3121, 0x6284, 0x6284, 0xacef, 0xacef, 0xaccf, 0xff55, 
-	0xff55, 0xff55, 0xf715, 0xacef, 0x9c4c, 0x7327, 0xacef, 0xad0f, 0xacef, 0x9c2d, 0xd677, 0xe71a, 0xef5c, 0xef7c, 0xef5c, 0xe6fa, 
-	0xce36, 0xb530, 0xacce, 0xa4ae, 0x4103, 0x3041, 0xacef, 0xbd70, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xf714, 0xa449, 0xa428, 0x9c08, 0x9c08, 0x9c07, 0xe6b4, 0x3186, 0x9cf3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xef7d, 0xb596, 0xb596, 0x0020, 0xacef, 0xacef, 0xacef, 
-	0xff55, 0xff55, 0xff55, 0xaccf, 0x940b, 0x7b47, 0x6a67, 0x3041, 0x3041, 0x3041, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xbd92, 0xa4ae, 0x7306, 0x9c6d, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xe651, 0xa469, 0x9c28, 0x9c28, 0x9c28, 0x9c28, 0x0000, 0xf7be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xf7be, 0x0820, 0x9c29, 0x6284, 
-	0xb50f, 0xff55, 0xff55, 0xff55, 0xacef, 0x9c6c, 0x72a8, 0x3041, 0x3041, 0x3041, 0x838e, 0x9c50, 0x9c50, 0xa4b2, 0xb514, 0xc5d6, 
-	0xdeba, 0xf77d, 0xffdf, 0xffff, 0xffff, 0xacef, 0xa48d, 0x83a9, 0xeed4, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xff55, 0xbd2c, 0x9c08, 0x9c08, 0xbd0c, 0x9c28, 0x93e7, 0x632c, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffdf, 0x0000, 0x9c08, 0x7b25, 
-	0x6aa5, 0xacee, 0xff55, 0xff55, 0x72e6, 0xacef, 0x72e9, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x2820, 0x4945, 0xacef, 0x6ac5, 0xacef, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xff55, 0xde30, 0xc56e, 0x9c28, 0x9c28, 0x9c28, 0x0000, 0x3186, 0xffdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xf7be, 0x0000, 0x5a64, 
-	0x6284, 0x62a4, 0xb52f, 0xff55, 0x7b27, 0xacef, 0x72e9, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0xacef, 0x6ac5, 0xacef, 0xf715, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xeed3, 0xcdaf, 0x9c28, 0x9c28, 0x9c28, 0x4a03, 0xd6ba, 0x8c71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0xdedb, 0x0000, 
-	0x49c3, 0x6ac5, 0xaccf, 0xacef, 0xacce, 0xaccf, 0x72e9, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x93ec, 0x8389, 0x9c6d, 0xaccf, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 
-	0xde31, 0xcdae, 0xb4eb, 0x9c28, 0x2901, 0x4a69, 0xa534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0xffff, 
-	0x0000, 0x3982, 0x62a4, 0x7306, 0xacef, 0xacce, 0x6a67, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x4944, 0xa48d, 0x8368, 0xacce, 0xc590, 0xff55, 0xff55, 0xff55, 0xff55, 0xde10, 
-	0x9c08, 0x9c28, 0x9c28, 0x0020, 0xef5d, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 
-	0xf7be, 0x0000, 0x6aa4, 0x6284, 0x8388, 0xa48d, 0x59e6, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0xacef, 0x6284, 0x8389, 0xacef, 0xde53, 0xff55, 0xeed3, 0x6284, 0x7306, 
-	0x6aa5, 0x0840, 0x0000, 0x8c51, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x528a, 0xc618, 0x0000, 0x6aa4, 0x6284, 0x940b, 0x4964, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x2841, 0xacef, 0xa4ce, 0x62a4, 0xacef, 0xacef, 0xacef, 0x8bea, 0x62a4, 0x62a4, 
-	0x62a4, 0x2965, 0xa534, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0xc618, 0x0020, 0x0020, 0x2901, 0x6284, 0x40e3, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0xacef, 0xacef, 0xacef, 0x7b68, 0x6284, 0x62a4, 0x6284, 0x5223, 0x0000, 
-	0x0000, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x8c71, 0xad55, 0xe73c, 0x20c1, 0x38a2, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x3041, 0x40e2, 0x92e5, 0x5983, 0x82a5, 0x82c5, 0xacef, 0xacef, 0xacef, 0x6284, 0x62a4, 0x62a4, 0x0000, 0x4208, 0xef5d, 
-	0x8c51, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xa514, 0x18e3, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x3041, 0x8ac5, 0xbbe7, 0xbbe7, 0x9b46, 0xbbe7, 0x8ae5, 0xacef, 0xacef, 0x7306, 0x942b, 0x62a4, 0x3142, 0x4208, 0x528a, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x1082, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0x5142, 0xbbe7, 0xbbe7, 0xbbe7, 0xb3e7, 0xbbe7, 0x9b46, 0xaccf, 0xacef, 0x6ae6, 0x62a4, 0x0000, 0x41c3, 0x4a69, 0x39c7, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0x0000, 0x2820, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 
-	0xb3c7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xb3c7, 0x8bca, 0x62a4, 0x6264, 0x0000, 0x4a49, 0xef7d, 0xdefb, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x8c51, 0x0000, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3881, 
-	0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xa46c, 0xacce, 0x2921, 0x0000, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xad75, 0x0840, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x61e3, 
-	0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0x9bca, 0x62c8, 0xef5d, 0xf7be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xce59, 0x1061, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x82a4, 
-	0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0x8b06, 0x0860, 0xf7be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0x18c2, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x3041, 0x82a4, 
-	0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0x7a44, 0x3040, 0x0000, 0xa514, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x3164, 0x3041, 0x3041, 0x2841, 0x4965, 0x836d, 0xacd3, 0xb555, 0x9410, 0x51a6, 0x82a5, 
-	0x9326, 0xbbe7, 0xbbe7, 0xbbe7, 0xbbe7, 0xaba7, 0x3041, 0x3041, 0x0000, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0xf7be, 0x41e5, 0x3041, 0x4943, 0xffbe, 0xffff, 0xffdf, 0x38a2, 0x2820, 0x3041, 0x3041, 0x61a3, 
-	0x82c5, 0x82c5, 0x8ae5, 0x8b05, 0x8ae5, 0x3041, 0x3041, 0x3041, 0x0000, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0xce79, 0x1082, 0x8beb, 0x7ae8, 0xa48d, 0xcdd1, 0xcdb1, 0xffdd, 0xbd73, 0x3061, 0x2820, 0x2840, 0x2840, 
-	0x38a1, 0x7224, 0x7a84, 0x5142, 0x2820, 0x2820, 0x3882, 0x5a06, 0x0000, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0xdefb, 0x62c8, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xacce, 0x0840, 0xdefb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0xbdd7, 0x0020, 0xacef, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff55, 0xff35, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xacef, 0x2103, 0xf7be, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0xe73c, 0x4a26, 0xacef, 0xf715, 0xeed4, 0xe6b4, 0xe6b4, 0xe693, 0xff55, 0xff55, 0xff55, 0xff55, 0xff56, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad0f, 0x3984, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x4a69, 0x0841, 0x6284, 0x6284, 0x62a4, 0x6284, 0xa4ae, 0xacef, 0xacef, 0xacef, 0xcdd1, 0xff55, 0xff55, 0xff55, 0xff77, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb510, 0x4206, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x4a49, 0x4a49, 0x5223, 0x93e7, 0x8b87, 0x62a4, 0x7306, 0xacef, 0xacef, 0xacef, 0xe6b3, 0xff15, 0xff55, 0xff55, 0xff55, 
-	0xff9d, 0xe63d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad10, 0x5aa8, 0xffdf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-// 'finanzfluss', 64x64px
-const uint16_t epd_bitmap_finanzfluss [] PROGMEM = {
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xf7bf, 0xffff, 0x953d, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x84bc, 0xffff, 0xf7bf, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x6c1c, 0xffff, 0xffff, 0xffff, 0x539b, 0x4b7b, 0x4b3b, 0x5bdc, 0x9d7d, 0xd6de, 0xef9f, 
-	0xef9f, 0xd6de, 0xa59d, 0x63dc, 0x4b3b, 0x4b7b, 0x537b, 0xffff, 0xffff, 0xffff, 0x7c9c, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xd6fe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79f, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xef7f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x5bdc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa59d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x9d7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6c3c, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xce9e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b7b, 0x4b5b, 0xf7bf, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xe75f, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xdf1f, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73f, 0xaddd, 0x4b5b, 0xaddd, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xf7bf, 0xe73f, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b7b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0x4b7b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x63fc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x745c, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0xe73f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bf, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0xb5fe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc67e, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x5bbc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe75f, 0xc67e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x641c, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8cfd, 0x4b5b, 0x4b5b, 0x433b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b7b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0xc67e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7cbc, 0x4b5b, 0x4b5b, 0x4b5b, 0x63fc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x951d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdf1e, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b7b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x539b, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6c1c, 0x4b5b, 0x8d1d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79f, 0x5bdb, 0xcebe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x641c, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xef7f, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xf7bf, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xaddd, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xc67e, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc67e, 0x5bdc, 0x4b5b, 
-	0x4b5b, 0x5bdc, 0xbe3e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bf, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xf79f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4b7b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x7c9c, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7f, 0x431b, 0x4b5b, 0x4b5b, 0x4b7b, 0x84dc, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0x951d, 0x4b5b, 0x4b5b, 0x4b5b, 0x433b, 0xe73f, 0xffff, 0xffff, 0xffff, 0xffff, 0x84dd, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x9d7d, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xb5fe, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x7c9c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9d7d, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0xb61e, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xc67e, 0x4b7b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 
-	0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b, 0x4b5b
-};
-
-// 'lidi', 64x64px
-const uint16_t epd_bitmap_lidi [] PROGMEM = {
-	0x8cd3, 0x2965, 0x2925, 0x2945, 0x2945, 0x3145, 0x3145, 0x3145, 0x3145, 0x2945, 0x3165, 0x73ae, 0x1924, 0x1924, 0x2186, 0x2186, 
-	0x2165, 0x31e7, 0x39c6, 0x41e7, 0x5207, 0x5a07, 0x6228, 0x6a48, 0x6a48, 0x6a68, 0x7289, 0x72a9, 0x7ac9, 0x82ea, 0x830a, 0x832a, 
-	0x8b4b, 0x938b, 0x93ab, 0x9bec, 0xa40d, 0xa42d, 0xac6e, 0xb4d0, 0xa46f, 0x7b8d, 0x4249, 0x39e8, 0x4248, 0xc678, 0xce79, 0x9cd4, 
-	0xa556, 0xdf3d, 0xc6bb, 0x7452, 0xa5da, 0x5c13, 0xd77e, 0xdf7e, 0xcf3d, 0xefbf, 0xffff, 0xd79d, 0xc77c, 0xbf5c, 0xb6fb, 0xb71b, 
-	0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x3165, 0x3165, 0x3145, 0x2925, 0x3145, 0x8c50, 0x4228, 0x1924, 0x2186, 0x2185, 0x2165, 
-	0x31c7, 0x29a6, 0x41e7, 0x4a07, 0x5207, 0x5a28, 0x6228, 0x6a28, 0x6a48, 0x6a48, 0x7268, 0x72a9, 0x7ac9, 0x82ea, 0x832a, 0x8b4b, 
-	0x938b, 0x9bcc, 0x9bec, 0xa42d, 0xac4e, 0xb46f, 0xbcd0, 0xc511, 0xbd12, 0x9c50, 0x6b6d, 0x426a, 0x3a29, 0x63af, 0x7c51, 0xad97, 
-	0xd6fc, 0xcedc, 0xf7df, 0xcf3c, 0xc73c, 0x9e79, 0xcf5d, 0xdf9e, 0xcf3d, 0xdf9e, 0xe7be, 0xc75c, 0xc77d, 0xcf9d, 0xd79d, 0xdfde, 
-	0x2945, 0x2945, 0x2925, 0x2945, 0x3145, 0x3165, 0x3145, 0x3165, 0x3145, 0x3986, 0xb594, 0x2144, 0x2166, 0x2185, 0x2165, 0x2986, 
-	0x2986, 0x39e7, 0x41e7, 0x5207, 0x5a07, 0x5a28, 0x6228, 0x6248, 0x6a48, 0x6a68, 0x7268, 0x72a9, 0x82c9, 0x830a, 0x8b4b, 0x938b, 
-	0x938b, 0x9bcc, 0x9bec, 0xa42d, 0xac6e, 0xb4af, 0xbcd0, 0xc532, 0xc553, 0xbd53, 0x8c30, 0x4a8a, 0x428a, 0x530c, 0x8c92, 0xbe38, 
-	0xbe7a, 0xef7e, 0xe77d, 0xbf1b, 0xc77c, 0xc75c, 0xc73c, 0xd77d, 0xcf5c, 0xcf7d, 0xd77c, 0xe7de, 0xe7fe, 0xcf7c, 0xd7bd, 0xc75c, 
-	0x2945, 0x2945, 0x3165, 0x3165, 0x2965, 0x3145, 0x3145, 0x3965, 0x4186, 0xc5b5, 0xa513, 0x2165, 0x2186, 0x2165, 0x2986, 0x29a6, 
-	0x39e7, 0x41e7, 0x5207, 0x5207, 0x5a07, 0x6208, 0x6228, 0x6228, 0x6a68, 0x6a68, 0x7289, 0x7aa9, 0x830a, 0x8b2a, 0x8b6b, 0x938b, 
-	0x93ab, 0x9bcc, 0x9bec, 0xa42d, 0xac6e, 0xb48f, 0xbcd0, 0xc532, 0xcd74, 0xcd94, 0xa4d2, 0x6b6e, 0x634e, 0x4acc, 0xb5d7, 0x8451, 
-	0x9516, 0xf7df, 0xd75c, 0xc75c, 0xbf3c, 0xcf7d, 0xdfbe, 0xdfbe, 0xcf7c, 0xcf5c, 0xcf7c, 0xdf9d, 0xcf5c, 0xc77c, 0xcf7c, 0xd79d, 
-	0x2924, 0x2945, 0x2944, 0x2945, 0x3145, 0x3145, 0x4165, 0x49a6, 0x83ae, 0xb554, 0x73ce, 0x2986, 0x2165, 0x2165, 0x2986, 0x39c6, 
-	0x4a07, 0x4a07, 0x5207, 0x5a28, 0x5a28, 0x6228, 0x6248, 0x6a48, 0x6a68, 0x7289, 0x7aa9, 0x82e9, 0x8b4a, 0x8b4b, 0x938b, 0x938b, 
-	0x9bac, 0x9bcc, 0xa40c, 0xa42d, 0xac6e, 0xb4af, 0xbcf1, 0xc532, 0xcd74, 0xcdb5, 0xbd74, 0x9cd3, 0x632d, 0x6baf, 0x94f4, 0xa555, 
-	0x9d96, 0xcf3c, 0xdf9d, 0xeffe, 0xe7fe, 0xc77c, 0xd7bd, 0xcf7c, 0xd79d, 0xcf7c, 0xdfbe, 0xcf5c, 0xcf7d, 0xd7bd, 0xcf7c, 0xcf9c, 
-	0x2945, 0x2945, 0x2945, 0x3145, 0x3985, 0x4986, 0x59c7, 0x6228, 0xad33, 0xce58, 0x31e7, 0x2165, 0x2186, 0x2165, 0x31c7, 0x4207, 
-	0x4a07, 0x5228, 0x5a28, 0x5207, 0x5a28, 0x6228, 0x6a49, 0x6a69, 0x7269, 0x7aa9, 0x82ca, 0x8b2a, 0x936b, 0x938b, 0x938c, 0x9bac, 
-	0x9bec, 0xa40d, 0xa40d, 0xa42d, 0xb46f, 0xbcb0, 0xc4f1, 0xcd53, 0xcd94, 0xd5d6, 0xcdd6, 0x9470, 0x5b0c, 0x94f4, 0x94f4, 0xbe18, 
-	0x9595, 0xef9e, 0xbf1b, 0xd77d, 0xc73b, 0xd79d, 0xcf7d, 0xcf9d, 0xcf5c, 0xd77d, 0xcf7d, 0xbefb, 0xd79d, 0xc75c, 0xc73b, 0xe7de, 
-	0x2945, 0x2924, 0x3165, 0x4186, 0x51c6, 0x6207, 0x7269, 0x72ca, 0xdefb, 0xc658, 0x29a6, 0x2165, 0x2145, 0x2965, 0x39c6, 0x49e7, 
-	0x4a07, 0x5208, 0x51e7, 0x5208, 0x5a28, 0x6228, 0x6228, 0x6a69, 0x72a9, 0x7aca, 0x830a, 0x936b, 0x93ac, 0x9bcd, 0x9bed, 0x9bed, 
-	0xa40d, 0xa40d, 0xa40d, 0xac2e, 0xb48f, 0xbcb0, 0xbcd1, 0xcd53, 0xcdd5, 0xd5d6, 0xd5f7, 0xbd54, 0x9cb2, 0x7c31, 0x9d14, 0x7c92, 
-	0x9db6, 0xf7df, 0xd77d, 0xc75c, 0xcf7c, 0xd79d, 0xcf9d, 0xd79d, 0xe7de, 0xefff, 0xcf5d, 0xbefc, 0xdfbe, 0xbf3c, 0xbf1b, 0xcf7c, 
-	0x3145, 0x3965, 0x49a6, 0x59e7, 0x6228, 0x6a69, 0x5228, 0x29c7, 0x8492, 0xb5f7, 0x2186, 0x2145, 0x2145, 0x29a6, 0x41e7, 0x4a07, 
-	0x49e7, 0x49e7, 0x49c7, 0x51e7, 0x51c7, 0x51e7, 0x51e7, 0x5a07, 0x7289, 0x7aea, 0x8b2b, 0x936c, 0x9bed, 0xa40e, 0xa40e, 0xa40e, 
-	0xa42e, 0xa42e, 0xac2e, 0xb46f, 0xbc90, 0xbcb0, 0xc4f1, 0xcd53, 0xd5d6, 0xd5f6, 0xd5f7, 0xcdf6, 0x9450, 0x5aec, 0xa535, 0x8cd3, 
-	0xc69a, 0xf7df, 0xcf3c, 0xc73c, 0xd79d, 0xc75c, 0xc73b, 0xd79d, 0xdfbe, 0xc73c, 0xcf5c, 0xbefb, 0xcf7d, 0xb6fb, 0xc73c, 0xcf5c, 
-	0x4186, 0x51c6, 0x6228, 0x6248, 0x5228, 0x2986, 0x3209, 0x4aed, 0xdf3d, 0xfffe, 0x2186, 0x2165, 0x2145, 0x31a6, 0x41e7, 0x4a07, 
-	0x49c7, 0x5208, 0x5a28, 0x6248, 0x6249, 0x5a28, 0x51e7, 0x6248, 0x6a89, 0x7aea, 0x8b4b, 0x938c, 0x9bed, 0xa40e, 0xa40e, 0xac2e, 
-	0xac6f, 0xac6f, 0xb46f, 0xbc90, 0xbcb0, 0xbcb0, 0xc4f2, 0xcd33, 0xcd75, 0xcdb6, 0xd5f7, 0xd638, 0xa4d2, 0x7bce, 0xa534, 0x9d34, 
-	0xa5d7, 0xcf3c, 0xc73c, 0xcf3c, 0xcf7d, 0xbf3c, 0xbf3c, 0xcf7c, 0xcf9d, 0xcf7d, 0xcf7d, 0xcf7d, 0xcf7d, 0xc75c, 0xe7de, 0xcf3c, 
-	0x5a07, 0x6a68, 0x5a28, 0x2165, 0x29c7, 0x322a, 0xd6fc, 0xffff, 0xb5d6, 0x7430, 0x2165, 0x2165, 0x2145, 0x31a6, 0x4a28, 0x49e7, 
-	0x5208, 0x6249, 0x6a69, 0x72a9, 0x7aea, 0x7b0a, 0x72c9, 0x72a9, 0x72c9, 0x7aca, 0x832a, 0x8b4b, 0x938c, 0x9bcd, 0xa42e, 0xac4f, 
-	0xb490, 0xb490, 0xb4b0, 0xb4b0, 0xb490, 0xb48f, 0xbcb0, 0xc4f1, 0xc512, 0xc554, 0xd5f7, 0xd659, 0xcdf7, 0xad33, 0x8450, 0xa575, 
-	0x8d14, 0xbedb, 0xbf1b, 0xbefb, 0xc75d, 0xaefb, 0xc73c, 0xc73c, 0xcf7d, 0xc75c, 0xbf3b, 0xcf9d, 0xcf7c, 0xcf9d, 0xcf7d, 0xc73c, 
-	0x5a48, 0x2965, 0x2165, 0x29c7, 0x8d14, 0xffdf, 0x8cb1, 0x4aea, 0xdf3c, 0x63ae, 0x2166, 0x2165, 0x2145, 0x39c7, 0x4a07, 0x49e7, 
-	0x6249, 0x6a69, 0x7289, 0x7aa9, 0x7aea, 0x7b0a, 0x7b0a, 0x7ae9, 0x7ae9, 0x7aea, 0x7ac9, 0x830a, 0x8b4b, 0x938c, 0xa40d, 0xac6f, 
-	0xbcb0, 0xbcf1, 0xbcd1, 0xbcd0, 0xb48f, 0xb48f, 0xa42d, 0xa40d, 0xb46f, 0xbd12, 0xc575, 0xd659, 0xde79, 0xad12, 0x7bce, 0xa554, 
-	0x9d76, 0xc6fc, 0xc71b, 0xd79d, 0xcf7d, 0xc75c, 0xefdf, 0xc73c, 0xcf5c, 0xd79d, 0xc75c, 0xcf7c, 0xcf7c, 0xcf7d, 0xcf7d, 0xc73b, 
-	0x2145, 0x2165, 0x31e7, 0x52cb, 0x3a48, 0x3228, 0x3228, 0x7430, 0xb618, 0x3208, 0x2145, 0x2145, 0x2125, 0x39c7, 0x4a07, 0x5208, 
-	0x6249, 0x6a69, 0x7289, 0x72a9, 0x72c9, 0x7aea, 0x7b0a, 0x7b0a, 0x7ac9, 0x72ca, 0x72a9, 0x7aca, 0x82ea, 0x8b2b, 0x9bed, 0xb46f, 
-	0xc511, 0xc532, 0xc532, 0xc532, 0xbcf0, 0xbcd0, 0xac6e, 0xac4e, 0xb46f, 0xbcd1, 0xc574, 0xce18, 0xdeba, 0xad13, 0x9c71, 0x9d13, 
-	0x9534, 0x9dd7, 0xb6ba, 0xd79d, 0xc75c, 0xcf7d, 0xcf5c, 0xcf5c, 0xd77d, 0xcf7c, 0xcf5c, 0xcf3c, 0xcf5c, 0xcf7d, 0xd79d, 0xd77d, 
-	0x29c7, 0x426a, 0x29c6, 0x29c6, 0x29c7, 0x21a7, 0x532c, 0x2a08, 0xd6fb, 0x29c7, 0x2145, 0x2145, 0x2145, 0x41e7, 0x4207, 0x5228, 
-	0x6249, 0x6a69, 0x6248, 0x6248, 0x5a28, 0x6248, 0x6a89, 0x72e9, 0x72c9, 0x72c9, 0x72a9, 0x7289, 0x7289, 0x7aca, 0x938c, 0xb46f, 
-	0xcd52, 0xd593, 0xd593, 0xcd52, 0xc511, 0xbcd0, 0xbcd0, 0xbcf1, 0xc532, 0xcd74, 0xde16, 0xde79, 0xd659, 0xb574, 0xbd94, 0x8430, 
-	0xa596, 0x8d35, 0xbefb, 0xcf7c, 0xcf7c, 0xcf7d, 0xcf7d, 0xcf5c, 0xd79d, 0xcf7d, 0xcf7d, 0xd75d, 0xd77d, 0xdf9d, 0xdf9e, 0xe7de, 
-	0x29a6, 0x29c7, 0x21c7, 0x29c7, 0x29c7, 0x21c7, 0x29c8, 0x638f, 0xf7be, 0x2186, 0x2145, 0x1945, 0x2965, 0x41e7, 0x4a07, 0x5a28, 
-	0x6248, 0x6248, 0x51e7, 0x4a08, 0x41c7, 0x3986, 0x39c7, 0x5228, 0x5a28, 0x6a89, 0x6aa9, 0x6249, 0x6a49, 0x7aa9, 0x8b2b, 0xb44e, 
-	0xcd72, 0xddf4, 0xd5b4, 0xc531, 0xb4af, 0xac2d, 0xac4e, 0xbcd0, 0xc531, 0xd5b4, 0xde37, 0xe69a, 0xe6ba, 0xc5f6, 0xb575, 0x94b2, 
-	0xb618, 0x9dd7, 0xbedb, 0xc73c, 0xc73c, 0xd79d, 0xd79d, 0xdfbd, 0xcf7c, 0xc75c, 0xc75c, 0xdf9e, 0xdf9d, 0xe7be, 0xe7be, 0xe7be, 
-	0x31e7, 0x29e7, 0x3269, 0x3228, 0x21c7, 0x29e8, 0x7c72, 0xe75d, 0xadb7, 0x2165, 0x2145, 0x1924, 0x2965, 0x41e7, 0x4a08, 0x5a48, 
-	0x6269, 0x5a28, 0x41c6, 0x2945, 0x2986, 0x1945, 0x2165, 0x4228, 0x39c6, 0x49c7, 0x6289, 0x6228, 0x6228, 0x7269, 0x8b0a, 0xb44e, 
-	0xcd73, 0xddf4, 0xd5b3, 0xbcd0, 0xac4e, 0x9b8b, 0x936b, 0xac4e, 0xc531, 0xddf4, 0xe678, 0xeeba, 0xeefb, 0xd638, 0x9cf3, 0xad54, 
-	0xa595, 0xa618, 0xcf3c, 0xcf3c, 0xd77d, 0xdf9d, 0xdf9e, 0xe7de, 0xcf5c, 0xc73c, 0xcf5c, 0xd77d, 0xe7be, 0xe7be, 0xe7de, 0xe7be, 
-	0x29a6, 0x3a69, 0x430c, 0x3269, 0x2a09, 0x42cc, 0x8cd4, 0xe77e, 0x84d5, 0x2186, 0x2166, 0x1925, 0x2966, 0x41e7, 0x5228, 0x6269, 
-	0x6269, 0x5207, 0x3986, 0x4228, 0x29a6, 0x2145, 0x1904, 0x2986, 0x5aeb, 0x3986, 0x5a49, 0x5a28, 0x6208, 0x7269, 0x82ea, 0xac0e, 
-	0xd594, 0xddf4, 0xcd52, 0xbcd0, 0x830a, 0x7ac9, 0x5a47, 0x6ac9, 0xac6f, 0xd5b4, 0xe698, 0xeeda, 0xef1b, 0xde99, 0x8c91, 0xb595, 
-	0x94f3, 0x9dd7, 0xbf1b, 0xdf9d, 0xdfbe, 0xe7de, 0xe7be, 0xdf7d, 0xd77d, 0xcf5c, 0xd79d, 0xe7be, 0xefdf, 0xefde, 0xe7be, 0xf7ff, 
-	0x29a6, 0x3a4a, 0x432d, 0x3aab, 0x3acc, 0x536f, 0xa597, 0xbe59, 0xdf5e, 0x2187, 0x1945, 0x1925, 0x2966, 0x4a08, 0x5228, 0x6269, 
-	0x6248, 0x6248, 0x5a28, 0x51e7, 0x4a08, 0x2145, 0x2124, 0x4208, 0x4a08, 0x49c7, 0x5a48, 0x5a07, 0x6228, 0x7289, 0x82ea, 0xa3cd, 
-	0xcd74, 0xddd5, 0xc511, 0x832a, 0x836c, 0x5a89, 0x31a6, 0x4228, 0xce57, 0x9c2f, 0xde16, 0xf6fa, 0xef3c, 0xe6da, 0x73cf, 0xb5b5, 
-	0x9d34, 0xbeba, 0xcf5d, 0xdf9d, 0xefde, 0xefde, 0xe7de, 0xe79e, 0xe7be, 0xefdf, 0xefde, 0xe7be, 0xf7df, 0xf7df, 0xf7df, 0xf7ff, 
-	0x29a7, 0x4aed, 0x4b6f, 0x3aec, 0x4b4e, 0x63f1, 0xcebb, 0xc69a, 0xd73d, 0x2187, 0x2145, 0x1925, 0x3186, 0x4a08, 0x5a48, 0x6289, 
-	0x6aa9, 0x6a89, 0x6a89, 0x6a69, 0x5a28, 0x5208, 0x5208, 0x5a08, 0x5a28, 0x5a28, 0x6248, 0x5a08, 0x6228, 0x7289, 0x8aeb, 0xabce, 
-	0xd5b6, 0xddf6, 0xcd32, 0x8b2b, 0x7b2b, 0x5268, 0x31a6, 0x7c0f, 0xdeda, 0xd5f6, 0xcd94, 0xeefa, 0xef3c, 0xe6fb, 0x636e, 0xad95, 
-	0xb5f7, 0xc6da, 0xdf7d, 0xefdf, 0xf7df, 0xf7df, 0xefbe, 0xf7df, 0xf7ff, 0xffff, 0xf7ff, 0xf7df, 0xf7df, 0xf7df, 0xffff, 0xffff, 
-	0x29c8, 0x534f, 0x53b1, 0x538f, 0x5bd1, 0x7cd3, 0xc679, 0xdf1c, 0xefbf, 0x29c8, 0x1945, 0x2145, 0x3186, 0x4a28, 0x5a68, 0x6a89, 
-	0x72c9, 0x72a9, 0x72c9, 0x72c9, 0x72c9, 0x72a9, 0x6a89, 0x6a49, 0x6a48, 0x6a49, 0x6228, 0x6228, 0x6208, 0x7229, 0x8aca, 0xabce, 
-	0xddf8, 0xe659, 0xcd73, 0xac4e, 0x9bac, 0x834b, 0x6aca, 0x940f, 0xc533, 0xde17, 0xde38, 0xeeda, 0xef3c, 0xdedb, 0x6baf, 0xb5b6, 
-	0xbe17, 0xb617, 0xefdf, 0xf7df, 0xf7df, 0xf7df, 0xf7be, 0xf7ff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xf7df, 0xffdf, 0xffff, 0xffff, 
-	0x31c8, 0x63b1, 0x5c13, 0x5bf1, 0x7493, 0xf7be, 0xef7d, 0xceb9, 0x528a, 0x2165, 0x1945, 0x2145, 0x31a6, 0x4a08, 0x6269, 0x72aa, 
-	0x72a9, 0x7aaa, 0x7ac9, 0x7aca, 0x7aca, 0x7aa9, 0x7aaa, 0x7289, 0x728a, 0x7249, 0x6a28, 0x6228, 0x61e8, 0x7229, 0x8aaa, 0xabae, 
-	0xd596, 0xe679, 0xde17, 0xc512, 0xac4e, 0xac4e, 0xb4b0, 0xbcf1, 0xcd73, 0xde38, 0xe679, 0xeedb, 0xef3c, 0xdedb, 0x8451, 0xb5d7, 
-	0xce79, 0xb5f7, 0xf7df, 0xf7ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xffdf, 0xffff, 0xffff, 
-	0x31e9, 0x6c12, 0x8516, 0x6432, 0xe75d, 0xffdf, 0xf7be, 0xb554, 0x5a28, 0x2945, 0x2145, 0x2145, 0x39c7, 0x5228, 0x6249, 0x7289, 
-	0x7aaa, 0x7aca, 0x7aca, 0x82ea, 0x82ca, 0x7aca, 0x7aaa, 0x7aaa, 0x7a8a, 0x7249, 0x6a28, 0x6208, 0x61e8, 0x7a29, 0x92aa, 0xa34d, 
-	0xc4b2, 0xe639, 0xee7a, 0xd5b6, 0xc4f2, 0xbc90, 0xc4d1, 0xcd53, 0xd5b4, 0xde37, 0xe699, 0xeedb, 0xf75d, 0xdeba, 0xad96, 0xc638, 
-	0xe73c, 0xbe18, 0xf7df, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0x3a2a, 0x7433, 0x74b6, 0x7cb4, 0xffff, 0xe75d, 0xffdf, 0xb513, 0x828a, 0x41e7, 0x2966, 0x2986, 0x39c7, 0x5228, 0x6269, 0x7289, 
-	0x7aaa, 0x82ca, 0x82eb, 0x82ca, 0x82ca, 0x82ca, 0x82cb, 0x82aa, 0x7a8a, 0x7249, 0x6a28, 0x61e8, 0x6a08, 0x8249, 0x92ab, 0xab4c, 
-	0xc471, 0xe618, 0xeebb, 0xe638, 0xcd54, 0xcd12, 0xc4f1, 0xcd32, 0xd5b5, 0xde17, 0xe679, 0xeefb, 0xf75d, 0xce59, 0xbe18, 0xad76, 
-	0xe73c, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 
-	0x426b, 0x7c74, 0x7cf6, 0xdf1c, 0xffff, 0xf7be, 0xe75d, 0xef3c, 0x9aeb, 0x5208, 0x4a07, 0x39c6, 0x41e7, 0x5a28, 0x6269, 0x7269, 
-	0x7aaa, 0x82ca, 0x82cb, 0x8aea, 0x8aca, 0x8aea, 0x8aca, 0x82aa, 0x7a89, 0x7269, 0x6a08, 0x61c7, 0x7208, 0x8249, 0xa32c, 0xb3ee, 
-	0xccf3, 0xee9a, 0xeeba, 0xe638, 0xd595, 0xcd12, 0xcd12, 0xd533, 0xd594, 0xde17, 0xee7a, 0xf71c, 0xf77d, 0xb576, 0xc639, 0x94b3, 
-	0xe73c, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7ff, 0xf7df, 0xf7df, 0xffff, 0xffdf, 0xffff, 0xffff, 
-	0x428d, 0x8495, 0xa598, 0xffff, 0xef9e, 0xd6fc, 0xef7e, 0xf7be, 0xab6d, 0x6a69, 0x6269, 0x5a48, 0x5208, 0x5a49, 0x6269, 0x7289, 
-	0x7a8a, 0x82aa, 0x82cb, 0x8aeb, 0x8b0b, 0x8b0b, 0x82ca, 0x82ca, 0x7aaa, 0x7269, 0x61c7, 0x69e8, 0x71e8, 0x7a28, 0xa32c, 0xbc2f, 
-	0xee16, 0xee78, 0xee79, 0xe617, 0xdd74, 0xd533, 0xd533, 0xd553, 0xddd5, 0xe637, 0xee9a, 0xf71c, 0xf77e, 0x9492, 0xce59, 0x7c31, 
-	0xe75d, 0xc659, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xefbe, 0xefbe, 0xf7df, 0xffff, 0xffff, 0xffff, 0xe79e, 
-	0x5b90, 0xbe3a, 0xe73d, 0xffdf, 0xdefc, 0xc6bb, 0xe77e, 0xffdf, 0xc514, 0x72aa, 0x6aaa, 0x6289, 0x5a48, 0x6269, 0x6269, 0x7269, 
-	0x7a8a, 0x7a8a, 0x82aa, 0x8acb, 0x8aeb, 0x8b0b, 0x8aeb, 0x8aca, 0x82aa, 0x7249, 0x7208, 0x82aa, 0x6a08, 0x79e8, 0xab4c, 0xcc90, 
-	0xee16, 0xe5f6, 0xf678, 0xddb5, 0xdd74, 0xd533, 0xdd53, 0xdd94, 0xe5f6, 0xee58, 0xf6ba, 0xf73c, 0xff7d, 0xa534, 0xce39, 0x8c92, 
-	0xef5c, 0xc638, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xf7df, 0xf7ff, 0xefbe, 0xe79e, 0xf7be, 0xffff, 0xffff, 0xffff, 0xe79e, 
-	0x8d15, 0x9d57, 0xcebc, 0xef7d, 0xe75d, 0xcefc, 0xef9e, 0xffff, 0xffbe, 0x7b2c, 0x730b, 0x6aca, 0x62a9, 0x62a9, 0x6289, 0x7289, 
-	0x7a69, 0x7a8a, 0x82aa, 0x8aca, 0x8aeb, 0x8aeb, 0x8aeb, 0x8aeb, 0x82ea, 0x7228, 0x82aa, 0x6a28, 0x4104, 0x69c7, 0xabad, 0xdd32, 
-	0x6965, 0x89a7, 0xee37, 0xd512, 0xd533, 0xdd53, 0xdd74, 0xe5b5, 0xe616, 0xf679, 0xf6db, 0xf73c, 0xff7d, 0xad35, 0xce79, 0x9d14, 
-	0xf79e, 0xce9a, 0xf7be, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xefbe, 0xefbe, 0xefbe, 0xf7df, 0xf7ff, 0xffff, 0xffff, 0xefbe, 0xdf7d, 
-	0x7474, 0xb619, 0xe75e, 0xef9e, 0xf7bf, 0xe77e, 0xe77e, 0xffdf, 0xffff, 0x9471, 0x7b4c, 0x6aca, 0x5a69, 0x62ca, 0x6289, 0x6a69, 
-	0x7269, 0x7a8a, 0x82aa, 0x82ab, 0x8aca, 0x8aca, 0x8aca, 0x82ca, 0x82ca, 0x7a69, 0x61c7, 0x7229, 0x7a29, 0x8aaa, 0xbc4f, 0xe5d5, 
-	0xdd34, 0xc3ae, 0xedb5, 0xccd1, 0xd4f1, 0xdd53, 0xe594, 0xe5f6, 0xee37, 0xf699, 0xf6fb, 0xff3c, 0xf73c, 0x9cd3, 0xd69a, 0xad75, 
-	0xffdf, 0xd6db, 0xe79d, 0xefbe, 0xefbe, 0xf7df, 0xf7df, 0xefbe, 0xe7be, 0xefde, 0xf7df, 0xffff, 0xffff, 0xffff, 0xf7df, 0xdfbd, 
-	0x7cb5, 0xcebb, 0xae3b, 0xef7e, 0xffff, 0xefbf, 0xffff, 0xffff, 0xffff, 0xb574, 0x7b6d, 0x6aca, 0x6269, 0x6aea, 0x6aaa, 0x6a89, 
-	0x7289, 0x7a8a, 0x82aa, 0x82aa, 0x8aca, 0x82ca, 0x82ca, 0x82a9, 0x82a9, 0x7a89, 0x7249, 0x7208, 0x7a49, 0x9b6c, 0xb40e, 0xd532, 
-	0xee16, 0xdd53, 0xd532, 0xd511, 0xccf1, 0xd532, 0xe594, 0xee16, 0xf658, 0xf6b9, 0xff1b, 0xff5c, 0xe6da, 0x9cd3, 0xd679, 0xbdd7, 
-	0xffdf, 0xf7df, 0xe79e, 0xefbe, 0xefbe, 0xf7df, 0xefbe, 0xefbe, 0xefbe, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xefdf, 0xe7bd, 
-	0x8d37, 0xadfa, 0xa63b, 0xe75e, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0x9cb2, 0x734c, 0x730b, 0x7b2b, 0x732b, 0x6aca, 0x6a89, 
-	0x7289, 0x72aa, 0x7aaa, 0x82aa, 0x82aa, 0x82ca, 0x82a9, 0x8289, 0x82a9, 0x7a8a, 0x7a89, 0x7a69, 0x82aa, 0xa3ad, 0xab8c, 0xccd1, 
-	0xee16, 0xe5b5, 0xdd74, 0xdd53, 0xdd53, 0xdd53, 0xe5d4, 0xee37, 0xf678, 0xf6da, 0xff3c, 0xff7d, 0xce18, 0xa535, 0xce79, 0xc638, 
-	0xef7d, 0xf7de, 0xe7be, 0xe7be, 0xefbe, 0xefdf, 0xefdf, 0xefbe, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xe79d, 0xdfbd, 
-	0x8517, 0x9578, 0x9e3b, 0xa61a, 0xffff, 0xffff, 0xffff, 0xf7df, 0xffff, 0x73ce, 0x4228, 0x7b0c, 0x7b0b, 0x7b2b, 0x6aca, 0x6a89, 
-	0x6a8a, 0x72aa, 0x7aaa, 0x7aaa, 0x7aaa, 0x828a, 0x7a8a, 0x7a69, 0x7a8a, 0x7a8a, 0x7a69, 0x7a89, 0x8aea, 0xabcd, 0xa36c, 0xc46f, 
-	0xe5d6, 0xe5f5, 0xddb5, 0xddb5, 0xe5b4, 0xe5b4, 0xedf5, 0xf658, 0xf699, 0xfefb, 0xff5c, 0xff7d, 0xc5d6, 0xb576, 0xc5f7, 0xce59, 
-	0xffff, 0xf7de, 0xefbe, 0xe7be, 0xdf9e, 0xe7bf, 0xefdf, 0xf7df, 0xf7ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xefbe, 0xe7bd, 
-	0x9578, 0x9578, 0x9e3b, 0xa61a, 0xffff, 0xffff, 0xffdf, 0xf7df, 0xffff, 0x634d, 0x31c7, 0x730c, 0x7b0b, 0x730b, 0x6aaa, 0x6aaa, 
-	0x6a8a, 0x728a, 0x7aaa, 0x7aaa, 0x7a8a, 0x7a69, 0x7a6a, 0x7a8a, 0x7a69, 0x7a69, 0x7a8a, 0x7a69, 0x92ea, 0xa38c, 0xa32b, 0xbc0f, 
-	0xddb5, 0xe5f5, 0xddd5, 0xe5f6, 0xe5f6, 0xee16, 0xee37, 0xf699, 0xf6da, 0xff1b, 0xff5d, 0xff9d, 0xce38, 0xb575, 0xc5f7, 0xce38, 
-	0xf7be, 0xefbe, 0xefde, 0xe7be, 0xe7be, 0xefdf, 0xefbf, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe79e, 0xefbe, 0xe7bd, 
-	0xa5d9, 0x9d99, 0xa63c, 0x9dfa, 0xffff, 0xf7bf, 0xffff, 0xf7df, 0xffdf, 0x4aaa, 0x31c7, 0x39e8, 0x62ab, 0x6acb, 0x6aca, 0x6aaa, 
-	0x6a8a, 0x728a, 0x7aaa, 0x7aaa, 0x728a, 0x7269, 0x7a69, 0x7a8a, 0x7a8a, 0x7a69, 0x7a49, 0x8249, 0x8a6a, 0xa30c, 0xab4c, 0xc430, 
-	0xe5d5, 0xe5f6, 0xe5f6, 0xe5f6, 0xee16, 0xee58, 0xf698, 0xf699, 0xfefa, 0xff5c, 0xff7d, 0xff7d, 0xce38, 0xb575, 0xb596, 0xd679, 
-	0xffff, 0xf7df, 0xefbe, 0xefde, 0xefbe, 0xefdf, 0xf7df, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xefde, 0xe7be, 
-	0xae3b, 0x9d99, 0xa65c, 0x9dfa, 0xffff, 0xef9e, 0xdf5d, 0xd71c, 0xffff, 0x7c10, 0x31e8, 0x29a7, 0x2166, 0x31a6, 0x62aa, 0x6aaa, 
-	0x72aa, 0x728a, 0x72aa, 0x7aaa, 0x7289, 0x7269, 0x7aaa, 0x7a8a, 0x7a69, 0x7a49, 0x824a, 0x8a4a, 0x8a29, 0x9a8a, 0xbb8e, 0xcc51, 
-	0xd4b2, 0xee16, 0xee16, 0xee16, 0xee16, 0xf678, 0xf6da, 0xf6fa, 0xff1b, 0xff7c, 0xff9d, 0xf77d, 0xdeba, 0xb575, 0xb575, 0xdedb, 
-	0xffff, 0xffff, 0xf7ff, 0xf7de, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xefde, 
-	0xb65b, 0x9d98, 0xae5c, 0xa63b, 0xffff, 0xe77e, 0xd71c, 0xcefc, 0xffdf, 0xadb6, 0x4a6a, 0x31e8, 0x29a7, 0x2986, 0x6aeb, 0x6aab, 
-	0x6aaa, 0x72aa, 0x728a, 0x72a9, 0x728a, 0x72a9, 0x7aaa, 0x6a49, 0x61c8, 0x59c8, 0x4925, 0x7a4a, 0x8a6a, 0x9acb, 0xa34c, 0xb3ce, 
-	0xb3ce, 0xc450, 0xee16, 0xee36, 0xee16, 0xf699, 0xfefa, 0xff1b, 0xff5c, 0xff9d, 0xffbe, 0xd69a, 0xef7d, 0xd659, 0xbd95, 0xe73c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xf7ff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7ff, 
-	0xbe9c, 0x9d98, 0xae5c, 0xae5b, 0xffff, 0xdf5d, 0xcebb, 0xcedb, 0xef7e, 0xb5d7, 0x632c, 0x31e8, 0x29a7, 0x2186, 0x6b0b, 0x6acb, 
-	0x6acb, 0x72ca, 0x72aa, 0x728a, 0x7289, 0x72a9, 0x7289, 0x7249, 0x61c8, 0x5987, 0x61a8, 0x71a8, 0x79c8, 0x89e9, 0x9209, 0x9a6a, 
-	0x8a2a, 0x4904, 0xb36d, 0xd513, 0xddb4, 0xf698, 0xff1b, 0xff3b, 0xff5c, 0xff9d, 0xffbe, 0xad55, 0xef3c, 0xce38, 0xce58, 0xdedb, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xffff, 
-	0xc6dc, 0xa5b9, 0xae5b, 0x9e1a, 0xffff, 0xe75d, 0xce9b, 0xd6fc, 0xe75d, 0xbdf7, 0x736d, 0x29e8, 0x29c8, 0x29a7, 0x528a, 0x6acb, 
-	0x72eb, 0x72cb, 0x72ab, 0x72aa, 0x72aa, 0x7289, 0x7289, 0x7a89, 0x7229, 0x7208, 0x71e9, 0x79e9, 0x922a, 0xa2ac, 0xaaec, 0xbb8f, 
-	0xd493, 0xd4d3, 0xcc51, 0xcc91, 0xdd93, 0xee57, 0xff1a, 0xff5c, 0xff5c, 0xff7d, 0xff9d, 0xbdf7, 0xdeba, 0xdefb, 0xe73c, 0xdefb, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xf7ff, 
-	0xcedc, 0xa5d9, 0xae5b, 0xa61a, 0xffff, 0xf7df, 0xcedb, 0xef9e, 0xce9b, 0xce9a, 0x8c30, 0x3208, 0x3208, 0x29c8, 0x31c8, 0x734c, 
-	0x730c, 0x730c, 0x72eb, 0x72cb, 0x72aa, 0x728a, 0x728a, 0x7a8a, 0x7a69, 0x7a69, 0x7a69, 0x8a8a, 0x9acb, 0xa30c, 0xbb8e, 0xcc30, 
-	0xdd34, 0xedf7, 0xf658, 0xee58, 0xee57, 0xee77, 0xff1b, 0xff5c, 0xff5c, 0xff7d, 0xe6da, 0xc618, 0xce59, 0xf7be, 0xffdf, 0xe73c, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xefbe, 
-	0xcedc, 0xa5d9, 0xae5b, 0xa63b, 0xffff, 0xffff, 0xe77e, 0xe79e, 0xcebb, 0xffdf, 0xe71c, 0x4aab, 0x3a49, 0x3209, 0x31e8, 0x738e, 
-	0x734d, 0x734c, 0x7b2c, 0x72cb, 0x72aa, 0x728a, 0x7289, 0x728a, 0x7aaa, 0x82aa, 0x82aa, 0x932b, 0xa3ad, 0xabad, 0xbc0e, 0xcc70, 
-	0xdd73, 0xee16, 0xee78, 0xf698, 0xf678, 0xf699, 0xfefa, 0xff5c, 0xff7c, 0xff7d, 0xb575, 0xe73c, 0xf79e, 0xffdf, 0xffff, 0xffff, 
-	0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7df, 0xf7de, 0xf7df, 0xffff, 0xefbe, 0xefbe, 
-	0xd6fd, 0xadd9, 0xae5b, 0xae3b, 0xffff, 0xffff, 0xf7df, 0xefbf, 0xf7bf, 0xffff, 0xffff, 0x7c31, 0x634d, 0x426a, 0x428a, 0x3a29, 
-	0x9451, 0x83ae, 0x7b6d, 0x7b0c, 0x72eb, 0x72ab, 0x72aa, 0x7aaa, 0x7aaa, 0x82aa, 0x8aea, 0x9b4c, 0xabed, 0xabcd, 0xbc2e, 0xc48f, 
-	0xd552, 0xe5f5, 0xee57, 0xf678, 0xf698, 0xf6d9, 0xff1b, 0xff3c, 0xff5c, 0xf75c, 0xbdf7, 0xe71c, 0xf7be, 0xffff, 0xffff, 0xffff, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xf7de, 0xffff, 0xffff, 0xf7df, 0xf7ff, 
-	0xcedc, 0xadf9, 0xae3a, 0xa63a, 0xffdf, 0xffff, 0xffff, 0xf7ff, 0xf7df, 0xffff, 0xffff, 0xd6db, 0xe73d, 0xf79e, 0x636e, 0x5b2d, 
-	0x73cf, 0xa4d3, 0x8c30, 0x838e, 0x7b2c, 0x72ec, 0x72cb, 0x7aca, 0x7aca, 0x82cb, 0x8aeb, 0x9b4c, 0xa38c, 0xb3ee, 0xc44f, 0xccb0, 
-	0xd532, 0xe5f5, 0xee37, 0xf678, 0xf6b9, 0xfefa, 0xff1a, 0xff3c, 0xff5d, 0xbdd7, 0xce9a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 
-	0xd71d, 0xb65a, 0xa61a, 0xae5b, 0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xef7e, 0xb5f8, 0xc639, 
-	0xadb7, 0xad96, 0xd69a, 0xa4f3, 0x8c0f, 0x7b8d, 0x7b2c, 0x7aec, 0x7acb, 0x82cb, 0x8aeb, 0x9b2c, 0xab8d, 0xb40e, 0xc470, 0xccd1, 
-	0xdd74, 0xe5f6, 0xee58, 0xf699, 0xf6da, 0xfefa, 0xff3b, 0xff5c, 0xd67a, 0xe75d, 0xef7e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xdf1d, 0xbe7b, 0xae3b, 0xb67b, 0xef9e, 0xffff, 0xffff, 0xffff, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7e, 
-	0xe75d, 0xdf1c, 0xffff, 0xd6ba, 0x9492, 0x83af, 0x7b4d, 0x7b0c, 0x7aec, 0x82cb, 0x8aec, 0x9b2c, 0xabae, 0xbc0f, 0xc470, 0xd4d2, 
-	0xe595, 0xee37, 0xf678, 0xf6b9, 0xfefa, 0xff1b, 0xff5c, 0xffde, 0xf7be, 0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xd71d, 0xc69b, 0xae5b, 0xb6bc, 0xd73d, 0xffff, 0xffff, 0xffff, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xf7be, 0xffff, 0xffff, 0xffdf, 0xbdf7, 0x8410, 0x7b6e, 0x730c, 0x7aec, 0x82cc, 0x930c, 0x9b4d, 0xabce, 0xbc0f, 0xc450, 0xd4f3, 
-	0xe5b5, 0xf638, 0xf678, 0xf6b9, 0xf6fa, 0xf71b, 0xff7d, 0xffff, 0xffff, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xd71d, 0xcebc, 0xae5b, 0xb6bc, 0xcedc, 0xffff, 0xf7df, 0xf7df, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xa555, 0x9cd3, 0x83cf, 0x732d, 0x72ec, 0x7acc, 0x8aec, 0x9b4d, 0xa3ae, 0xb3ee, 0xc450, 0xd4d2, 
-	0xdd74, 0xee37, 0xf678, 0xf699, 0xf6b9, 0xf6fb, 0xff7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xcefc, 0xd6dc, 0xae3b, 0xb69c, 0xb63a, 0xffff, 0xf7bf, 0xffff, 0xf7bf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x8431, 0x7bcf, 0x7b6e, 0x730c, 0x7aec, 0x82eb, 0x934c, 0xa3ad, 0xabee, 0xb42f, 0xc4d1, 
-	0xd553, 0xe616, 0xee57, 0xee58, 0xf6ba, 0xf6fb, 0xff7d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xcedc, 0xd6fc, 0xae3a, 0xb69b, 0x9597, 0xffff, 0xefbf, 0xffff, 0xe75d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x8410, 0x7b6e, 0x732d, 0x72eb, 0x72eb, 0x832c, 0x938d, 0x9bcd, 0xac0e, 0xb44f, 0xbcb1, 
-	0xcd32, 0xd594, 0xe5f6, 0xee37, 0xf679, 0xf6da, 0xf75d, 0xffbe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xc6bb, 0xdf1d, 0xb65b, 0xb69c, 0x8d77, 0xe79f, 0xef9e, 0xffff, 0xef9e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x83ef, 0x734d, 0x72ec, 0x72cb, 0x7aeb, 0x8b4c, 0x9bcd, 0xa40e, 0xb44f, 0xbc90, 0xc4d1, 
-	0xcd12, 0xd574, 0xddb5, 0xe616, 0xee38, 0xf6ba, 0xf73c, 0xff7e, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xbe7a, 0xdf1c, 0xb65b, 0xbebc, 0x8d56, 0xdf7e, 0xef9e, 0xffff, 0xef9e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x9471, 0x83ae, 0x7b2c, 0x72eb, 0x72cb, 0x7aeb, 0x8b6c, 0x9bcd, 0xac0e, 0xbc70, 0xc4b0, 0xccd1, 
-	0xcd12, 0xd512, 0xdd54, 0xdd95, 0xee17, 0xee59, 0xf6bb, 0xf6fc, 0xeefc, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xbe5a, 0xdf1d, 0xbe5b, 0xbebc, 0x9577, 0xdf5e, 0xe77e, 0xefbe, 0xdf5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x8c30, 0x838e, 0x7b0c, 0x72cb, 0x72cb, 0x7aeb, 0x8b4c, 0x9bcd, 0xac0e, 0xbc70, 0xc4b1, 0xc4b1, 
-	0xc4b1, 0xccd1, 0xd512, 0xdd54, 0xe5d6, 0xe618, 0xee59, 0xe659, 0xe65a, 0xe69a, 0xf73d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xbe59, 0xdf1c, 0xb65a, 0xbebc, 0x8d77, 0xcf1d, 0xefbf, 0xef9e, 0xdf5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x8c10, 0x838e, 0x730c, 0x72cb, 0x72ab, 0x7acb, 0x8b2b, 0x9b8c, 0xabee, 0xb44e, 0xbc6f, 0xbc4f, 
-	0xbc4f, 0xc46f, 0xccd1, 0xdd33, 0xdd74, 0xe5f6, 0xe618, 0xddb7, 0xddb7, 0xddf8, 0xe659, 0xeeba, 0xffdf, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xb618, 0xdefc, 0xbe5a, 0xb67b, 0x8d36, 0xcf1d, 0xe77e, 0xef9e, 0xdf3d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x8bef, 0x7b6d, 0x72ec, 0x7acb, 0x7aab, 0x7acb, 0x8b0b, 0x9b6c, 0xa3cd, 0xabed, 0xabed, 0xabcd, 
-	0xb3ed, 0xc44e, 0xccb0, 0xd512, 0xdd53, 0xdd95, 0xdd96, 0xd534, 0xcd34, 0xd576, 0xd596, 0xddd7, 0xde39, 0xf75d, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xadb7, 0xdefc, 0xbe5a, 0xbe9b, 0x9577, 0xbe9b, 0xe79e, 0xef9e, 0xd71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xffff, 0x7b6d, 0x7b4c, 0x72eb, 0x7acb, 0x7acb, 0x7aaa, 0x8b0b, 0x934c, 0x9b8c, 0xa38c, 0xa38c, 0xa36b, 
-	0xabac, 0xbc0e, 0xc46f, 0xccd1, 0xd512, 0xdd54, 0xd534, 0xccd3, 0xccb2, 0xc4b2, 0xc4b2, 0xccf3, 0xd555, 0xd5f8, 0xe69a, 0xf77d, 
-	0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xadd7, 0xe71c, 0xc69b, 0xbebc, 0x9d98, 0xbe7b, 0xe77e, 0xef9e, 0xdf5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0xd659, 0x7b2c, 0x7b0c, 0x72aa, 0x7aca, 0x7acb, 0x82ca, 0x8aeb, 0x932b, 0x934b, 0x9b4b, 0x9b4b, 0x9b4b, 
-	0xa38c, 0xb3ed, 0xbc2e, 0xcc90, 0xccb1, 0xccf2, 0xccd2, 0xc491, 0xc450, 0xbc50, 0xbc4f, 0xbc0e, 0xbc2f, 0xbc92, 0xc514, 0xc5b7, 
-	0xce3a, 0xc65a, 0xce9b, 0xef5d, 0xffdf, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xc659, 0xdefc, 0xc67a, 0xbe9b, 0x9db8, 0xae39, 0xef9f, 0xef7e, 0xcedc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xffff, 0x8bcf, 0x730b, 0x72cb, 0x6a89, 0x7aaa, 0x82ca, 0x82ca, 0x8aca, 0x8aea, 0x930b, 0x930b, 0x930a, 0x930b, 
-	0xa36b, 0xabac, 0xb3ed, 0xbc2e, 0xc44f, 0xc490, 0xc470, 0xbc2f, 0xbc0e, 0xbc0e, 0xbc0e, 0xb3cd, 0xb3ad, 0xb3ce, 0xac0f, 0xac31, 
-	0x6b70, 0x7412, 0x7c74, 0x84b5, 0x9536, 0xdf1d, 0xf79e, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xcebb, 0xd6db, 0xc67a, 0xbe9b, 0xa5d8, 0xae19, 0xe77e, 0xe73d, 0xc6bb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xffff, 0xc5d7, 0x730c, 0x6aca, 0x6a8a, 0x6a69, 0x728a, 0x82ca, 0x82ca, 0x82ca, 0x8aca, 0x8aca, 0x8aca, 0x8aca, 0x92ea, 
-	0x9b2b, 0xa38c, 0xabac, 0xb3ed, 0xbbee, 0xbc0e, 0xc42e, 0xbbee, 0xb3ed, 0xb3ed, 0xb3ed, 0xb3ac, 0xab6c, 0xa36c, 0xa38c, 0x82ec, 
-	0x428c, 0x4acd, 0x4aee, 0x530e, 0x530e, 0x63d2, 0x8494, 0x9537, 0x9516, 0xc65a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xdefc, 0xce9a, 0xbe39, 0xb65a, 0x9d97, 0x9db7, 0xcedb, 0xe73d, 0xcedc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xffff, 0xef1c, 0x836d, 0x6aaa, 0x6269, 0x6269, 0x6228, 0x7269, 0x82ca, 0x82ca, 0x82ca, 0x82aa, 0x82aa, 0x82aa, 0x82aa, 0x8aca, 
-	0x930a, 0x9b2a, 0xab6b, 0xb38c, 0xb38c, 0xb3ad, 0xb3ed, 0xb3cd, 0xb3ac, 0xb3cc, 0xb3ac, 0xab8c, 0xab6b, 0xa34b, 0x92ea, 0x4a8b, 
-	0x3a2a, 0x426b, 0x424b, 0x424b, 0x4aad, 0x5b50, 0x6bd2, 0x7433, 0x63b1, 0x63b1, 0x8493, 0xce7a, 0xffdf, 0xffff, 0xffff, 0xffff, 
-	0xef9e, 0xc659, 0xc639, 0xb63a, 0x9d77, 0x9d97, 0xcefc, 0xef7e, 0xd71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
-	0xe6db, 0x8baf, 0x72aa, 0x6249, 0x6249, 0x6249, 0x5a08, 0x6a28, 0x82aa, 0x8aca, 0x82aa, 0x82a9, 0x7a89, 0x7a69, 0x8269, 0x8aa9, 
-	0x92ca, 0x9b0a, 0xa30a, 0xa34b, 0xab4b, 0xab6c, 0xb3ac, 0xab8c, 0xab8c, 0xabac, 0xb3ac, 0xab8c, 0xa36b, 0x9aea, 0x6249, 0x3a0a, 
-	0x3a09, 0x4229, 0x62ec, 0x528b, 0x39e9, 0x4aad, 0x5b70, 0x5b71, 0x5b70, 0x5b70, 0x63b1, 0x7c73, 0x8cb4, 0xadb8, 0xe75d, 0xffff, 
-	0xffff, 0xc659, 0xd69a, 0xbe5a, 0xadf8, 0x9d98, 0xd71d, 0xef9e, 0xdf3d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xdebb, 0xef1c, 0xc596, 
-	0x93cf, 0x72ca, 0x6249, 0x5a28, 0x5a28, 0x5a28, 0x5a08, 0x6a28, 0x8289, 0x8aea, 0x82a9, 0x8289, 0x7a69, 0x7a49, 0x7a49, 0x8aa9, 
-	0x92ca, 0x92ea, 0x9aea, 0xa30a, 0xa30a, 0xa34b, 0xab6c, 0xab8c, 0xab8c, 0xab8c, 0xab8c, 0xab6c, 0x9b0a, 0x8269, 0x3a09, 0x3a09, 
-	0x3a09, 0x736d, 0x7bae, 0x83ce, 0x4209, 0x3a2a, 0x4ace, 0x42cd, 0x42ae, 0x4b0f, 0x532f, 0x8cf5, 0x6bf2, 0x7413, 0x7c74, 0x9516, 
-	0xffff, 0xbe39, 0xd6bb, 0xbe5a, 0xadf9, 0x9556, 0xdf3d, 0xe75d, 0xdf1c, 0xffff, 0xffff, 0xc5f7, 0x62cb, 0x93f0, 0xa451, 0x93cf, 
-	0x7aeb, 0x6a49, 0x6208, 0x5a08, 0x5a08, 0x5a08, 0x59e8, 0x6a08, 0x82a9, 0x8b0a, 0x82ca, 0x7a89, 0x7a49, 0x7a29, 0x7a48, 0x8a89, 
-	0x92c9, 0x92c9, 0x9aca, 0x9aea, 0x9aea, 0xa2ea, 0xa34b, 0xab6c, 0xab6c, 0xab8c, 0xab8d, 0xa34c, 0x8aaa, 0x4228, 0x31c8, 0x31e9, 
-	0x4a6a, 0x736d, 0x8c2f, 0x5a89, 0x4229, 0x31e9, 0x426c, 0x3a6b, 0x42ad, 0x4aef, 0x4aee, 0x532f, 0x4aee, 0x5b70, 0x5b70, 0x6bf2, 
-	0xffff, 0xb5f8, 0xd69a, 0xbe5a, 0xa5d8, 0x8d36, 0xef9e, 0xffdf, 0xdf1d, 0xffff, 0xc576, 0x938e, 0x9bce, 0x9bef, 0x93cf, 0x832c, 
-	0x7289, 0x6228, 0x5a08, 0x59c8, 0x59e8, 0x5a08, 0x59e7, 0x6a08, 0x82a9, 0x8aea, 0x82ca, 0x7a69, 0x7228, 0x7208, 0x7a48, 0x8a89, 
-	0x92a9, 0x92c9, 0x9aea, 0x9aeb, 0x9aeb, 0xa30c, 0xa34c, 0xa36d, 0xa36d, 0xa38d, 0xa38e, 0xa36e, 0x626a, 0x31c7, 0x31e8, 0x31e8, 
-	0x31c8, 0x39e8, 0x5289, 0x4228, 0x31c7, 0x31e9, 0x3a2a, 0x3229, 0x322a, 0x322a, 0x3a6c, 0x428c, 0x4acd, 0x532f, 0x5b4f, 0x6390, 
-	0xffdf, 0xadb7, 0xd69a, 0xbe3a, 0xadd8, 0xadb8, 0xef7e, 0x5b2e, 0x4aee, 0x7c52, 0x938d, 0xa3ae, 0x9bef, 0x9c10, 0x93ce, 0x832c, 
-	0x7269, 0x6208, 0x59e7, 0x59c7, 0x59c7, 0x59c7, 0x59c7, 0x59c7, 0x7a89, 0x82ca, 0x7a89, 0x7229, 0x7208, 0x7208, 0x7a28, 0x8a49, 
-	0x8a69, 0x92aa, 0x92aa, 0x9aeb, 0xa30c, 0xa32c, 0xa34d, 0xa38e, 0xabae, 0xabae, 0xa38e, 0x8aec, 0x2986, 0x2987, 0x29a7, 0x2987, 
-	0x29a7, 0x31c7, 0x2986, 0x2166, 0x29a7, 0x31c8, 0x31e8, 0x31e8, 0x31e9, 0x3209, 0x3a0a, 0x3a2a, 0x3a6b, 0x532e, 0x636f, 0x638f, 
-	0xf7bf, 0x9d55, 0xd69a, 0xc63a, 0xef7e, 0x73f1, 0x426a, 0x29c8, 0x3a4a, 0x5a09, 0x7a8a, 0x82ca, 0x82eb, 0x834c, 0x830b, 0x72aa, 
-	0x6a28, 0x59e8, 0x59c7, 0x59c7, 0x59c7, 0x59c7, 0x61c7, 0x59c7, 0x6208, 0x59c7, 0x830c, 0x7269, 0x6a08, 0x7208, 0x7208, 0x7a08, 
-	0x8229, 0x8229, 0x8a49, 0x8a49, 0x9269, 0x92aa, 0x9aca, 0x9b0b, 0xa34b, 0xa34b, 0x930b, 0x41c7, 0x2986, 0x2987, 0x2166, 0x2986, 
-	0x2166, 0x29a7, 0x2186, 0x2166, 0x2987, 0x29a7, 0x29a7, 0x29a7, 0x29a7, 0x29c8, 0x31e8, 0x3209, 0x52cb, 0x6b6d, 0x6b6d, 0x8431, 
-	0xf7be, 0x9d55, 0xd69b, 0xe73d, 0x4aab, 0x4a8a, 0x31e8, 0x2187, 0x2987, 0x51e8, 0x6208, 0x6208, 0x6228, 0x6208, 0x6208, 0x59e7, 
-	0x59c7, 0x59c7, 0x59c7, 0x59c7, 0x59c7, 0x61c7, 0x69e8, 0x69e8, 0x7228, 0x6a28, 0x69e8, 0x61e7, 0x69e8, 0x7208, 0x7a29, 0x71e8, 
-	0x79e8, 0x71e8, 0x79e8, 0x7a08, 0x8228, 0x8248, 0x8a89, 0x8aa9, 0x92e9, 0x92ea, 0x6228, 0x2966, 0x2166, 0x2166, 0x2186, 0x31e8, 
-	0x29a7, 0x2186, 0x2166, 0x2166, 0x2186, 0x29a7, 0x29c7, 0x2987, 0x2987, 0x29c7, 0x29c7, 0x3a08, 0x632c, 0x6b6d, 0x736d, 0x8c71, 
-	0xdedc, 0x9d55, 0xb5d8, 0x31e8, 0x31e8, 0x3a08, 0x2166, 0x2146, 0x2966, 0x49a7, 0x59e8, 0x59e8, 0x51e7, 0x51c7, 0x51c7, 0x51c7, 
-	0x51c7, 0x51a7, 0x51a7, 0x51a7, 0x59a7, 0x61c7, 0x7a29, 0x7208, 0x7208, 0x7208, 0x7208, 0x69e8, 0x69e8, 0x7228, 0x7a49, 0x7a29, 
-	0x69e8, 0x71e8, 0x69e7, 0x71e8, 0x7208, 0x7228, 0x7a28, 0x7a68, 0x8289, 0x7248, 0x31a6, 0x2166, 0x2186, 0x2165, 0x2166, 0x29a7, 
-	0x29a7, 0x2166, 0x2166, 0x2166, 0x2966, 0x31c7, 0x29a7, 0x2186, 0x29a7, 0x29a7, 0x29a7, 0x3a28, 0x4249, 0x5aeb, 0x8430, 0xad73
-};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = ?)
-const int epd_bitmap_allArray_LEN = 10;
-const uint16_t* epd_bitmap_allArray[10] = {
-  epd_bitmap_gronkh,
-  epd_bitmap_bonjwa,
-  epd_bitmap_bonjwachill,
-  epd_bitmap_pietsmiet,
-  epd_bitmap_dhalucard,
-  epd_bitmap_trilluxe,
-  epd_bitmap_dracon,
-  epd_bitmap_maxim,
-  epd_bitmap_finanzfluss,
-  epd_bitmap_lidi
-};
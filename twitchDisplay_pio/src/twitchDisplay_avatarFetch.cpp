@@ -0,0 +1,142 @@
+// Host run of the avatar download (AvatarFetch.h) against the local helix
+// stand-in in sim/ ([env:native_avatarFetch]). Boots several times on one
+// avatars partition and checks which boots go to the network, what the
+// downloaded images turn into and that a changed profile image is noticed
+// and repainted, also when the refresh runs on a task of its own like the
+// live poll task. Exits with 1 if a check fails, see sim/SimCheck.h.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include <thread>
+
+#include "Debug.h"
+#include "SimCheck.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+#include "AvatarFetch.h"
+
+// A reboot as far as the avatars partition is concerned
+static void reboot(){
+  avatarCache.end();
+  avatarCache.begin();
+}
+
+// Fetches and returns the number of requests it took
+static uint32_t fetch(bool all, int& updated){
+  simHttpRequests = 0;
+  updated = fetchAvatars(all);
+  return simHttpRequests;
+}
+
+static bool swapImage(const char* id, const char* image){
+  return standin(std::string("swap?id=") + id + "&image=" + image);
+}
+
+// Whether avatar pixel x, y of channel id is r, g, b, off by at most tol
+// steps in each RGB565 channel
+static bool pixelNear(const char* id, uint8_t x, uint8_t y, uint8_t r, uint8_t g, uint8_t b, uint8_t tol){
+  const uint8_t* pic = avatarCache.get(id);
+  if(!pic) return false;
+  const uint8_t* p = pic + (y*AVATAR_SIZE + x)*2;
+  uint16_t c = (p[0] << 8) | p[1];
+  int dr = (c >> 11) - (r*31 + 127)/255, dg = ((c >> 5) & 63) - (g*63 + 127)/255, db = (c & 31) - (b*31 + 127)/255;
+  return abs(dr) <= tol && abs(dg) <= tol && abs(db) <= tol;
+}
+
+static bool allPixels(const char* id, uint16_t wire){
+  const uint16_t* pic = (const uint16_t*)avatarCache.get(id);
+  if(!pic) return false;
+  for (uint32_t i = 0; i < AvatarStore::PIXELS; i++) {
+    if(pic[i] != wire) return false;
+  }
+  return true;
+}
+
+int main(){
+  // a partition of our own, so the checks always start from an empty one
+  char dir[] = "/tmp/avatarFetchXXXXXX";
+  if(!mkdtemp(dir)) return 1;
+  setenv("SIM_DATA_DIR", dir, 1);
+
+  tft.init(170, 320);
+  tft.setRotation(1);
+  tftQueue.begin(TFT_CS, TFT_DC, 80000000);
+  setupRender();
+  channels[2].isLive = true;
+  live_num = 1;
+  redrawLiveChannelPics();
+  tftQueue.wait();
+  tft.resetSimStats();
+
+  int updated;
+  uint32_t requests = fetch(false, updated);
+  if(updated < 0){
+    S.printf("[Sim] No answer from %s, is sim/helix_standin.py running?\n", HELIX_URL);
+    return 1;
+  }
+  check(requests == 1 + channels.size(), "first boot: one lookup and a download per channel");
+  check(updated == 9 && avatarCache.size() == 9, "first boot: all but the progressive JPEG cached");
+  check(!avatarCache.get("16064695"), "progressive JPEG refused");
+
+  // red.png
+  const uint8_t red[2] = {0xF8, 0x00};
+  check(allPixels("761017145", *(const uint16_t*)red), "solid PNG exact");
+  // palette.png, 4 bit with white, blue, transparent green and half transparent magenta
+  check(pixelNear("73437396", 16, 16, 255, 255, 255, 0) && pixelNear("73437396", 48, 16, 0, 0, 255, 0)
+    && pixelNear("73437396", 16, 48, 0, 0, 0, 0) && pixelNear("73437396", 48, 48, 128, 0, 128, 0),
+    "palette PNG with tRNS");
+  // gradient.png, 80x60 RGBA cut to the middle 60x60
+  check(pixelNear("1024088182", 0, 0, 32, 0, 0, 1) && pixelNear("1024088182", 63, 63, 119, 137, 124, 1),
+    "RGBA PNG cut to a square");
+  // circle-70x70.jpg, 4:2:0 with restart markers
+  check(pixelNear("12875057", 32, 32, 250, 200, 40, 2) && pixelNear("12875057", 2, 61, 6, 198, 128, 3),
+    "baseline JPEG");
+
+  // the panel shows the downloaded avatar of bonjwa now
+  tftQueue.wait();
+  check(tft.simStats().pixelBytes >= SLOT_PIC_BYTES, "downloaded avatar repainted");
+
+  check(swapImage("16064695", "../../assets/lidi.png"), "stand-in: dhalucard gets a PNG");
+  reboot();
+  requests = fetch(false, updated);
+  check(requests == 2 && updated == 1 && avatarCache.size() == 10, "second boot: only the missing avatar");
+
+  reboot();
+  check(avatarCache.size() == 10, "third boot: everything still cached");
+  requests = fetch(false, updated);
+  check(requests == 0 && updated == 0, "third boot: no network I/O");
+
+  requests = fetch(true, updated);
+  check(requests == 1 && updated == 0, "refresh: lookup only, nothing changed");
+
+  tftQueue.wait();
+  tft.resetSimStats();
+  check(swapImage("73437396", "avatars/red.png"), "stand-in: bonjwa gets another image");
+  requests = fetch(true, updated);
+  check(requests == 2 && updated == 1, "refresh: changed image downloaded");
+  check(allPixels("73437396", *(const uint16_t*)red), "refresh: new avatar stored");
+  tftQueue.wait();
+  check(tft.simStats().pixelBytes == SLOT_PIC_BYTES, "refresh: only the live slot repainted");
+
+  reboot();
+  check(avatarCache.size() == 10 && allPixels("73437396", *(const uint16_t*)red), "fourth boot: new avatar kept");
+
+  // the daily refresh: requests and decoding on the other task, loop()
+  // stores what it hands over
+  check(swapImage("761017145", "avatars/gradient.png"), "stand-in: lidi gets another image");
+  simHttpRequests = 0;
+  avatarRefresh.request();
+  std::thread pollTask([]{ avatarRefresh.run(); });
+  int stored = 0;
+  while (avatarRefresh.pending()) {
+    stored += avatarRefresh.apply();
+    delay(1);
+  }
+  pollTask.join();
+  stored += avatarRefresh.apply();
+  check(simHttpRequests == 2 && stored == 1 && pixelNear("761017145", 0, 0, 32, 0, 0, 1),
+    "refresh on the poll task: stored by loop()");
+
+  return checksDone();
+}
@@ -38,6 +38,7 @@
 #include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
 #include <SPI.h>
 #include "pics.h"
+#include "PicDecoder.h"
 #include "secrets.h"
 
 #if defined(ARDUINO_FEATHER_ESP32) // Feather Huzzah32
@@ -79,6 +80,19 @@ float p = 3.1415926;
 GFXcanvas16 canvas(320, 85); // 16-bit, 320x170 pixels
 GFXcanvas16 text_canvas(298+(6*8), 64); 
 
+// The canvas wants native RGB565, pics.h stores them packed or in wire order
+uint16_t pic_buffer[PIC_SIZE*PIC_SIZE];
+const uint16_t* channelBitmap(const char* id){
+  const uint8_t* pic = picForChannel(id);
+#if PICS_PACKED
+  PicDecoder(pic).decode(pic_buffer, PIC_SIZE*PIC_SIZE);
+#else
+  memcpy(pic_buffer, pic, sizeof(pic_buffer));
+#endif
+  for (uint16_t& c : pic_buffer) c = __builtin_bswap16(c);
+  return pic_buffer;
+}
+
 void setHighFR();
 void set60FR();
 void enterPartialMode();
@@ -178,7 +192,7 @@ void setup(void) {
   tft.fillScreen(ST77XX_BLACK);
   
   canvas.fillScreen(ST77XX_BLACK);
-  canvas.drawRGBBitmap(11, 14, epd_bitmap_pietsmiet, 64, 64);
+  canvas.drawRGBBitmap(11, 14, channelBitmap("21991090"), 64, 64); // pietsmiet
   tft.drawRGBBitmap(0, 0, canvas.getBuffer(), canvas.width(), canvas.height());
 
   text_canvas.setCursor(0,0);
@@ -226,8 +240,8 @@ void loop() {
   canvas.setTextSize(5);
   canvas.print("+1");
   //canvas.drawRect(11+64+14+64+14+64+14,14,64,64,ST77XX_GREEN);
-  canvas.drawRGBBitmap(11+64+14+64+14, 14, epd_bitmap_gronkh, 64, 64);
-  canvas.drawRGBBitmap(11+64+14, 14, epd_bitmap_bonjwa, 64, 64);
+  canvas.drawRGBBitmap(11+64+14+64+14, 14, channelBitmap("12875057"), 64, 64); // gronkh
+  canvas.drawRGBBitmap(11+64+14, 14, channelBitmap("73437396"), 64, 64); // bonjwa
   tft.drawRGBBitmap(0, 0, canvas.getBuffer(), canvas.width(), canvas.height());
   }
   delay(20);
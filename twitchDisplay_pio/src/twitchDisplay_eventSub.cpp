@@ -0,0 +1,170 @@
+// Host run of the EventSub client (EventSub.h) against the local helix and
+// EventSub stand-in in sim/ ([env:native_eventSub]), with a loop() like the
+// firmware's and the live poll task, which runs the WebSocket, next to it.
+// Measures how long a channel going live or offline and a new title take to
+// reach the display, and checks that:
+//  - a message with arrays of objects in it is read past them
+//  - a welcome gets every subscription, and a poll helix has not caught up
+//    with yet does not undo what EventSub reported
+//  - notifications sent twice count once
+//  - a session_reconnect keeps the session and its subscriptions
+//  - a revocation is counted and the polls carry on
+//  - a session without keepalives is replaced, with new subscriptions
+//  - with the cost used up, every channel still gets stream.online
+// Exits with 1 if a check fails, see sim/SimCheck.h.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "Debug.h"
+#include "SimCheck.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+#include "LivePoller.h"
+#include "EventSub.h"
+
+#define POLL_INTERVAL_MS 500
+// What the firmware polled every before
+#define TW_UPDATE_INTERVAL (30*1000)
+// Longest a check waits for something to happen
+#define WAIT_MS 15000
+// Goes offline, live and gets a new title
+#define EVENT_CHANNEL 3
+
+// A channel.update with labels before the title, as helix sends them
+static const char updateMessage[] =
+  "{\"metadata\":{\"message_id\":\"1\",\"message_type\":\"notification\",\"subscription_type\":\"channel.update\"},"
+  "\"payload\":{\"event\":{\"broadcaster_user_id\":\"42\","
+  "\"content_classification_labels\":[{\"id\":\"Gambling\",\"tags\":[\"a\",[1]]},{\"id\":\"Violence\"}],"
+  "\"title\":\"Neuer Titel\",\"category_name\":\"Chatting\"}}}";
+
+static unsigned long elapsedMs(std::chrono::steady_clock::time_point since){
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+// Runs loop() until done() or for at most ms after start, returns how long
+// that took
+static unsigned long runLoopUntil(std::function<bool()> done, unsigned long ms = WAIT_MS,
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now()){
+  while (!done() && elapsedMs(start) < ms) {
+    eventSub.apply();
+    applyLiveUpdates();
+    updateTitleTicker();
+    // the rest of loop() and its sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return elapsedMs(start);
+}
+
+// Has the stand-in make a change and runs loop() until it is shown,
+// returns how long that took
+static unsigned long timeChange(const std::string& what, std::function<bool()> shown){
+  auto start = std::chrono::steady_clock::now();
+  standin(what);
+  return runLoopUntil(shown, WAIT_MS, start);
+}
+
+// Runs loop() until at least two more polls were applied
+static void runPolls(){
+  uint32_t polls = livePoller.polls();
+  runLoopUntil([&]{ return livePoller.polls() >= polls + 3; });
+}
+
+int main(){
+  // a partition of our own for the avatar cache
+  char dir[] = "/tmp/eventSubXXXXXX";
+  if(!mkdtemp(dir)) return 1;
+  setenv("SIM_DATA_DIR", dir, 1);
+
+  eventSubMessage message;
+  bool read = readEventSubMessage((const uint8_t*)updateMessage, sizeof(updateMessage) - 1, message);
+  check(read && strcmp(message.title, "Neuer Titel") == 0 && strcmp(message.categoryName, "Chatting") == 0,
+    "a message is read past its arrays of objects");
+
+  tft.init(170, 320);
+  tft.setRotation(1);
+  tftQueue.begin(TFT_CS, TFT_DC, 80000000);
+  setupRender();
+
+  if(!standin("eventsub?max_cost=30")){
+    S.printf("[Sim] No answer from %s, is sim/helix_standin.py running?\n", STANDIN_URL);
+    return 1;
+  }
+
+  const std::string id = "id=" + channels[EVENT_CHANNEL].id;
+  channelInfo& channel = channels[EVENT_CHANNEL];
+  const size_t all = EVENTSUB_TYPES * channels.size();
+
+  eventSub.begin();
+  livePoller.begin(POLL_INTERVAL_MS);
+  runLoopUntil([]{ return eventSub.ready() && live_num == channels.size(); });
+  check(eventSub.ready() && eventSub.subscriptions() == all && !eventSub.costUsedUp(),
+    "a welcome gets every subscription");
+  check(live_num == channels.size(), "the poll after it shows the live channels");
+
+  // helix/streams still has the stream for a while
+  unsigned long offlineMs = timeChange("offline?lag=1&" + id, [&]{ return !channel.isLive; });
+  runPolls();
+  check(!channel.isLive, "polls helix has not caught up with do not undo it");
+
+  unsigned long onlineMs = timeChange("online?" + id, [&]{ return channel.isLive; });
+  runPolls();
+  check(channel.isLive && channel.streamTitle.find(" is live") == std::string::npos,
+    "the title of a stream that went live comes with the polls");
+
+  titleChangeQueue.clear();
+  unsigned long titleMs = timeChange("update?title=Neuer%20Titel&game=Chatting&" + id,
+    [&]{ return channel.streamTitle == "    Neuer Titel | Chatting   "; });
+  bool queued = titleChangeQueue.size() == 1;
+  runPolls();
+  check(queued && channel.streamTitle == "    Neuer Titel | Chatting   ", "a new title goes to the ticker and stays");
+
+  S.printf("[Sim] shown after going offline %lu ms, live %lu ms, a new title %lu ms; polls every %u s took %u s on average\n",
+    offlineMs, onlineMs, titleMs, TW_UPDATE_INTERVAL/1000, TW_UPDATE_INTERVAL/2000);
+  check(offlineMs < 1000 && onlineMs < 1000 && titleMs < 1000, "changes show up within a second");
+
+  uint32_t notifications = eventSub.getStats().notifications;
+  standin("online?duplicate=1&" + id);
+  runLoopUntil([&]{ return eventSub.getStats().duplicates > 0; }, 2000);
+  check(eventSub.getStats().notifications == notifications + 1 && eventSub.getStats().duplicates == 1,
+    "a notification sent twice counts once");
+
+  standin("reconnect");
+  runLoopUntil([]{ return eventSub.getStats().reconnects > 0; });
+  standin("offline?" + id);
+  runLoopUntil([&]{ return !channel.isLive; }, 2000);
+  // helix agrees, which ends the hold
+  runPolls();
+  check(eventSub.getStats().reconnects == 1 && eventSub.getStats().sessions == 1 && eventSub.subscriptions() == all,
+    "a session_reconnect keeps the session and its subscriptions");
+  check(!channel.isLive, "and the notifications come on the new connection");
+
+  standin("revoke?type=stream.online&" + id);
+  runLoopUntil([]{ return eventSub.getStats().revocations > 0; }, 2000);
+  standin("online?" + id);
+  runLoopUntil([&]{ return channel.isLive; });
+  check(eventSub.getStats().revocations == 1 && channel.isLive, "a revoked channel is left to the polls");
+
+  standin("silence");
+  runLoopUntil([]{ return eventSub.getStats().sessions > 1 && eventSub.ready(); });
+  check(eventSub.getStats().keepaliveTimeouts == 1 && eventSub.ready() && eventSub.subscriptions() == all,
+    "a session without keepalives is replaced and subscribed again");
+
+  standin("eventsub?max_cost=" + std::to_string(channels.size()));
+  standin("close");
+  runLoopUntil([]{ return eventSub.getStats().sessions > 2 && eventSub.ready(); });
+  standin("offline?" + id);
+  runLoopUntil([&]{ return !channel.isLive; }, 3000);
+  bool offlinePolled = !channel.isLive;
+  standin("online?lag=1&" + id);
+  runLoopUntil([&]{ return channel.isLive; }, 2000);
+  check(eventSub.ready() && eventSub.subscriptions() == channels.size() && eventSub.costUsedUp(),
+    "with the cost used up the subscriptions stop");
+  check(offlinePolled && channel.isLive, "but every channel has stream.online");
+
+  livePoller.end();
+  return checksDone();
+}
@@ -0,0 +1,137 @@
+// Host run of the helix polls over the kept connection in HelixClient.h
+// ([env:native_helixPoll]) against the local helix stand-in in sim/. Checks
+// that polls reuse the connection, that chunked and Content-Length answers
+// leave it clean for the next request and that it is opened again, without a
+// failed poll, after the stand-in closed it for being idle or after its
+// keep-alive limit, that the Ratelimit headers are read, and that more ids than one request takes go out in
+// batches that follow every page (StreamsQuery.h). Prints the poll times on
+// reused and new connections; without TLS on localhost they are far apart
+// only on the device. Exits with 1 if a check fails, see sim/SimCheck.h.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Debug.h"
+#include "SimCheck.h"
+#include "Channels.h"
+#include "HelixClient.h"
+#include "HelixStreams.h"
+#include "StreamsQuery.h"
+
+// The defaults of sim/helix_standin.py
+#define STANDIN_IDLE_TIMEOUT_MS 3000
+#define STANDIN_KEEP_ALIVE_REQUESTS 8
+
+#define MANY_IDS 250
+#define PAGE_SIZE 3
+
+static bool setPageSize(int size){
+  return standin("page?size=" + std::to_string(size));
+}
+
+// A poll as pollLiveChannels() does it, returns the number of live
+// channels or -1
+static int poll(){
+  std::vector<const char*> ids;
+  for (auto& channel : channels) ids.push_back(channel.id.c_str());
+  int live = 0;
+  bool ok = fetchStreams(ids, [&](const streamFields&){ live++; });
+  return ok ? live : -1;
+}
+
+// Polls the channels spread over MANY_IDS ids, the others offline, with
+// pages of PAGE_SIZE streams
+static void pollMany(){
+  std::vector<std::string> many;
+  std::vector<const char*> ids;
+  size_t spacing = MANY_IDS/channels.size();
+  for (size_t i = 0; i < MANY_IDS; i++) {
+    if (i % spacing == 0 && i/spacing < channels.size()) many.push_back(channels[i/spacing].id);
+    else many.push_back(std::to_string(900000000 + i));
+  }
+  for (auto& id : many) ids.push_back(id.c_str());
+
+  // a request for each page of each batch of HELIX_MAX_IDS
+  uint32_t expected = 0;
+  for (size_t first = 0; first < MANY_IDS; first += HELIX_MAX_IDS) {
+    size_t live = 0;
+    for (size_t i = first; i < std::min((size_t)MANY_IDS, first + HELIX_MAX_IDS); i++) {
+      live += i % spacing == 0 && i/spacing < channels.size();
+    }
+    expected += std::max((size_t)1, (live + PAGE_SIZE - 1)/PAGE_SIZE);
+  }
+
+  setPageSize(PAGE_SIZE);
+  const HelixClient::Stats& stats = helix.getStats();
+  uint32_t requests = stats.reusedPolls + stats.newPolls + stats.failedPolls;
+  uint32_t failed = stats.failedPolls;
+  int connects = simHttpConnects;
+  std::vector<std::string> live;
+  bool ok = fetchStreams(ids, [&](const streamFields& stream){ live.push_back(stream.userId); });
+  requests = stats.reusedPolls + stats.newPolls + stats.failedPolls - requests;
+  connects = simHttpConnects - connects;
+  setPageSize(0);
+
+  std::vector<std::string> wanted;
+  for (auto& channel : channels) wanted.push_back(channel.id);
+  std::sort(live.begin(), live.end());
+  std::sort(wanted.begin(), wanted.end());
+  S.printf("[Sim] %u ids in %u requests\n", MANY_IDS, requests);
+  check(ok && live == wanted, "many ids: every live channel handed over once");
+  check(requests == expected, "many ids: batches of 100, every page followed");
+  check(stats.failedPolls == failed, "many ids: no request failed");
+  // at most the reconnect the keep-alive limit asks for
+  check(connects <= 1, "many ids: batches and pages on the kept connection");
+}
+
+// Runs count polls, false if one of them failed or missed a live channel
+static bool polls(int count){
+  bool ok = true;
+  for (int i = 0; i < count; i++) {
+    ok = poll() == (int)channels.size() && ok;
+  }
+  return ok;
+}
+
+int main(){
+  simHttpConnects = 0;
+  int live = poll();
+  if(live < 0){
+    S.printf("[Sim] No answer from %s, is sim/helix_standin.py running?\n", HELIX_URL);
+    return 1;
+  }
+  check(live == (int)channels.size(), "first poll: every channel live in the chunked answer");
+  check(simHttpConnects == 1 && helix.connected(), "first poll: connection kept open");
+  const HelixClient::RateLimit& rate = helix.rateLimit();
+  check(rate.known && rate.remaining < rate.limit && rate.reset > helix.now() && helix.now() > 1700000000,
+    "first poll: Ratelimit headers and helix time read");
+
+  check(polls(4) && simHttpConnects == 1, "next polls: same connection");
+
+  // an answer with Content-Length that is not read at all
+  check(helix.get("users?id=761017145") == HTTP_CODE_OK, "users lookup on the same connection");
+  helix.end();
+  check(poll() == (int)channels.size() && simHttpConnects == 1, "unread body drained, connection still usable");
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(STANDIN_IDLE_TIMEOUT_MS + 500));
+  uint32_t failed = helix.getStats().failedPolls;
+  check(poll() == (int)channels.size() && simHttpConnects == 2, "after the idle timeout: reconnected");
+
+  // the stand-in closes after its last request on a connection, the poll
+  // after that has to open a new one
+  check(polls(STANDIN_KEEP_ALIVE_REQUESTS) && simHttpConnects == 3, "after the keep-alive limit: reconnected");
+  check(helix.getStats().failedPolls == failed, "no poll failed on a closed connection");
+
+  pollMany();
+
+  const HelixClient::Stats& stats = helix.getStats();
+  S.printf("[Sim] %u polls reused the connection, %lu ms average; %u opened one, %lu ms average\n",
+    stats.reusedPolls, stats.reusedPolls ? stats.reusedMs/stats.reusedPolls : 0,
+    stats.newPolls, stats.newPolls ? stats.newMs/stats.newPolls : 0);
+
+  return checksDone();
+}
@@ -0,0 +1,170 @@
+// Host run of the live poll task (LivePoller.h) against the local helix
+// stand-in in sim/ ([env:native_livePoll]), with every helix answer held back
+// to look like a slow network. Runs a loop() with the title ticker first
+// with the polls inline, as before, and then with the poll task, and
+// compares the longest time loop() was held up and the ticker frame rate.
+// Also checks that a poll helix answers with an error gives no live set and
+// that changes of the live set only redraw what changed (LiveSet.h).
+// Exits with 1 if a check fails, see sim/SimCheck.h.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Debug.h"
+#include "SimCheck.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+#include "LivePoller.h"
+
+#define POLL_DELAY_MS 300
+#define POLL_INTERVAL_MS 500
+#define RUN_MS 2500
+// Goes offline for the checks of the live set changes
+#define OFFLINE_CHANNEL 2
+
+static bool setPollDelay(int ms){
+  return standin("delay?ms=" + std::to_string(ms));
+}
+
+static bool failNextPoll(int code){
+  return standin("fail?code=" + std::to_string(code));
+}
+
+struct loopRun {
+  unsigned long maxGapMs;
+  uint32_t frames;
+  uint32_t updates;
+};
+
+static unsigned long elapsedMs(std::chrono::steady_clock::time_point since){
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+// A loop() with the ticker for RUN_MS, polling inline every
+// POLL_INTERVAL_MS or taking the updates of the poll task
+static loopRun runLoop(bool pollInline){
+  loopRun run = {};
+  auto start = std::chrono::steady_clock::now(), last = start;
+  unsigned long lastPoll = 0;
+  bool polled = false;
+  while (elapsedMs(start) < RUN_MS) {
+    if (pollInline) {
+      if (!polled || elapsedMs(start) - lastPoll >= POLL_INTERVAL_MS) {
+        liveUpdate update = {};
+        lastPoll = elapsedMs(start);
+        polled = true;
+        if (pollLiveChannels(update)) {
+          applyLiveUpdate(update);
+          run.updates++;
+        }
+      }
+    } else if (applyLiveUpdates()) {
+      run.updates++;
+    }
+    if (updateTitleTicker()) run.frames++;
+    // the rest of loop() and its sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    unsigned long gap = elapsedMs(last);
+    run.maxGapMs = std::max(run.maxGapMs, gap);
+    last = std::chrono::steady_clock::now();
+  }
+  return run;
+}
+
+static void resetChannels(){
+  for (auto& c : channels) {
+    c.isLive = false;
+    c.slotNum = -1;
+    c.streamTitle.clear();
+  }
+  live_num = 0;
+  titleChangeQueue.clear();
+}
+
+int main(){
+  // a partition of our own for the avatar cache
+  char dir[] = "/tmp/livePollXXXXXX";
+  if(!mkdtemp(dir)) return 1;
+  setenv("SIM_DATA_DIR", dir, 1);
+
+  tft.init(170, 320);
+  tft.setRotation(1);
+  tftQueue.begin(TFT_CS, TFT_DC, 80000000);
+  setupRender();
+
+  if(!setPollDelay(POLL_DELAY_MS)){
+    S.printf("[Sim] No answer from %s, is sim/helix_standin.py running?\n", STANDIN_URL);
+    return 1;
+  }
+
+  loopRun before = runLoop(true);
+  S.printf("[Sim] inline polls: loop held up for up to %lu ms, %u ticker frames, %u updates\n",
+    before.maxGapMs, before.frames, before.updates);
+
+  resetChannels();
+  redrawLiveChannelPics();
+  livePoller.begin(POLL_INTERVAL_MS);
+  loopRun after = runLoop(false);
+  livePoller.end();
+  S.printf("[Sim] poll task:    loop held up for up to %lu ms, %u ticker frames, %u updates\n",
+    after.maxGapMs, after.frames, after.updates);
+  setPollDelay(0);
+
+  liveUpdate failed = {};
+  streamsFetch fetch;
+  failNextPoll(503);
+  bool polled = pollLiveChannels(failed, &fetch);
+
+  // the same live set again, then one channel offline, back and with a new title
+  liveUpdate same = {};
+  pollLiveChannels(same);
+  uint64_t bytes = tftQueue.stats().bytes;
+  size_t unchanged = applyLiveUpdate(same);
+  uint64_t unchangedBytes = tftQueue.stats().bytes - bytes;
+
+  std::vector<int8_t> slots;
+  for (auto& c : channels) slots.push_back(c.slotNum);
+  liveUpdate offline = same;
+  offline.streams.erase(std::find_if(offline.streams.begin(), offline.streams.end(),
+    [](const liveStream& s){ return s.channel == OFFLINE_CHANNEL; }));
+  bytes = tftQueue.stats().bytes;
+  size_t wentOffline = applyLiveUpdate(offline);
+  uint64_t offlineBytes = tftQueue.stats().bytes - bytes;
+  bool kept = channels[OFFLINE_CHANNEL].slotNum < 0;
+  for (size_t i = 0; i < channels.size(); i++) {
+    // the ones behind the "+N" tile move up into the free slot
+    if (i != OFFLINE_CHANNEL && slots[i] < MAX_NUM_PICS-1) kept = kept && channels[i].slotNum == slots[i];
+  }
+  S.printf("[Sim] a channel going offline: %u bytes sent\n", (uint32_t)offlineBytes);
+  size_t wentLive = applyLiveUpdate(same);
+
+  liveUpdate retitled = same;
+  retitled.streams[0].title += "(new) ";
+  titleChangeQueue.clear();
+  bytes = tftQueue.stats().bytes;
+  size_t titleChanged = applyLiveUpdate(retitled);
+  uint64_t titleBytes = tftQueue.stats().bytes - bytes;
+
+  const unsigned long framePeriodMs = 1000/TICKER_FPS;
+  check(before.maxGapMs >= POLL_DELAY_MS, "inline polls hold loop() up for the whole request");
+  // the interval runs from the end of a poll, as it did in loop()
+  check(livePoller.polls() >= RUN_MS/(POLL_INTERVAL_MS + POLL_DELAY_MS) && !livePoller.failures(),
+    "poll task polls on its interval");
+  check(after.updates >= 2, "updates reach loop() through the queue");
+  check(live_num == channels.size(), "live set applied");
+  // FramePacer merges a missed frame into the next one without the ticker slowing down
+  check(after.maxGapMs < 2*framePeriodMs, "loop() never held up for two ticker frame periods");
+  check(after.frames >= RUN_MS*TICKER_FPS/1000*0.9f, "ticker keeps its frame rate during polls");
+  check(!polled && fetch.code == 503 && failed.streams.empty(), "a failed request gives no live set");
+  check(unchanged == 0 && unchangedBytes == 0, "an unchanged live set changes and sends nothing");
+  check(wentOffline == 1 && kept, "a channel going offline leaves the others in their slots");
+  check(offlineBytes <= 2*SLOT_PIC_BYTES, "and only sends its slot and the \"+N\" tile");
+  check(wentLive == 1 && live_num == channels.size(), "a channel coming back is one change");
+  check(titleChanged == 1 && titleBytes == 0 && titleChangeQueue.size() == 1, "a new title only goes to the ticker");
+
+  return checksDone();
+}
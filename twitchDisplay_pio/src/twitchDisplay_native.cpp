@@ -0,0 +1,101 @@
+// Host-native run of the twitchDisplay renderer against the simulated ST7789
+// in sim/ ([env:native]). Replays a typical sequence of live changes and a
+// title ticker and prints the SPI traffic each phase causes, as a baseline
+// for rendering optimizations. Channel pics come from assets.bin, the image
+// of the assets partition (see AvatarStore.h), in $SIM_DATA_DIR or else in
+// data/ (see MappedPartition.h). Run it from the project directory, where
+// the build writes data/assets.bin:
+//
+//   pio run -e native && .pio/build/native/program [screenshot.ppm]
+
+#include <Arduino.h>
+
+#include "Debug.h"
+#include "Channels.h"
+#include "DisplayRender.h"
+
+#define TFT_CS         7
+#define TFT_RST       10
+#define TFT_DC         1
+
+// Stand-in for what loop() does between two ticker frames (OTA, LDR
+// filtering, UDP telemetry), during which queued transfers keep going
+#define SIM_LOOP_OTHER_US 1000
+
+Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
+
+// micros() without the time skipped in delay()
+static unsigned long cpuMicros(){
+  return micros() - simSkippedMicros;
+}
+
+static void report(const char* phase, unsigned long cpu_us, uint32_t frames){
+  // let the queued transfers finish so the panel stats are complete
+  tftQueue.wait();
+  const SimSpiStats& st = tft.simStats();
+  const TftDmaQueue::Stats& qs = tftQueue.stats();
+  S.printf("[Sim] %-12s frames: %5u  cmds: %7u  windows: %6u  pixel bytes: %9llu  total bytes: %9llu  bus: %7llu us  cpu: %7lu us\n",
+    phase, frames, st.commands, st.addrWindows,
+    (unsigned long long)st.pixelBytes, (unsigned long long)st.totalBytes(),
+    (unsigned long long)tft.simBusMicros(), cpu_us);
+  // bus time the caller did not spend waiting ran in parallel to it
+  uint64_t bus_us = tft.simBusMicros();
+  uint64_t overlap_us = (bus_us > qs.stallMicros) ? bus_us - qs.stallMicros : 0;
+  S.printf("[Sim] %-12s queue: %u transactions, %u stalls, %llu us stalled, %llu us (%llu%%) of bus time overlapped, %llu pixels overdrawn\n",
+    phase, qs.transactions, qs.stalls, (unsigned long long)qs.stallMicros,
+    (unsigned long long)overlap_us, (unsigned long long)(bus_us ? overlap_us*100/bus_us : 0),
+    (unsigned long long)qs.overdrawPixels);
+  const AvatarStore::Stats& as = avatars.stats();
+  if(as.mapped || as.expanded || as.hits || as.loads || as.failed){
+    S.printf("[Sim] %-12s avatars: %u from flash, %u expanded, %u hits, %u loads, %u missing, %u us loading, %u bytes of tiles\n",
+      phase, as.mapped, as.expanded, as.hits, as.loads, as.failed, as.loadMicros, as.tileBytes);
+  }
+  if(frames > 1){
+    S.printf("[Sim] %-12s per frame: %llu bytes, %llu us bus\n", phase,
+      (unsigned long long)(st.totalBytes()/frames), (unsigned long long)(tft.simBusMicros()/frames));
+  }
+  tft.resetSimStats();
+  tftQueue.resetStats();
+  avatars.resetStats();
+}
+
+static void setLive(channelInfo& channel, const char* title){
+  channel.isLive = true;
+  channel.streamTitle = title;
+  live_num++;
+  titleChangeQueue.push_back(&channel);
+}
+
+int main(int argc, char** argv){
+  tft.init(170, 320);
+  tft.setRotation(1);
+  tft.setSPISpeed(80000000);
+  tftQueue.begin(TFT_CS, TFT_DC, 80000000);
+  setupRender();
+  report("init", 0, 1);
+
+  unsigned long t = cpuMicros();
+  setLive(channels[1], "    Sonntagsstream mit der ganzen Crew | Just Chatting   ");
+  setLive(channels[4], "    Kein Plan, einfach Spass | Minecraft   ");
+  setLive(channels[6], "    Ranked bis zum Umfallen | League of Legends   ");
+  redrawLiveChannelPics();
+  report("go live", cpuMicros() - t, 1);
+
+  t = cpuMicros();
+  channels[2].isLive = true;
+  live_num++;
+  redrawLiveChannelPics();
+  report("one more", cpuMicros() - t, 1);
+
+  uint32_t frames = 0;
+  t = cpuMicros();
+  do {
+    if(updateTitleTicker()) frames++;
+    delayMicroseconds(SIM_LOOP_OTHER_US);
+  } while(isTitleDisplaying || !titleChangeQueue.empty());
+  unsigned long ticker_us = cpuMicros() - t;
+  report("ticker", ticker_us, frames);
+
+  if(argc > 1) tft.simSavePPM(argv[1]);
+  return 0;
+}
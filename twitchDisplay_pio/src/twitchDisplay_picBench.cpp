@@ -0,0 +1,183 @@
+// Host benchmark of the CPU time it takes to get one 64x64 channel pic into
+// the SPI line buffers ([env:native_picBench]):
+//   swap:   native endian RGB565, byte swapped per pixel
+//   raw:    RGB565 in wire order, copied as it is
+//   packed: the packed pics from the generated pics.h, unpacked by PicDecoder
+//   palette: the palette pics from pics.h, expanded by PaletteDecoder, only
+//            with palette = yes in the [pics] section
+// The swap and raw copies are unpacked into RAM first. Also checks that every
+// channel in pics.h is found by picForChannel() and measures the formats
+// through the whole queue.
+//
+//   pio run -e native_picBench && .pio/build/native_picBench/program
+
+#include <Arduino.h>
+
+#include "Debug.h"
+#include "pics.h"
+#include "PicDecoder.h"
+#include "PaletteDecoder.h"
+#include "TftDmaQueue.h"
+
+#define PIC_PIXELS (PIC_SIZE*PIC_SIZE)
+#define BENCH_ROUNDS 2000
+
+Adafruit_ST7789 tft = Adafruit_ST7789(7, 1, 10);
+TftDmaQueue tftQueue(tft, 0, 35);
+
+static_assert(PICS_PACKED, "the benchmark needs packed = yes in the [pics] section");
+
+struct benchPic {
+  const char* id;
+  const uint8_t* packed;
+  uint32_t packedSize;
+  const uint8_t* palette;
+  uint32_t paletteSize;
+  uint16_t native[PIC_PIXELS];
+  uint16_t wire[PIC_PIXELS];
+};
+
+// every pic once, channels may share one
+benchPic pics[CHANNEL_PICS_NUM];
+int numPics = 0;
+
+// one line buffer, filled chunk by chunk like the queue does
+uint16_t line[TftDmaQueue::LINE_PIXELS];
+volatile uint16_t sink;
+
+float benchSwap(const uint16_t* pic){
+  unsigned long t = micros();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (uint32_t i = 0; i < PIC_PIXELS; i += TftDmaQueue::LINE_PIXELS) {
+      TftDmaQueue::toWire(line, pic + i, TftDmaQueue::LINE_PIXELS);
+      sink = line[r % TftDmaQueue::LINE_PIXELS];
+    }
+  }
+  return (micros() - t) * 1000.0f / BENCH_ROUNDS;
+}
+
+float benchRaw(const uint16_t* pic){
+  unsigned long t = micros();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (uint32_t i = 0; i < PIC_PIXELS; i += TftDmaQueue::LINE_PIXELS) {
+      memcpy(line, pic + i, TftDmaQueue::LINE_PIXELS*2);
+      sink = line[r % TftDmaQueue::LINE_PIXELS];
+    }
+  }
+  return (micros() - t) * 1000.0f / BENCH_ROUNDS;
+}
+
+float benchPacked(const uint8_t* pic){
+  unsigned long t = micros();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    PicDecoder decoder(pic);
+    for (uint32_t i = 0; i < PIC_PIXELS; i += TftDmaQueue::LINE_PIXELS) {
+      decoder.decode(line, TftDmaQueue::LINE_PIXELS);
+      sink = line[r % TftDmaQueue::LINE_PIXELS];
+    }
+  }
+  return (micros() - t) * 1000.0f / BENCH_ROUNDS;
+}
+
+float benchPalette(const uint8_t* pic){
+  unsigned long t = micros();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    PaletteDecoder decoder(pic);
+    for (uint32_t i = 0; i < PIC_PIXELS; i += TftDmaQueue::LINE_PIXELS) {
+      decoder.decode(line, TftDmaQueue::LINE_PIXELS);
+      sink = line[r % TftDmaQueue::LINE_PIXELS];
+    }
+  }
+  return (micros() - t) * 1000.0f / BENCH_ROUNDS;
+}
+
+int main(){
+  bool ok = true;
+  for (const channelPic& entry : channelPics) {
+    if (picForChannel(entry.id) != entry.pic) {
+      DEBUG_E.printf("[Bench] picForChannel(\"%s\") does not find its pic\n", entry.id);
+      ok = false;
+    }
+    bool seen = false;
+    for (int i = 0; i < numPics; i++) seen |= pics[i].packed == entry.pic;
+    if (seen) continue;
+    benchPic& pic = pics[numPics++];
+    pic.id = entry.id;
+    pic.packed = entry.pic;
+    pic.packedSize = entry.size;
+#if PICS_PALETTE
+    pic.palette = entry.palette;
+    pic.paletteSize = 2 + PaletteDecoder::size(entry.palette)*2 + PIC_PIXELS;
+#endif
+    PicDecoder(entry.pic).decode(pic.wire, PIC_PIXELS);
+    TftDmaQueue::toWire(pic.native, pic.wire, PIC_PIXELS);
+  }
+
+#if !PICS_PALETTE
+  S.printf("[Bench] palette: not built, set palette = yes in the [pics] section\n");
+#endif
+  float swap_total = 0, raw_total = 0, packed_total = 0, palette_total = 0;
+  uint32_t size_total = 0, palette_size_total = 0;
+  S.printf("[Bench] %-12s %10s %10s %10s %10s %14s %14s\n", "channel", "swap ns", "raw ns", "packed ns", "palette ns",
+    "packed bytes", "palette bytes");
+  for (int i = 0; i < numPics; i++) {
+    const benchPic& pic = pics[i];
+    float swap_ns = benchSwap(pic.native);
+    float raw_ns = benchRaw(pic.wire);
+    float packed_ns = benchPacked(pic.packed);
+#if PICS_PALETTE
+    float palette_ns = benchPalette(pic.palette);
+#else
+    float palette_ns = 0;
+#endif
+    swap_total += swap_ns;
+    raw_total += raw_ns;
+    packed_total += packed_ns;
+    palette_total += palette_ns;
+    size_total += pic.packedSize;
+    palette_size_total += pic.paletteSize;
+    S.printf("[Bench] %-12s %10.0f %10.0f %10.0f %10.0f %6u (%4.1fx) %6u (%4.1fx)\n", pic.id, swap_ns, raw_ns, packed_ns,
+      palette_ns, pic.packedSize, PIC_PIXELS*2.0f/pic.packedSize, pic.paletteSize,
+      pic.paletteSize ? PIC_PIXELS*2.0f/pic.paletteSize : 0);
+  }
+  const int n = numPics;
+  S.printf("[Bench] %-12s %10.0f %10.0f %10.0f %10.0f %6u (%4.1fx) %6u (%4.1fx)\n", "average", swap_total/n, raw_total/n,
+    packed_total/n, palette_total/n, size_total/n, n*PIC_PIXELS*2.0f/size_total,
+    palette_size_total/n, palette_size_total ? n*PIC_PIXELS*2.0f/palette_size_total : 0);
+
+  // the same through the queue, including handing the bytes to the simulated panel
+  tft.init(170, 320);
+  tft.setRotation(1);
+  tftQueue.begin(7, 1, 80000000);
+  unsigned long t = micros();
+  for (int i = 0; i < n; i++) tftQueue.drawRGBBitmap(11, 14, pics[i].native, PIC_SIZE, PIC_SIZE);
+  tftQueue.wait();
+  unsigned long swap_us = micros() - t;
+  t = micros();
+  for (int i = 0; i < n; i++) tftQueue.drawRawBitmap(11, 14, (const uint8_t*)pics[i].wire, PIC_SIZE, PIC_SIZE);
+  tftQueue.wait();
+  unsigned long raw_us = micros() - t;
+  t = micros();
+  for (int i = 0; i < n; i++) {
+    PicDecoder decoder(pics[i].packed);
+    tftQueue.setAddrWindow(11, 14, PIC_SIZE, PIC_SIZE);
+    tftQueue.writeFrom(decoder, PIC_PIXELS);
+  }
+  tftQueue.wait();
+  unsigned long packed_us = micros() - t;
+  unsigned long palette_us = 0;
+#if PICS_PALETTE
+  t = micros();
+  for (int i = 0; i < n; i++) {
+    PaletteDecoder decoder(pics[i].palette);
+    tftQueue.setAddrWindow(11, 14, PIC_SIZE, PIC_SIZE);
+    tftQueue.writeFrom(decoder, PIC_PIXELS);
+  }
+  tftQueue.wait();
+  palette_us = micros() - t;
+#endif
+  S.printf("[Bench] through the queue: %lu us swap, %lu us raw, %lu us packed, %lu us palette for %d pics\n",
+    swap_us, raw_us, packed_us, palette_us, n);
+
+  return ok ? 0 : 1;
+}
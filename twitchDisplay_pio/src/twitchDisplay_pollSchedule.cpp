@@ -0,0 +1,172 @@
+// Host run of the poll schedule in PollScheduler.h ([env:native_pollSchedule])
+// on a simulated clock, without helix. Compares it with polling every
+// TW_UPDATE_INTERVAL as before:
+//  - a week of channels going live around the same time every evening, for
+//    how long a go-live takes to show up and how many polls that costs
+//  - DISPLAYS displays sharing one token with TOKEN_LIMIT points a minute,
+//    for how many polls helix answers with 429
+//  - failed polls and a 429, for the backoff
+// Exits with 1 if a check fails, see sim/SimCheck.h.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <vector>
+
+#include "Debug.h"
+#include "SimCheck.h"
+#include "HelixTime.h"
+#include "PollScheduler.h"
+
+#define TW_UPDATE_INTERVAL (30*1000)
+
+#define CHANNELS 10
+#define DAYS 7
+// Every channel goes live within GO_LIVE_SPREAD_S after 18:00 UTC, give or
+// take GO_LIVE_WOBBLE_S, and streams three hours
+#define GO_LIVE_SPREAD_S (60*60)
+#define GO_LIVE_WOBBLE_S (5*60)
+#define STREAM_S (3*60*60)
+
+#define DISPLAYS 40
+#define TOKEN_LIMIT 60
+#define SHARED_RUN_S (60*60)
+
+struct weekRun {
+  uint32_t polls;      // after the first day
+  uint32_t detections; // after the first day
+  uint64_t latencySum;
+  uint32_t latencyMax;
+};
+
+// A week of polls for CHANNELS channels that go live every evening, with
+// the schedule or every TW_UPDATE_INTERVAL. The first day only teaches the
+// schedule.
+static weekRun runWeek(bool scheduled){
+  const uint32_t start = epochFromCivil(2024, 11, 25, 0, 0, 0);
+  srand(1);
+  std::vector<uint32_t> goLive;
+  for (int day = 0; day < DAYS; day++) {
+    for (int c = 0; c < CHANNELS; c++) {
+      goLive.push_back(start + day*86400 + 18*3600 + c*GO_LIVE_SPREAD_S/CHANNELS
+        + random(-GO_LIVE_WOBBLE_S, GO_LIVE_WOBBLE_S));
+    }
+  }
+
+  weekRun run = {};
+  PollScheduler scheduler(TW_UPDATE_INTERVAL);
+  HelixClient::RateLimit rate;
+  rate.known = true;
+  rate.limit = rate.remaining = 800;
+  std::vector<uint32_t> seen(CHANNELS, 0);
+  uint64_t ms = (uint64_t)start * 1000;
+  while (ms < (uint64_t)(start + DAYS*86400) * 1000) {
+    uint32_t now = ms / 1000;
+    bool learnt = now >= start + 86400;
+    if (learnt) run.polls++;
+    for (size_t i = 0; i < goLive.size(); i++) {
+      uint8_t c = i % CHANNELS;
+      if (now < goLive[i] || now >= goLive[i] + STREAM_S || seen[c] == goLive[i]) continue;
+      seen[c] = goLive[i];
+      scheduler.wentLive(goLive[i], now);
+      if (learnt) {
+        run.detections++;
+        run.latencySum += now - goLive[i];
+        run.latencyMax = std::max(run.latencyMax, now - goLive[i]);
+      }
+    }
+    rate.reset = now + 1;
+    ms += scheduled ? scheduler.next(true, HTTP_CODE_OK, 1, rate, now) : TW_UPDATE_INTERVAL;
+  }
+  return run;
+}
+
+// The points of a token, refilled over a minute as helix does
+struct tokenBucket {
+  double points = TOKEN_LIMIT;
+  double when = 0;
+
+  bool take(double now, HelixClient::RateLimit& rate){
+    points = std::min<double>(TOKEN_LIMIT, points + (now - when) * TOKEN_LIMIT / 60);
+    when = now;
+    bool ok = points >= 1;
+    if (ok) points -= 1;
+    rate.known = true;
+    rate.limit = TOKEN_LIMIT;
+    rate.remaining = points;
+    rate.reset = now + (TOKEN_LIMIT - points) * 60 / TOKEN_LIMIT + 1;
+    return ok;
+  }
+};
+
+struct sharedRun {
+  uint32_t polls;
+  uint32_t throttled;
+};
+
+// DISPLAYS displays switched on together and sharing a token for
+// SHARED_RUN_S, with the schedule or every TW_UPDATE_INTERVAL
+static sharedRun runShared(bool scheduled){
+  srand(2);
+  tokenBucket token;
+  std::vector<PollScheduler> schedulers(DISPLAYS, PollScheduler(TW_UPDATE_INTERVAL));
+  std::vector<uint64_t> next(DISPLAYS, 0);
+  sharedRun run = {};
+  for (;;) {
+    size_t d = std::min_element(next.begin(), next.end()) - next.begin();
+    if (next[d] >= SHARED_RUN_S*1000ULL) break;
+    HelixClient::RateLimit rate;
+    bool ok = token.take(next[d] / 1000.0, rate);
+    run.polls++;
+    if (!ok) run.throttled++;
+    uint32_t now = next[d] / 1000;
+    next[d] += scheduled ? schedulers[d].next(ok, ok ? HTTP_CODE_OK : 429, 1, rate, now) : TW_UPDATE_INTERVAL;
+  }
+  return run;
+}
+
+int main(){
+  weekRun fixed = runWeek(false);
+  weekRun scheduled = runWeek(true);
+  S.printf("[Sim] every %u s: %u go-lives, %.1f s to show up on average, %u s at most, %u polls\n",
+    TW_UPDATE_INTERVAL/1000, fixed.detections, (double)fixed.latencySum/fixed.detections, fixed.latencyMax, fixed.polls);
+  S.printf("[Sim] scheduled: %u go-lives, %.1f s to show up on average, %u s at most, %u polls\n",
+    scheduled.detections, (double)scheduled.latencySum/scheduled.detections, scheduled.latencyMax, scheduled.polls);
+  check(scheduled.latencySum < fixed.latencySum/2, "go-lives show up in half the time");
+  check(scheduled.polls < fixed.polls*5/4, "for less than a quarter more polls");
+
+  sharedRun same = runShared(false);
+  sharedRun shared = runShared(true);
+  S.printf("[Sim] %u displays on %u points a minute, every %u s: %u polls, %u answered 429\n",
+    DISPLAYS, TOKEN_LIMIT, TW_UPDATE_INTERVAL/1000, same.polls, same.throttled);
+  S.printf("[Sim] %u displays on %u points a minute, scheduled: %u polls, %u answered 429\n",
+    DISPLAYS, TOKEN_LIMIT, shared.polls, shared.throttled);
+  check(same.throttled > 0, "displays polling every interval get throttled");
+  check(shared.throttled == 0, "scheduled displays share the token without a 429");
+  check(shared.polls >= SHARED_RUN_S/60*TOKEN_LIMIT*(100 - RATE_LIMIT_RESERVE)/100*9/10,
+    "and use the points above the reserve");
+
+  srand(3);
+  PollScheduler scheduler(TW_UPDATE_INTERVAL);
+  HelixClient::RateLimit unknown;
+  bool doubling = true;
+  uint32_t wait = 0, last = TW_UPDATE_INTERVAL;
+  for (int i = 0; i < 8; i++) {
+    wait = scheduler.next(false, 503, 1, unknown, 0);
+    uint32_t expected = std::min<uint32_t>(POLL_MAX_BACKOFF, last * 2);
+    doubling = doubling && wait >= expected*(100 - POLL_JITTER)/100 && wait <= expected*(100 + POLL_JITTER)/100;
+    last = expected;
+  }
+  check(doubling, "failed polls double the wait up to POLL_MAX_BACKOFF");
+  wait = scheduler.next(true, HTTP_CODE_OK, 1, unknown, 0);
+  check(wait >= TW_UPDATE_INTERVAL*(100 - POLL_JITTER)/100 && wait <= TW_UPDATE_INTERVAL*(100 + POLL_JITTER)/100,
+    "a poll that worked goes back to the interval");
+  HelixClient::RateLimit empty;
+  empty.known = true;
+  empty.limit = 800;
+  empty.remaining = 0;
+  empty.reset = 1000 + 45;
+  wait = scheduler.next(false, 429, 1, empty, 1000);
+  check(wait >= 45*1000 && wait <= 45*1000*(100 + POLL_JITTER)/100, "a 429 waits for the reset");
+
+  return checksDone();
+}
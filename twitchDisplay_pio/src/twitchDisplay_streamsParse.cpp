@@ -0,0 +1,228 @@
+// Host measurement of the helix/streams parsers in HelixStreams.h
+// ([env:native_streamsParse]). Parses the answers in sim/fixtures/streams/
+// with a whole JsonDocument, through the filter and with readStreams() and
+// prints the peak heap of the JsonDocuments, the memory readStreams() needs
+// on the stack and the parse time of all three. Checks that the filtered
+// document and readStreams() have everything the live polls show as the
+// whole document has it, and that the filtered document has nothing else.
+// Exits with 1 if a check fails, see sim/SimCheck.h.
+//
+// The answers are made up but have every field helix sends; page100 is a
+// full page of 100 streams with the non-ASCII characters escaped. Pointers are
+// twice as big here as on the ESP32-C3, so are the JsonDocument slots; the
+// strings are the same size. The small filter document itself is not counted.
+// The heap is seen through the CountingAllocator, so every JsonDocument has
+// to allocate through it or the check fails. Only a build against an
+// ArduinoJson stand-in without allocators, with -D STREAMS_PARSE_SKIP_HEAP,
+// skips the heap checks and says why.
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <string>
+
+#include "Debug.h"
+#include "SimCheck.h"
+#include "HelixStreams.h"
+
+#define STREAMS_FIXTURES "sim/fixtures/streams/"
+#define PARSE_ROUNDS 2000
+
+// Keeps track of the bytes a JsonDocument has on the heap
+class CountingAllocator : public ArduinoJson::Allocator {
+  public:
+    void* allocate(size_t size) override {
+      uint8_t* p = (uint8_t*)malloc(HEADER + size);
+      if (!p) return nullptr;
+      *(size_t*)p = size;
+      grow(size);
+      allocs++;
+      return p + HEADER;
+    }
+
+    void deallocate(void* ptr) override {
+      if (!ptr) return;
+      uint8_t* p = (uint8_t*)ptr - HEADER;
+      current -= *(size_t*)p;
+      free(p);
+    }
+
+    void* reallocate(void* ptr, size_t size) override {
+      if (!ptr) return allocate(size);
+      uint8_t* p = (uint8_t*)ptr - HEADER;
+      size_t old = *(size_t*)p;
+      p = (uint8_t*)realloc(p, HEADER + size);
+      if (!p) return nullptr;
+      *(size_t*)p = size;
+      current -= old;
+      grow(size);
+      allocs++;
+      return p + HEADER;
+    }
+
+    // Counts from here on, peak() leaves out what is allocated already
+    void reset(){
+      base = high = current;
+      allocs = 0;
+    }
+
+    size_t peak() const { return high - base; }
+
+    size_t current = 0;
+    uint32_t allocs = 0;
+
+  private:
+    static const size_t HEADER = 16;  // keeps the blocks aligned
+    size_t base = 0, high = 0;
+
+    void grow(size_t size){
+      current += size;
+      if (current > high) high = current;
+    }
+};
+
+// readStreams() input from memory
+struct stringReader {
+  const char* p;
+  const char* end;
+  size_t readBytes(char* buf, size_t len){
+    len = std::min(len, (size_t)(end - p));
+    memcpy(buf, p, len);
+    p += len;
+    return len;
+  }
+};
+
+struct parseResult {
+  size_t peak;
+  uint32_t allocs;
+  float us;
+};
+
+static bool readFixture(const char* name, std::string& json){
+  std::string path = std::string(STREAMS_FIXTURES) + name + ".json";
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) {
+    S.printf("[Sim] Cannot open %s, run the program from the project directory\n", path.c_str());
+    return false;
+  }
+  char buf[1024];
+  size_t n;
+  json.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) json.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+// Parses json into doc once for the heap numbers and then PARSE_ROUNDS times
+// for the time
+template<typename Parse>
+static parseResult measure(CountingAllocator& allocator, JsonDocument& doc, const std::string& json, Parse parse){
+  parseResult result;
+  doc.clear();
+  allocator.reset();
+  if (parse(doc, json)) return {0, 0, -1};
+  result.peak = allocator.peak();
+  result.allocs = allocator.allocs;
+
+  unsigned long t = micros();
+  for (int r = 0; r < PARSE_ROUNDS; r++) {
+    JsonDocument scratch(&allocator);
+    parse(scratch, json);
+  }
+  result.us = (micros() - t) / (float)PARSE_ROUNDS;
+  return result;
+}
+
+static bool same(JsonVariant a, JsonVariant b){
+  const char* x = a;
+  const char* y = b;
+  return x && y && strcmp(x, y) == 0;
+}
+
+static bool same(JsonVariant a, const char* b){
+  const char* x = a;
+  return x && strcmp(x, b) == 0;
+}
+
+// readStreams() over json PARSE_ROUNDS times, us per parse or -1
+static float measureTokenizer(const std::string& json){
+  uint32_t streams = 0;
+  unsigned long t = micros();
+  for (int r = 0; r < PARSE_ROUNDS; r++) {
+    stringReader in = {json.data(), json.data() + json.size()};
+    if (!readStreams(in, [&](const streamFields&){ streams++; })) return -1;
+  }
+  return (micros() - t) / (float)PARSE_ROUNDS;
+}
+
+int main(){
+  static const char* fixtures[] = {"none", "three", "all", "page100"};
+  CountingAllocator allocator;
+  const uint32_t tokenizerStack = sizeof(JsonTokenizer<stringReader, STREAM_TITLE_MAX>) + sizeof(streamFields);
+  S.printf("[Bench] readStreams() stack for any answer: %u B, tokenizer %u + streamFields %u, no heap\n",
+    tokenizerStack, (uint32_t)sizeof(JsonTokenizer<stringReader, STREAM_TITLE_MAX>), (uint32_t)sizeof(streamFields));
+
+  S.printf("[Bench] %-7s %6s %6s %10s %8s %10s %10s %8s %10s %10s %10s\n", "answer", "bytes", "live",
+    "full heap", "allocs", "full us", "filt heap", "allocs", "filt us", "sax stack", "sax us");
+  for (const char* name : fixtures) {
+    std::string json;
+    if (!readFixture(name, json)) return 1;
+
+    JsonDocument full(&allocator), filtered(&allocator);
+    parseResult a = measure(allocator, full, json, [](JsonDocument& doc, const std::string& in){
+      return (bool)deserializeJson(doc, in);
+    });
+    parseResult b = measure(allocator, filtered, json, [](JsonDocument& doc, const std::string& in){
+      return (bool)deserializeStreams(doc, in);
+    });
+    float saxUs = measureTokenizer(json);
+    if (a.us < 0 || b.us < 0 || saxUs < 0) {
+      check(false, name, "parses");
+      continue;
+    }
+
+    JsonArray fullStreams = full["data"].as<JsonArray>();
+    JsonArray streams = filtered["data"].as<JsonArray>();
+    // a dash where the allocator saw nothing rather than a heap of 0
+    std::string fullHeap = a.allocs ? std::to_string(a.peak) : "-";
+    std::string filtHeap = b.allocs ? std::to_string(b.peak) : "-";
+    S.printf("[Bench] %-7s %6u %6u %10s %8u %10.1f %10s %8u %10.1f %10u %10.1f\n", name, (uint32_t)json.size(),
+      (uint32_t)streams.size(), fullHeap.c_str(), a.allocs, a.us, filtHeap.c_str(), b.allocs, b.us,
+      tokenizerStack, saxUs);
+
+    check(streams.size() == fullStreams.size(), name, "every live stream kept");
+    bool fields = true, extra = false;
+    for (size_t i = 0; i < streams.size(); i++) {
+      JsonObject f = streams[i], s = fullStreams[i];
+      fields = fields && same(f["user_id"], s["user_id"]) && same(f["user_name"], s["user_name"])
+        && same(f["title"], s["title"]) && same(f["game_name"], s["game_name"]);
+      extra = extra || f.size() != 4;
+    }
+    check(fields, name, "user_id, user_name, title and game_name as in the full parse");
+    check(!extra && filtered.as<JsonObject>().size() == 1, name, "nothing else kept");
+    if (streams.size()) {
+#ifdef STREAMS_PARSE_SKIP_HEAP
+      S.printf("[Sim] %-7s %-60s %s\n", name, "less heap than the full parse",
+        "skipped, STREAMS_PARSE_SKIP_HEAP: the ArduinoJson stand-in does not use the allocator");
+#else
+      check(a.allocs && b.allocs, name, "the JsonDocuments allocate through the allocator");
+      check(b.peak < a.peak, name, "less heap than the full parse");
+#endif
+    }
+
+    size_t i = 0;
+    bool saxFields = true;
+    stringReader in = {json.data(), json.data() + json.size()};
+    bool whole = readStreams(in, [&](const streamFields& f){
+      JsonObject s = fullStreams[i++];
+      saxFields = saxFields && same(s["user_id"], f.userId) && same(s["user_name"], f.userName)
+        && same(s["title"], f.title) && same(s["game_name"], f.gameName);
+    });
+    check(whole && i == fullStreams.size() && saxFields, name, "readStreams() hands over the same fields");
+    in = {json.data(), json.data() + json.size()/2};
+    check(!readStreams(in, [](const streamFields&){}), name, "readStreams() notices a cut off answer");
+  }
+
+  return checksDone();
+}